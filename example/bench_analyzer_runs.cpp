@@ -0,0 +1,57 @@
+#include <chrono>
+#include <ioh.hpp>
+
+/******************************************************************************
+ * This command line interface aims at measuring the throughput of the
+ * logger::Analyzer, in runs per second, for campaigns of many short runs
+ * on a cheap problem (OneMax), where the per-run bookkeeping of the logger
+ * (info file entries, data file header) costs more than the runs themselves.
+ *****************************************************************************/
+using namespace ioh;
+
+int main(int argc, char **argv)
+{
+    const size_t runs = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    const size_t evaluations = argc > 2 ? std::atoi(argv[2]) : 10;
+    const int dimension = argc > 3 ? std::atoi(argv[3]) : 16;
+    std::clog << "Analyzer: runs=" << runs << ", evaluations=" << evaluations << ", dimension=" << dimension
+              << std::endl;
+
+    problem::pbo::OneMax pb(1, dimension);
+    std::vector<std::vector<int>> solutions;
+    for (size_t s = 0; s < evaluations; ++s)
+    {
+        auto &x = solutions.emplace_back();
+        for (const auto xi : common::random::pbo::uniform(dimension, static_cast<long>(s)))
+            x.push_back(xi < 0.5 ? 0 : 1);
+    }
+
+    // The cost of the runs themselves.
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < runs; ++r)
+    {
+        for (const auto &x : solutions)
+            pb(x);
+        pb.reset();
+    }
+    const std::chrono::duration<double> unlogged = std::chrono::steady_clock::now() - start;
+    std::cout << "without logger: " << static_cast<double>(runs) / unlogged.count() << " runs/s" << std::endl;
+
+    logger::Analyzer analyzer({trigger::on_improvement}, {}, fs::current_path(), "bench_analyzer_runs");
+    pb.attach_logger(analyzer);
+    start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < runs; ++r)
+    {
+        for (const auto &x : solutions)
+            pb(x);
+        pb.reset();
+    }
+    pb.detach_logger();
+    analyzer.close();
+    const std::chrono::duration<double> logged = std::chrono::steady_clock::now() - start;
+    std::cout << "Analyzer: " << static_cast<double>(runs) / logged.count() << " runs/s" << std::endl;
+    std::cout << "overhead per run: " << (logged.count() - unlogged.count()) / static_cast<double>(runs) * 1e6
+              << " us" << std::endl;
+
+    fs::remove_all(analyzer.output_directory());
+}
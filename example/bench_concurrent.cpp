@@ -0,0 +1,63 @@
+#include <chrono>
+#include <thread>
+#include <ioh.hpp>
+
+/******************************************************************************
+ * This command line interface aims at measuring how problem::Concurrent scales
+ * when many threads evaluate the same problem instance, as in asynchronous
+ * parallel algorithms, with 1, 2, 4, ... up to 64 threads. The throughput is
+ * measured without logger, and with a logger, whose events are then replayed
+ * in order by one thread at a time.
+ *****************************************************************************/
+using namespace ioh;
+
+namespace
+{
+    //! Evaluations per second of random search by the given number of threads.
+    double throughput(problem::Real &pb, const int threads, const size_t evaluations)
+    {
+        const auto n = pb.meta_data().n_variables;
+        problem::Concurrent<double> concurrent(pb);
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (auto t = 0; t < threads; ++t)
+            workers.emplace_back([&, t] {
+                const auto x = common::random::pbo::uniform(n * 64, t, -5, 5);
+                std::vector<double> xi(n);
+                for (size_t s = t; s < evaluations; s += threads)
+                {
+                    std::copy_n(x.begin() + (s % 64) * n, n, xi.begin());
+                    concurrent(xi);
+                }
+            });
+        for (auto &w : workers)
+            w.join();
+        concurrent.flush();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        concurrent.reset();
+        return static_cast<double>(evaluations) / elapsed.count();
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const size_t evaluations = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    const int dimension = argc > 2 ? std::atoi(argv[2]) : 20;
+    const int max_threads = argc > 3 ? std::atoi(argv[3]) : 64;
+    std::clog << "Concurrent: evaluations=" << evaluations << ", dimension=" << dimension
+              << ", hardware threads=" << std::thread::hardware_concurrency() << std::endl;
+
+    problem::bbob::Sphere sphere(1, dimension);
+    problem::bbob::Rastrigin rastrigin(1, dimension);
+    logger::Store store({trigger::on_improvement}, {watch::transformed_y_best});
+
+    std::cout << "threads\tSphere\tRastrigin\tRastrigin+logger (evaluations/s)" << std::endl;
+    for (auto threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::cout << threads << "\t" << throughput(sphere, threads, evaluations) << "\t"
+                  << throughput(rastrigin, threads, evaluations);
+        rastrigin.attach_logger(store);
+        std::cout << "\t" << throughput(rastrigin, threads, evaluations) << std::endl;
+        rastrigin.detach_logger();
+    }
+}
@@ -0,0 +1,84 @@
+#include <chrono>
+#include <ioh.hpp>
+
+/******************************************************************************
+ * This command line interface aims at measuring the throughput of the
+ * logger::FlatFile, in lines per second, when storing positions.
+ * Namely the buffered formatting VS formatting each field into a string
+ * and streaming it to the file, line by line (as was done before).
+ *****************************************************************************/
+using namespace ioh;
+
+/** The previous implementation of FlatFile::call, as a reference. */
+class StreamedFlatFile : public logger::FlatFile
+{
+public:
+    using logger::FlatFile::FlatFile;
+
+    void call(const logger::Info &log_info) override
+    {
+        if (requires_header_)
+        {
+            out_ << com_ + common_header_ + fmt::format("{}", fmt::join(properties_vector_, sep_));
+            if (store_positions_)
+                for (size_t i = 0; i < log_info.current.x.size(); i++)
+                    out_ << sep_ << "x" << i;
+            out_ << eol_;
+            requires_header_ = false;
+        }
+
+        out_ << current_meta_data_;
+        for (auto p = properties_vector_.begin(); p != properties_vector_.end();)
+            out_ << p->get().call_to_string(log_info, nan_) << (++p != properties_vector_.end() ? sep_ : "");
+
+        if (store_positions_)
+            out_ << sep_ << fmt::format("{:f}", fmt::join(log_info.current.x, sep_));
+
+        out_ << eol_;
+        out_.flush();
+    }
+};
+
+template <class L>
+double lines_per_second(L &logger, const int dimension, const size_t lines)
+{
+    problem::WrappedProblem<double> pb(
+        [](const std::vector<double> &x) {
+            double y = 0;
+            for (const auto xi : x)
+                y += xi * xi;
+            return y;
+        },
+        "Sphere", dimension);
+    pb.attach_logger(logger);
+
+    const auto x = common::random::doubles(dimension, -5, 5);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < lines; ++i)
+        pb(x);
+    logger.close();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(lines) / elapsed.count();
+}
+
+int main(int argc, char **argv)
+{
+    const size_t lines = argc > 1 ? std::atoi(argv[1]) : 100000;
+    const int dimension = argc > 2 ? std::atoi(argv[2]) : 100;
+    std::clog << "FlatFile: lines=" << lines << ", dimension=" << dimension << ", store_positions" << std::endl;
+
+    const auto properties = std::vector<std::reference_wrapper<logger::Property>>{
+        watch::evaluations, watch::raw_y_best, watch::current_y, watch::transformed_y, watch::transformed_y_best};
+
+    StreamedFlatFile streamed({trigger::always}, properties, "streamed.dat", ".", " ", "", "None", "\n", false, true);
+    const auto before = lines_per_second(streamed, dimension, lines);
+    std::cout << "streamed: " << before << " lines/s" << std::endl;
+
+    logger::FlatFile buffered({trigger::always}, properties, "buffered.dat", ".", " ", "", "None", "\n", false, true);
+    const auto after = lines_per_second(buffered, dimension, lines);
+    std::cout << "buffered: " << after << " lines/s" << std::endl;
+
+    std::cout << "speedup: " << after / before << std::endl;
+    fs::remove("streamed.dat");
+    fs::remove("buffered.dat");
+}
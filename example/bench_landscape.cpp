@@ -0,0 +1,36 @@
+#include <chrono>
+#include <thread>
+#include <ioh.hpp>
+
+/******************************************************************************
+ * This command line interface aims at measuring the time to compute the
+ * landscape features of the whole BBOB suite with landscape::analyze: the 24
+ * functions, on the first instances, sampled with a Sobol sequence of
+ * 1000 * dimension points.
+ *****************************************************************************/
+using namespace ioh;
+
+int main(int argc, char **argv)
+{
+    const int dimension = argc > 1 ? std::atoi(argv[1]) : 5;
+    const int instances = argc > 2 ? std::atoi(argv[2]) : 5;
+    const size_t threads = argc > 3 ? std::atoi(argv[3]) : 0;
+    const auto samples = static_cast<size_t>(1000 * dimension);
+    std::clog << "Landscape: dimension=" << dimension << ", instances=" << instances << ", samples=" << samples
+              << ", hardware threads=" << std::thread::hardware_concurrency() << std::endl;
+
+    const auto &factory = problem::ProblemRegistry<problem::BBOB>::instance();
+    const landscape::sampler::Sobol sobol(static_cast<size_t>(dimension), 1);
+    const auto start = std::chrono::steady_clock::now();
+    std::cout << "function\tinstance\tfdc\tdispersion\tnb_nn_mean_ratio" << std::endl;
+    for (const auto id : factory.ids())
+        for (auto instance = 1; instance <= instances; ++instance)
+        {
+            const auto pb = factory.create(id, instance, dimension);
+            const auto features = landscape::analyze(*pb, sobol, samples, {threads}).features;
+            std::cout << id << "\t" << instance << "\t" << features.fdc << "\t" << features.dispersion << "\t"
+                      << features.nb_nn_mean_ratio << std::endl;
+        }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::clog << "Elapsed: " << elapsed.count() << "s" << std::endl;
+}
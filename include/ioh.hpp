@@ -5,6 +5,8 @@
 #include "ioh/logger.hpp" 
 #include "ioh/problem.hpp"
 #include "ioh/suite.hpp"
+#include "ioh/landscape.hpp"
+#include "ioh/instantiations.hpp"
 
 /** @defgroup Features Features
  * Classes you may use if you want to use IOH from your solver.
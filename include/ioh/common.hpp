@@ -4,6 +4,7 @@
 #include "common/container_utils.hpp"  
 #include "common/factory.hpp"  
 #include "common/file.hpp"  
+#include "common/kernels.hpp"  
 #include "common/log.hpp"  
 #include "common/optimization_type.hpp"  
 #include "common/random.hpp"  
@@ -211,10 +211,14 @@ namespace ioh::common
     struct RegistrationInvoker
     {
         //! Forces creation of `registration_invoker`
-        static inline InvokeApplyOnConstruction<Type, Factory> registration_invoker =
-            InvokeApplyOnConstruction<Type, Factory>();
+        static InvokeApplyOnConstruction<Type, Factory> registration_invoker;
     };
 
+    //! Not inline, so that ioh::ioh_compiled can register its problems once (see ioh/instantiations.hpp)
+    template <class Type, class Factory>
+    InvokeApplyOnConstruction<Type, Factory> RegistrationInvoker<Type, Factory>::registration_invoker =
+        InvokeApplyOnConstruction<Type, Factory>();
+
     //! Helper for factory system
     template <class Type, class Factory>
     struct AutomaticTypeRegistration : RegistrationInvoker<Type, Factory>
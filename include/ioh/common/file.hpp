@@ -1,9 +1,19 @@
 #pragma once
 
+#include <fstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <fmt/format.h>
 
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define IOH_HAS_MMAP
+#endif
+
 #ifdef FSEXPERIMENTAL
 #include <experimental/filesystem>
 namespace fs = std::experimental::filesystem;
@@ -107,4 +117,90 @@ namespace ioh::common::file
         //! Construct a new Unique Folder object.
         explicit UniqueFolder() {}
     };
+
+    /**
+     * @brief A read-only view of the content of a file.
+     *
+     * The file is memory-mapped where the platform allows it,
+     * so that only the pages which are actually read are loaded.
+     * Else, it is read at once.
+     */
+    class MappedFile
+    {
+        //! Start of the content.
+        const char *data_ = nullptr;
+
+        //! Size of the content.
+        size_t size_ = 0;
+
+#ifdef IOH_HAS_MMAP
+        //! Whether data_ has been mapped.
+        bool mapped_ = false;
+#endif
+
+        //! The content, if the file could not be mapped.
+        std::string buffer_;
+
+        //! Release the mapping.
+        void unmap()
+        {
+#ifdef IOH_HAS_MMAP
+            if (mapped_)
+                munmap(const_cast<char *>(data_), size_);
+            mapped_ = false;
+#endif
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+    public:
+        /**
+         * @brief Map the given file.
+         *
+         * @param path the file to map
+         * @throws std::runtime_error if the file cannot be read
+         */
+        explicit MappedFile(const fs::path &path)
+        {
+#ifdef IOH_HAS_MMAP
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd >= 0)
+            {
+                struct stat st
+                {
+                };
+                if (::fstat(fd, &st) == 0 and st.st_size > 0)
+                {
+                    void *addr = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (addr != MAP_FAILED)
+                    {
+                        data_ = static_cast<const char *>(addr);
+                        size_ = static_cast<size_t>(st.st_size);
+                        mapped_ = true;
+                    }
+                }
+                ::close(fd);
+                if (mapped_ or st.st_size == 0)
+                    return;
+            }
+#endif
+            std::ifstream in(path, std::ios::binary);
+            if (not in)
+                throw std::runtime_error(fmt::format("Cannot read {}", path.generic_string()));
+            buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+            data_ = buffer_.data();
+            size_ = buffer_.size();
+        }
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        ~MappedFile() { unmap(); }
+
+        //! Start of the content.
+        [[nodiscard]] const char *data() const { return data_; }
+
+        //! Size of the content, in bytes.
+        [[nodiscard]] size_t size() const { return size_; }
+    };
 } // namespace ioh::common::file
@@ -0,0 +1,382 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ioh/common/file.hpp"
+#include "ioh/common/log.hpp"
+
+#ifdef IOH_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+/** Seekable gzip files.
+ *
+ * The files are sequences of gzip members (RFC 1952), so that any gzip tool can decompress them.
+ * Each member carries an extra field (subfield "IO") holding its own size and flags,
+ * so that readers can locate all the members by reading their headers only,
+ * and then decompress them independently, e.g. in parallel.
+ *
+ * Writing and reading need zlib: define IOH_HAS_ZLIB and link with it
+ * (the CMake target does it if zlib is found), else the functions throw std::runtime_error.
+ */
+namespace ioh::common::gzip
+{
+    //! Flag of a member that starts at a run boundary.
+    inline constexpr uint8_t run_start = 1;
+
+    //! Size of the header of the members: fixed fields, extra field length, "IO" subfield.
+    inline constexpr size_t header_size = 10 + 2 + 4 + 5;
+
+    //! Size of the trailer of the members: CRC32 and size of the uncompressed data.
+    inline constexpr size_t trailer_size = 8;
+
+    //! A member of a file.
+    struct Member
+    {
+        //! Offset of the member in the file.
+        size_t offset;
+        //! Size of the whole member.
+        size_t size;
+        //! Flags, e.g. gzip::run_start.
+        uint8_t flags;
+    };
+
+    namespace detail
+    {
+        //! Read a little endian integer.
+        template <class T>
+        T get_le(const unsigned char *p)
+        {
+            T v = 0;
+            for (size_t i = 0; i < sizeof(T); ++i)
+                v |= static_cast<T>(p[i]) << (8 * i);
+            return v;
+        }
+
+        //! Append a little endian integer.
+        template <class T>
+        void put_le(std::string &out, T v)
+        {
+            for (size_t i = 0; i < sizeof(T); ++i, v >>= 8)
+                out.push_back(static_cast<char>(v & 0xFF));
+        }
+
+        [[noreturn]] inline void no_zlib()
+        {
+            throw std::runtime_error("Compressed files need zlib: build with IOH_HAS_ZLIB defined.");
+        }
+    } // namespace detail
+
+    /** Compress data as a single member.
+     *
+     * @param data The data.
+     * @param size Its size.
+     * @param flags Flags of the member.
+     * @param level zlib compression level, from 1 (fastest) to 9 (smallest).
+     */
+    inline std::string compress(const char *data, const size_t size, const uint8_t flags, const int level = 1)
+    {
+#ifdef IOH_HAS_ZLIB
+        z_stream zs{};
+        if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            throw std::runtime_error("Cannot initialize zlib.");
+        std::string member(header_size + deflateBound(&zs, static_cast<uLong>(size)) + trailer_size, '\0');
+        zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+        zs.avail_in = static_cast<uInt>(size);
+        zs.next_out = reinterpret_cast<Bytef *>(member.data() + header_size);
+        zs.avail_out = static_cast<uInt>(member.size() - header_size);
+        const auto status = deflate(&zs, Z_FINISH);
+        const auto compressed = zs.total_out;
+        deflateEnd(&zs);
+        if (status != Z_STREAM_END)
+            throw std::runtime_error("Cannot compress data.");
+        member.resize(header_size + compressed);
+
+        std::string header{'\x1f', '\x8b', 8, 4, 0, 0, 0, 0, 0, '\xff'};
+        detail::put_le<uint16_t>(header, 4 + 5);
+        header += "IO";
+        detail::put_le<uint16_t>(header, 5);
+        detail::put_le<uint32_t>(header, static_cast<uint32_t>(member.size() + trailer_size));
+        header.push_back(static_cast<char>(flags));
+        std::memcpy(member.data(), header.data(), header_size);
+        detail::put_le<uint32_t>(
+            member, static_cast<uint32_t>(crc32(0, reinterpret_cast<const Bytef *>(data), static_cast<uInt>(size))));
+        detail::put_le<uint32_t>(member, static_cast<uint32_t>(size));
+        return member;
+#else
+        (void)data, (void)size, (void)flags, (void)level;
+        detail::no_zlib();
+#endif
+    }
+
+    /** Locate the members of a file written by gzip::Writer, from their headers.
+     *
+     * @throws std::runtime_error if a member is not written by gzip::Writer.
+     */
+    inline std::vector<Member> members(const char *data, const size_t size)
+    {
+        std::vector<Member> result;
+        const auto *p = reinterpret_cast<const unsigned char *>(data);
+        size_t offset = 0;
+        while (offset < size)
+        {
+            const auto *h = p + offset;
+            if (size - offset < header_size + trailer_size or h[0] != 0x1f or h[1] != 0x8b or h[3] != 4 or
+                detail::get_le<uint16_t>(h + 10) != 9 or h[12] != 'I' or h[13] != 'O')
+                throw std::runtime_error("Not a seekable gzip member.");
+            const auto member_size = detail::get_le<uint32_t>(h + 16);
+            if (member_size < header_size + trailer_size or member_size > size - offset)
+                throw std::runtime_error("Truncated gzip member.");
+            result.push_back({offset, member_size, h[20]});
+            offset += member_size;
+        }
+        return result;
+    }
+
+    //! Decompress a member.
+    inline std::string decompress(const char *data, const Member &member)
+    {
+#ifdef IOH_HAS_ZLIB
+        const auto *m = reinterpret_cast<const unsigned char *>(data + member.offset);
+        const auto *trailer = m + member.size - trailer_size;
+        std::string out(detail::get_le<uint32_t>(trailer + 4), '\0');
+        z_stream zs{};
+        if (inflateInit2(&zs, -MAX_WBITS) != Z_OK)
+            throw std::runtime_error("Cannot initialize zlib.");
+        zs.next_in = const_cast<Bytef *>(m + header_size);
+        zs.avail_in = static_cast<uInt>(member.size - header_size - trailer_size);
+        zs.next_out = reinterpret_cast<Bytef *>(out.data());
+        zs.avail_out = static_cast<uInt>(out.size());
+        const auto status = inflate(&zs, Z_FINISH);
+        inflateEnd(&zs);
+        if (status != Z_STREAM_END or
+            crc32(0, reinterpret_cast<const Bytef *>(out.data()), static_cast<uInt>(out.size())) !=
+                detail::get_le<uint32_t>(trailer))
+            throw std::runtime_error("Corrupted gzip member.");
+        return out;
+#else
+        (void)data, (void)member;
+        detail::no_zlib();
+#endif
+    }
+
+    /** Decompress a whole file written by gzip::Writer.
+     *
+     * @param file The file.
+     * @param nb_threads Number of threads decompressing the members, 1 to decompress in the calling thread.
+     */
+    inline std::string decompress(const fs::path &file, size_t nb_threads = 1)
+    {
+        const file::MappedFile content(file);
+        const auto parts = members(content.data(), content.size());
+        std::vector<std::string> texts(parts.size());
+        nb_threads = std::max<size_t>(1, std::min(nb_threads, parts.size()));
+        std::vector<std::exception_ptr> errors(nb_threads);
+        std::vector<std::thread> workers;
+        for (size_t t = 1; t < nb_threads; ++t)
+            workers.emplace_back([&, t] {
+                try
+                {
+                    for (auto i = t; i < parts.size(); i += nb_threads)
+                        texts[i] = decompress(content.data(), parts[i]);
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception();
+                }
+            });
+        try
+        {
+            for (size_t i = 0; i < parts.size(); i += nb_threads)
+                texts[i] = decompress(content.data(), parts[i]);
+        }
+        catch (...)
+        {
+            errors[0] = std::current_exception();
+        }
+        for (auto &w : workers)
+            w.join();
+        for (const auto &e : errors)
+            if (e)
+                std::rethrow_exception(e);
+
+        std::string text;
+        size_t total = 0;
+        for (const auto &t : texts)
+            total += t.size();
+        text.reserve(total);
+        for (const auto &t : texts)
+            text += t;
+        return text;
+    }
+
+    /** Writes a seekable gzip file, compressing large blocks on a background thread.
+     *
+     * The data is cut into members of about `block_size` bytes, and at each call to `cut`.
+     * At most `queue_size` blocks wait for the compression, after which `write` blocks.
+     */
+    class Writer
+    {
+        std::ofstream out_;
+        int level_;
+        size_t block_size_;
+        size_t queue_size_;
+
+        //! Data of the next member.
+        std::string block_;
+        //! Flags of the next member.
+        uint8_t flags_;
+
+        std::mutex mutex_;
+        std::condition_variable changed_;
+        //! Blocks to compress, with their flags.
+        std::deque<std::pair<std::string, uint8_t>> queue_;
+        //! True while the worker compresses a block it has popped.
+        bool busy_;
+        bool stop_;
+        std::exception_ptr error_;
+        std::thread worker_;
+
+        void work()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (true)
+            {
+                changed_.wait(lock, [this] { return stop_ or not queue_.empty(); });
+                if (queue_.empty())
+                    return;
+                auto [block, flags] = std::move(queue_.front());
+                queue_.pop_front();
+                busy_ = true;
+                changed_.notify_all();
+                lock.unlock();
+                try
+                {
+                    if (not error_)
+                    {
+                        const auto member = compress(block.data(), block.size(), flags, level_);
+                        out_.write(member.data(), static_cast<std::streamsize>(member.size()));
+                    }
+                }
+                catch (...)
+                {
+                    error_ = std::current_exception();
+                }
+                lock.lock();
+                busy_ = false;
+                changed_.notify_all();
+            }
+        }
+
+        //! Hand the current block to the worker.
+        void push()
+        {
+            if (block_.empty())
+                return;
+            std::unique_lock<std::mutex> lock(mutex_);
+            changed_.wait(lock, [this] { return queue_.size() < queue_size_; });
+            queue_.emplace_back(std::move(block_), flags_);
+            changed_.notify_all();
+            block_ = std::string();
+            block_.reserve(block_size_ + block_size_ / 8);
+            flags_ = 0;
+        }
+
+        //! Throw the error of the worker, if any.
+        void check()
+        {
+            if (error_)
+                std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+
+    public:
+        /** Open a file.
+         *
+         * @param file The file, overwritten if it exists.
+         * @param level zlib compression level, from 1 (fastest) to 9 (smallest).
+         * @param block_size Size of the uncompressed data of the members.
+         * @param queue_size Maximum number of blocks waiting for the compression.
+         */
+        explicit Writer(const fs::path &file, const int level = 1, const size_t block_size = 1 << 20,
+                        const size_t queue_size = 4) :
+            out_(file, std::ios::binary), level_(level), block_size_(block_size), queue_size_(queue_size),
+            flags_(run_start), busy_(false), stop_(false)
+        {
+#ifndef IOH_HAS_ZLIB
+            detail::no_zlib();
+#endif
+            if (not out_)
+                throw std::runtime_error("Cannot write " + file.string());
+            block_.reserve(block_size_ + block_size_ / 8);
+            worker_ = std::thread(&Writer::work, this);
+        }
+
+        Writer(const Writer &) = delete;
+        Writer &operator=(const Writer &) = delete;
+
+        //! Append data.
+        void write(const char *data, const size_t size)
+        {
+            block_.append(data, size);
+            if (block_.size() >= block_size_)
+                push();
+        }
+
+        /** End the current member.
+         *
+         * @param flags Flags of the next member, e.g. gzip::run_start if a run starts with the next written data.
+         */
+        void cut(const uint8_t flags = 0)
+        {
+            push();
+            flags_ |= flags;
+        }
+
+        //! Wait until all the data written so far is in the file.
+        void flush()
+        {
+            push();
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                changed_.wait(lock, [this] { return queue_.empty() and not busy_; });
+            }
+            out_.flush();
+            check();
+        }
+
+        //! Write the remaining data and close the file.
+        void close()
+        {
+            if (not worker_.joinable())
+                return;
+            push();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            changed_.notify_all();
+            worker_.join();
+            out_.close();
+            check();
+        }
+
+        ~Writer()
+        {
+            try
+            {
+                close();
+            }
+            catch (const std::exception &e)
+            {
+                IOH_DBG(error, "cannot compress: " << e.what())
+            }
+        }
+    };
+} // namespace ioh::common::gzip
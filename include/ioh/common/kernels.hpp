@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+
+/** Function multiversioning of the kernels compiled in the ioh::ioh_compiled library: one clone per target CPU,
+ * picked when the library is loaded. Without it, or with other compilers, the kernels are compiled for the target
+ * of the build.
+ */
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define IOH_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define IOH_TARGET_CLONES
+#endif
+
+namespace ioh::common::kernels
+{
+    namespace detail
+    {
+        //! Implementation of accumulate_columns.
+        inline void accumulate_columns(const double *columns, const double *d, double *z, const size_t n,
+                                       const size_t size)
+        {
+            for (size_t j = 0; j < n; ++j)
+                for (size_t k = 0; k < size; ++k)
+                {
+                    const auto dkj = d[k * n + j];
+                    const auto *column = columns + (j * size + k) * n;
+                    auto *zk = z + k * n;
+                    for (size_t i = 0; i < n; ++i)
+                        zk[i] += dkj * column[i];
+                }
+        }
+    } // namespace detail
+
+#ifdef IOH_EXTERN_TEMPLATES
+    /** Add the products of size n x n matrices, stacked column-major, with as many vectors: z_k += m_k d_k, with the
+     * column j of row i of matrix k at (j * size + k) * n + i. The terms of each coordinate are added in the order
+     * of j, as a row-by-row product would, so that the vectorized kernels give the same values.
+     *
+     * Compiled in ioh::ioh_compiled, for each target CPU.
+     */
+    void accumulate_columns(const double *columns, const double *d, double *z, size_t n, size_t size);
+#else
+    /** Add the products of size n x n matrices, stacked column-major, with as many vectors: z_k += m_k d_k, with the
+     * column j of row i of matrix k at (j * size + k) * n + i. The terms of each coordinate are added in the order
+     * of j, as a row-by-row product would, so that the vectorized kernels give the same values.
+     */
+    inline void accumulate_columns(const double *columns, const double *d, double *z, const size_t n,
+                                   const size_t size)
+    {
+        detail::accumulate_columns(columns, d, z, n, size);
+    }
+#endif
+} // namespace ioh::common::kernels
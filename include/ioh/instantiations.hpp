@@ -0,0 +1,162 @@
+#pragma once
+
+#include "ioh/logger.hpp"
+#include "ioh/problem.hpp"
+#include "ioh/suite.hpp"
+
+/** The specializations of the class templates that are compiled in the ioh::ioh_compiled library.
+ *
+ * The library (CMake option BUILD_COMPILED_LIBRARY) explicitly instantiates them once, in src/ioh.cpp,
+ * and defines IOH_EXTERN_TEMPLATES for its users, which then only declare them (extern template),
+ * so that each translation unit including ioh.hpp no longer compiles and optimizes their members.
+ * Inline members may still be inlined at the call sites.
+ *
+ * The concrete problems (e.g. problem::bbob::Sphere) are not templates: their CRTP bases and their
+ * registrations in the factories (common::RegistrationInvoker) are listed instead. The registrations are then
+ * only constructed in the library, so a translation unit compiles a problem only if it uses it by name.
+ * The member templates of the loggers defined in their classes (e.g. Summary::grid) are inline, which extern
+ * template does not suppress; the logger class and function templates are listed.
+ */
+#define IOH_INSTANTIATIONS(X)                                                                                          \
+    X(struct ioh::problem::Solution<double>)                                                                           \
+    X(struct ioh::problem::Solution<int>)                                                                              \
+    X(struct ioh::problem::Constraint<double>)                                                                         \
+    X(struct ioh::problem::Constraint<int>)                                                                            \
+    X(struct ioh::problem::State<double>)                                                                              \
+    X(struct ioh::problem::State<int>)                                                                                 \
+    X(class ioh::problem::Problem<double>)                                                                             \
+    X(class ioh::problem::Problem<int>)                                                                                \
+    X(class ioh::problem::WrappedProblem<double>)                                                                      \
+    X(class ioh::problem::WrappedProblem<int>)                                                                         \
+    X(class ioh::problem::Concurrent<double>)                                                                          \
+    X(class ioh::problem::Concurrent<int>)                                                                             \
+    X(class ioh::problem::Instances<double>)                                                                           \
+    X(class ioh::problem::Instances<int>)                                                                              \
+    X(class ioh::suite::Suite<ioh::problem::Real>)                                                                     \
+    X(class ioh::suite::Suite<ioh::problem::Integer>)                                                                  \
+    IOH_BBOB_INSTANTIATIONS(X)                                                                                         \
+    IOH_PBO_INSTANTIATIONS(X)                                                                                          \
+    X(class ioh::watch::Reference<double>)                                                                             \
+    X(class ioh::watch::Pointer<double>)                                                                               \
+    X(class ioh::watch::PointerReference<double>)                                                                      \
+    X(class ioh::logger::eah::Scale<double>)                                                                           \
+    X(class ioh::logger::eah::Scale<size_t>)                                                                           \
+    X(class ioh::logger::eah::LinearScale<double>)                                                                     \
+    X(class ioh::logger::eah::LinearScale<size_t>)                                                                     \
+    X(class ioh::logger::eah::Log2Scale<double>)                                                                       \
+    X(class ioh::logger::eah::Log2Scale<size_t>)                                                                       \
+    X(class ioh::logger::eah::Log10Scale<double>)                                                                      \
+    X(class ioh::logger::eah::Log10Scale<size_t>)                                                                      \
+    X(struct ioh::logger::analyzer::structures::Attribute<double>)                                                     \
+    X(struct ioh::logger::analyzer::structures::Attribute<std::string>)                                                \
+    IOH_LOGGER_INSTANTIATIONS(X)
+
+//! The statistics of the EAH and EAF loggers.
+#define IOH_LOGGER_INSTANTIATIONS(X)                                                                                   \
+    X(class ioh::logger::eah::Stat<std::vector<std::vector<size_t>>>)                                                  \
+    X(std::string ioh::logger::eah::colormap<double>(const std::vector<std::vector<double>> &,                         \
+                                                      std::pair<const ioh::logger::eah::Scale<double> *,               \
+                                                                const ioh::logger::eah::Scale<size_t> *>,              \
+                                                      bool))                                                           \
+    X(std::string ioh::logger::eah::colormap<size_t>(const std::vector<std::vector<size_t>> &,                         \
+                                                      std::pair<const ioh::logger::eah::Scale<double> *,               \
+                                                                const ioh::logger::eah::Scale<size_t> *>,              \
+                                                      bool))                                                           \
+    X(class ioh::logger::eaf::Stat<double>)                                                                            \
+    X(class ioh::logger::eaf::Stat<std::map<size_t, double>>)                                                          \
+    X(class ioh::logger::eaf::NadirStat<double>)                                                                       \
+    X(class ioh::logger::eaf::NadirStat<std::map<size_t, double>>)
+
+//! The BBOB problems: their CRTP bases, and their registrations in the BBOB and Real factories.
+#define IOH_BBOB_INSTANTIATIONS(X)                                                                                     \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, AttractiveSector)                                                    \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, BentCigar)                                                           \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, DifferentPowers)                                                     \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, Discus)                                                              \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, GriewankRosenBrock)                                                  \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, Katsuura)                                                            \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, LinearSlope)                                                         \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, LunacekBiRastrigin)                                                  \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, Schwefel)                                                            \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, SharpRidge)                                                          \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, Sphere)                                                              \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, StepEllipsoid)                                                       \
+    IOH_BBOB_PROBLEM(X, ioh::problem::BBOProblem, Weierstrass)                                                         \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::EllipsoidBase, Ellipsoid)                                                  \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::EllipsoidBase, EllipsoidRotated)                                           \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::Gallagher, Gallagher101)                                                   \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::Gallagher, Gallagher21)                                                    \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::RastriginBase, BuecheRastrigin)                                            \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::RastriginBase, Rastrigin)                                                  \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::RastriginBase, RastriginRotated)                                           \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::RosenbrockBase, Rosenbrock)                                                \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::RosenbrockBase, RosenbrockRotated)                                         \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::Schaffers, Schaffers10)                                                    \
+    IOH_BBOB_PROBLEM(X, ioh::problem::bbob::Schaffers, Schaffers1000)
+
+//! The PBO problems: their CRTP bases, and their registrations in the PBO and Integer factories.
+#define IOH_PBO_INSTANTIATIONS(X)                                                                                      \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, ConcatenatedTrap)                                                     \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, IsingRing)                                                            \
+    IOH_PBO_PROBLEM(X, ioh::problem::pbo::GraphProblem, IsingSpinGlass)                                                \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, IsingTorus)                                                           \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, IsingTriangular)                                                      \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, LABS)                                                                 \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, LeadingOnes)                                                          \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, LeadingOnesDummy1)                                                    \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, LeadingOnesDummy2)                                                    \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, LeadingOnesEpistasis)                                                 \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, LeadingOnesNeutrality)                                                \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, LeadingOnesRuggedness1)                                               \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, LeadingOnesRuggedness2)                                               \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, LeadingOnesRuggedness3)                                               \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, Linear)                                                               \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, MIS)                                                                  \
+    IOH_PBO_PROBLEM(X, ioh::problem::pbo::GraphProblem, MaxCut)                                                        \
+    IOH_PBO_PROBLEM(X, ioh::problem::pbo::GraphProblem, MaxIndependentSet)                                             \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, NKLandscapes)                                                         \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, NQueens)                                                              \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, OneMax)                                                               \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, OneMaxDummy1)                                                         \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, OneMaxDummy2)                                                         \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, OneMaxEpistasis)                                                      \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, OneMaxNeutrality)                                                     \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, OneMaxRuggedness1)                                                    \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, OneMaxRuggedness2)                                                    \
+    IOH_PBO_PROBLEM(X, ioh::problem::PBOProblem, OneMaxRuggedness3)                                                    \
+    IOH_PBO_PROBLEM(X, ioh::problem::pbo::GraphProblem, VertexCover)
+
+//! A BBOB problem.
+#define IOH_BBOB_PROBLEM(X, Base, Type)                                                                                \
+    X(class Base<ioh::problem::bbob::Type>)                                                                            \
+    IOH_REGISTRATION(X, ioh::problem::bbob::Type, ioh::problem::BBOB)                                                  \
+    IOH_REGISTRATION(X, ioh::problem::bbob::Type, ioh::problem::Real)
+
+//! A PBO problem; the graph problems also derive from PBOProblem.
+#define IOH_PBO_PROBLEM(X, Base, Type)                                                                                 \
+    X(class Base<ioh::problem::pbo::Type>)                                                                             \
+    IOH_REGISTRATION(X, ioh::problem::pbo::Type, ioh::problem::PBO)                                                    \
+    IOH_REGISTRATION(X, ioh::problem::pbo::Type, ioh::problem::Integer)
+
+//! The registration of a problem in the factory of one of its parents.
+#define IOH_REGISTRATION(X, Type, Parent)                                                                              \
+    X(struct ioh::common::RegistrationInvoker<Type, ioh::problem::ProblemRegistryType<Parent>>)
+
+//! Explicit instantiation definition, in the library.
+#define IOH_INSTANTIATE_TEMPLATE(...) template __VA_ARGS__;
+
+//! Explicit instantiation declaration, in its users.
+#define IOH_EXTERN_TEMPLATE(...) extern template __VA_ARGS__;
+
+#ifdef IOH_EXTERN_TEMPLATES
+IOH_INSTANTIATIONS(IOH_EXTERN_TEMPLATE)
+
+namespace ioh::common
+{
+    //! Defined in the library, next to the registrations of the problems.
+    bool link_registrations();
+
+    //! Refers to the library from each of its users, so that the linker keeps its registrations.
+    static const bool registrations_linked = link_registrations();
+} // namespace ioh::common
+#endif
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "landscape/sampler.hpp"
+#include "landscape/features.hpp"
+#include "landscape/enumeration.hpp"
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include "ioh/common/repr.hpp"
+#include "ioh/landscape/sampler.hpp"
+#include "ioh/problem/pbo/pbo_problem.hpp"
+
+namespace ioh::landscape
+{
+    /** Exhaustive enumeration of the 2^n solutions of a small pseudo-Boolean problem, e.g. a PBO problem with
+     * n <= 30, giving its table of objective values, its local optima and their basins of attraction.
+     *
+     * The hypercube is split into sub-cubes, by the values of its highest variables, which threads walk in
+     * Gray code order, so that each step flips a single variable. If the transformation of the variables is
+     * a permutation and a flip (as for the PBO problems), the step flips a single variable of the transformed
+     * solution, and PBO problems evaluate it with problem::PBO::evaluate_flip, which the problems supporting
+     * delta evaluation implement in O(1). Otherwise, each solution is transformed and evaluated in full.
+     * The problem is not called, so its state and logger are left unchanged.
+     *
+     * The solution x has the index sum x[i] 2^i in the tables.
+     *
+     * @tparam V type of the values in the table, float by default to halve its size
+     */
+    template <typename V = float>
+    class Enumeration
+    {
+    public:
+        //! Maximal number of variables, the table having 2^n values.
+        static constexpr size_t max_variables = 32;
+
+        //! The local optima, solutions without a strictly better neighbor, and their basins of attraction.
+        struct Basins : common::HasRepr
+        {
+            //! Indices of the local optima, in increasing order.
+            std::vector<uint32_t> optima;
+
+            //! Their values.
+            std::vector<V> values;
+
+            //! Size of their basins: the number of solutions from which a best improvement local search reaches them.
+            std::vector<size_t> sizes;
+
+            //! Index of the global optimum of the largest basin, in optima.
+            size_t global;
+
+            [[nodiscard]] std::string repr() const override
+            {
+                return fmt::format("<Basins local optima: {} global: {} (value: {} basin: {})>", optima.size(),
+                                   optima.at(global), values.at(global), sizes.at(global));
+            }
+        };
+
+    private:
+        size_t n_variables_;
+
+        common::FOptimizationType optimization_type_;
+
+        size_t nb_threads_;
+
+        //! Whether the solutions were evaluated by single flips.
+        bool delta_;
+
+        std::vector<V> values_;
+
+        /** If the transformation of the variables is x -> P x xor c, the internal variable flipped by a flip of
+         * each variable, else nothing.
+         */
+        static std::vector<int> flip_targets(problem::Problem<int> &problem, const size_t n)
+        {
+            const std::vector<int> zero(n, 0);
+            const auto c = problem.transform_variables(zero);
+            if (c.size() != n or std::any_of(c.begin(), c.end(), [](const int ci) { return ci != 0 and ci != 1; }))
+                return {};
+            std::vector<int> targets(n, -1);
+            std::vector<bool> used(n);
+            for (size_t i = 0; i < n; ++i)
+            {
+                auto e = zero;
+                e[i] = 1;
+                const auto t = problem.transform_variables(e);
+                for (size_t j = 0; j < n; ++j)
+                    if (t[j] != c[j])
+                    {
+                        if (targets[i] != -1 or used[j] or t[j] != 1 - c[j])
+                            return {};
+                        targets[i] = static_cast<int>(j);
+                        used[j] = true;
+                    }
+                if (targets[i] == -1)
+                    return {};
+            }
+            // The transformation is affine if it is on the unit vectors, which is checked on random solutions.
+            for (uint64_t s = 0; s < 16; ++s)
+            {
+                std::vector<int> x(n);
+                auto expected = c;
+                for (size_t i = 0; i < n; ++i)
+                    if ((x[i] = sampler::detail::mix(s * n + i) & 1))
+                        expected[targets[i]] = 1 - expected[targets[i]];
+                if (problem.transform_variables(x) != expected)
+                    return {};
+            }
+            return targets;
+        }
+
+        //! Evaluate the sub-cubes taken from next, whose variables from low are fixed.
+        void walk(problem::Problem<int> &problem, const std::vector<int> &targets, const size_t low,
+                  std::atomic<size_t> &next)
+        {
+            auto *pbo = delta_ ? dynamic_cast<problem::PBO *>(&problem) : nullptr;
+            const auto n = n_variables_;
+            std::vector<int> x(n), internal;
+            for (auto cube = next++; cube < (size_t{1} << (n - low)); cube = next++)
+            {
+                for (size_t i = 0; i < n; ++i)
+                    x[i] = i < low ? 0 : static_cast<int>((cube >> (i - low)) & 1);
+                auto index = cube << low;
+                internal = problem.transform_variables(x);
+                auto y = problem.evaluate(internal);
+                values_[index] = static_cast<V>(problem.transform_objectives(y));
+                for (size_t step = 1; step < (size_t{1} << low); ++step)
+                {
+                    size_t i = 0;
+                    while (((step >> i) & 1) == 0)
+                        ++i;
+                    index ^= size_t{1} << i;
+                    if (not targets.empty())
+                    {
+                        const auto j = targets[i];
+                        if (pbo != nullptr)
+                            y = pbo->evaluate_flip(internal, y, j);
+                        internal[j] = 1 - internal[j];
+                        if (pbo == nullptr)
+                            y = problem.evaluate(internal);
+                    }
+                    else
+                    {
+                        x[i] = 1 - x[i];
+                        internal = problem.transform_variables(x);
+                        y = problem.evaluate(internal);
+                    }
+                    values_[index] = static_cast<V>(problem.transform_objectives(y));
+                }
+            }
+        }
+
+        //! Run f(t) for t from 0 to nb_threads - 1 on as many threads, and rethrow their exceptions.
+        template <typename F>
+        static void run(const size_t nb_threads, const F &f)
+        {
+            std::vector<std::exception_ptr> errors(nb_threads);
+            const auto work = [&](const size_t t) {
+                try
+                {
+                    f(t);
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception();
+                }
+            };
+            std::vector<std::thread> workers;
+            for (size_t t = 1; t < nb_threads; ++t)
+                workers.emplace_back(work, t);
+            work(0);
+            for (auto &w : workers)
+                w.join();
+            for (const auto &e : errors)
+                if (e)
+                    std::rethrow_exception(e);
+        }
+
+        //! Run f(begin, end) on contiguous ranges of the indices, one per thread.
+        template <typename F>
+        void parallel(const F &f) const
+        {
+            const auto size = values_.size();
+            const auto nb_threads = std::min(nb_threads_, size);
+            run(nb_threads, [&](const size_t t) { f(size * t / nb_threads, size * (t + 1) / nb_threads); });
+        }
+
+        //! Index of the best neighbor of x strictly better than x, else x.
+        [[nodiscard]] size_t best_neighbor(const size_t x) const
+        {
+            auto best = x;
+            for (size_t i = 0; i < n_variables_; ++i)
+            {
+                const auto y = x ^ (size_t{1} << i);
+                if (optimization_type_(values_[y], values_[best]))
+                    best = y;
+            }
+            return best;
+        }
+
+    public:
+        /** Enumerate the solutions of a problem.
+         *
+         * @param problem The problem, whose variables can be 0 or 1. Its evaluation and transformations must be
+         * thread-safe, which they are for the problems of the library.
+         * @param nb_threads Number of threads, 0 for the number of hardware threads.
+         */
+        explicit Enumeration(problem::Problem<int> &problem, const size_t nb_threads = 0) :
+            n_variables_(static_cast<size_t>(problem.meta_data().n_variables)),
+            optimization_type_(problem.meta_data().optimization_type),
+            nb_threads_(std::max<size_t>(1, nb_threads != 0 ? nb_threads : std::thread::hardware_concurrency())),
+            delta_(false)
+        {
+            const auto n = n_variables_;
+            if (n == 0 or n > max_variables)
+                throw std::invalid_argument("Enumeration is limited to " + std::to_string(max_variables) +
+                                            " variables.");
+            const auto constraint = problem.constraint();
+            for (size_t i = 0; i < n; ++i)
+                if (constraint.lb.at(i) > 0 or constraint.ub.at(i) < 1)
+                    throw std::invalid_argument("Enumeration needs variables which can be 0 or 1.");
+
+            const auto targets = flip_targets(problem, n);
+            delta_ = not targets.empty() and dynamic_cast<problem::PBO *>(&problem) != nullptr;
+            values_.resize(size_t{1} << n);
+
+            // Enough sub-cubes to balance the threads.
+            size_t high = 0;
+            while (high < n and (size_t{1} << high) < 8 * nb_threads_)
+                ++high;
+            std::atomic<size_t> next{0};
+            run(std::min(nb_threads_, size_t{1} << high), [&](size_t) { walk(problem, targets, n - high, next); });
+        }
+
+        //! Index of a solution in the tables.
+        [[nodiscard]] static size_t index(const std::vector<int> &x)
+        {
+            size_t index = 0;
+            for (size_t i = 0; i < x.size(); ++i)
+                index |= static_cast<size_t>(x[i] != 0) << i;
+            return index;
+        }
+
+        //! The solution of an index.
+        [[nodiscard]] std::vector<int> solution(const size_t index) const
+        {
+            std::vector<int> x(n_variables_);
+            for (size_t i = 0; i < n_variables_; ++i)
+                x[i] = static_cast<int>((index >> i) & 1);
+            return x;
+        }
+
+        //! Number of variables.
+        [[nodiscard]] size_t n_variables() const { return n_variables_; }
+
+        //! Whether the solutions were evaluated by single flips with problem::PBO::evaluate_flip.
+        [[nodiscard]] bool delta() const { return delta_; }
+
+        //! The objective values of the solutions, with transformations, by index.
+        [[nodiscard]] const std::vector<V> &values() const { return values_; }
+
+        //! The objective value of a solution.
+        [[nodiscard]] V operator()(const std::vector<int> &x) const { return values_.at(index(x)); }
+
+        //! Indices of the local optima, the solutions without a strictly better neighbor, in increasing order.
+        [[nodiscard]] std::vector<uint32_t> local_optima() const
+        {
+            std::vector<std::vector<uint32_t>> optima(nb_threads_);
+            std::atomic<size_t> range{0};
+            parallel([&](const size_t begin, const size_t end) {
+                auto &local = optima[range++];
+                for (auto x = begin; x < end; ++x)
+                    if (best_neighbor(x) == x)
+                        local.push_back(static_cast<uint32_t>(x));
+            });
+            std::vector<uint32_t> result;
+            for (auto &local : optima)
+                result.insert(result.end(), local.begin(), local.end());
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        /** The basins of attraction of the local optima, under best improvement local search: each solution moves
+         * to its best strictly better neighbor (the first one for ties) until it reaches a local optimum.
+         *
+         * Keeps a table of 2^n indices, of 4 bytes each.
+         */
+        [[nodiscard]] Basins basins() const
+        {
+            const auto size = values_.size();
+            std::vector<uint32_t> next(size);
+            parallel([&](const size_t begin, const size_t end) {
+                for (auto x = begin; x < end; ++x)
+                    next[x] = static_cast<uint32_t>(best_neighbor(x));
+            });
+
+            // Follow the moves to the local optima, with path compression.
+            for (size_t x = 0; x < size; ++x)
+            {
+                auto optimum = next[x];
+                while (next[optimum] != optimum)
+                    optimum = next[optimum];
+                for (auto y = static_cast<uint32_t>(x); next[y] != optimum;)
+                    y = std::exchange(next[y], optimum);
+            }
+
+            Basins basins;
+            for (size_t x = 0; x < size; ++x)
+                if (next[x] == x)
+                {
+                    basins.optima.push_back(static_cast<uint32_t>(x));
+                    basins.values.push_back(values_[x]);
+                }
+            basins.sizes.resize(basins.optima.size());
+            for (size_t x = 0; x < size; ++x)
+                ++basins.sizes[static_cast<size_t>(
+                    std::lower_bound(basins.optima.begin(), basins.optima.end(), next[x]) - basins.optima.begin())];
+            basins.global = 0;
+            for (size_t k = 1; k < basins.optima.size(); ++k)
+                if (optimization_type_(basins.values[k], basins.values[basins.global]) or
+                    (basins.values[k] == basins.values[basins.global] and basins.sizes[k] > basins.sizes[basins.global]))
+                    basins.global = k;
+            return basins;
+        }
+    };
+} // namespace ioh::landscape
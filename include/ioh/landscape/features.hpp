@@ -0,0 +1,491 @@
+#pragma once
+
+#include <cmath>
+#include <exception>
+#include <thread>
+
+#include "ioh/common/repr.hpp"
+#include "ioh/landscape/sampler.hpp"
+#include "ioh/problem/concurrent.hpp"
+
+/** Landscape features computed from a sample of a problem, in one pass.
+ *
+ * The samples are evaluated by several threads, each one feeding its own accumulators,
+ * which are merged at the end.
+ */
+namespace ioh::landscape
+{
+    //! Central moments of a sequence of values, in one pass, mergeable (Pébay's formulas).
+    struct Moments
+    {
+        //! Number of values.
+        size_t n = 0;
+        //! Mean.
+        double mean = 0;
+        //! Sums of the powers of the deviations from the mean.
+        double m2 = 0, m3 = 0, m4 = 0;
+        //! Extremes.
+        double min = std::numeric_limits<double>::infinity(), max = -std::numeric_limits<double>::infinity();
+
+        //! Add a value.
+        void add(const double y)
+        {
+            const auto n1 = static_cast<double>(n++);
+            const auto nn = static_cast<double>(n);
+            const auto delta = y - mean;
+            const auto delta_n = delta / nn;
+            const auto delta_n2 = delta_n * delta_n;
+            const auto term = delta * delta_n * n1;
+            mean += delta_n;
+            m4 += term * delta_n2 * (nn * nn - 3 * nn + 3) + 6 * delta_n2 * m2 - 4 * delta_n * m3;
+            m3 += term * delta_n * (nn - 2) - 3 * delta_n * m2;
+            m2 += term;
+            min = std::min(min, y);
+            max = std::max(max, y);
+        }
+
+        //! Add the values of other moments.
+        void merge(const Moments &other)
+        {
+            if (other.n == 0)
+                return;
+            if (n == 0)
+            {
+                *this = other;
+                return;
+            }
+            const auto na = static_cast<double>(n), nb = static_cast<double>(other.n), nn = na + nb;
+            const auto delta = other.mean - mean, delta2 = delta * delta;
+            m4 += other.m4 + delta2 * delta2 * na * nb * (na * na - na * nb + nb * nb) / (nn * nn * nn) +
+                6 * delta2 * (na * na * other.m2 + nb * nb * m2) / (nn * nn) +
+                4 * delta * (na * other.m3 - nb * m3) / nn;
+            m3 += other.m3 + delta2 * delta * na * nb * (na - nb) / (nn * nn) + 3 * delta * (na * other.m2 - nb * m2) / nn;
+            m2 += other.m2 + delta2 * na * nb / nn;
+            mean += delta * nb / nn;
+            n += other.n;
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+        }
+
+        //! Sample variance.
+        [[nodiscard]] double variance() const
+        {
+            return n > 1 ? m2 / static_cast<double>(n - 1) : std::numeric_limits<double>::quiet_NaN();
+        }
+
+        //! Skewness.
+        [[nodiscard]] double skewness() const { return std::sqrt(static_cast<double>(n)) * m3 / std::pow(m2, 1.5); }
+
+        //! Excess kurtosis.
+        [[nodiscard]] double kurtosis() const { return static_cast<double>(n) * m4 / (m2 * m2) - 3; }
+    };
+
+    //! Pearson correlation of two sequences of values, in one pass, mergeable.
+    struct Correlation
+    {
+        //! Number of pairs.
+        size_t n = 0;
+        //! Means.
+        double mean_x = 0, mean_y = 0;
+        //! Sums of the squared deviations and of their products.
+        double m2_x = 0, m2_y = 0, c = 0;
+
+        //! Add a pair.
+        void add(const double x, const double y)
+        {
+            const auto nn = static_cast<double>(++n);
+            const auto dx = x - mean_x;
+            mean_x += dx / nn;
+            const auto dy = y - mean_y;
+            mean_y += dy / nn;
+            m2_x += dx * (x - mean_x);
+            m2_y += dy * (y - mean_y);
+            c += dx * (y - mean_y);
+        }
+
+        //! Add the pairs of another correlation.
+        void merge(const Correlation &other)
+        {
+            if (other.n == 0)
+                return;
+            if (n == 0)
+            {
+                *this = other;
+                return;
+            }
+            const auto na = static_cast<double>(n), nb = static_cast<double>(other.n), nn = na + nb;
+            const auto dx = other.mean_x - mean_x, dy = other.mean_y - mean_y;
+            m2_x += other.m2_x + dx * dx * na * nb / nn;
+            m2_y += other.m2_y + dy * dy * na * nb / nn;
+            c += other.c + dx * dy * na * nb / nn;
+            mean_x += dx * nb / nn;
+            mean_y += dy * nb / nn;
+            n += other.n;
+        }
+
+        //! The correlation coefficient.
+        [[nodiscard]] double operator()() const { return c / std::sqrt(m2_x * m2_y); }
+    };
+
+    /** Distance between solutions: Euclidean for real variables, Hamming for integer variables.
+     *
+     * @tparam T type of the problem
+     */
+    template <typename T>
+    double distance(const T *a, const T *b, const size_t n)
+    {
+        double d = 0;
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            for (size_t i = 0; i < n; ++i)
+                d += (a[i] - b[i]) * (a[i] - b[i]);
+            return std::sqrt(d);
+        }
+        else
+        {
+            for (size_t i = 0; i < n; ++i)
+                d += a[i] != b[i];
+            return d;
+        }
+    }
+
+    /** The features of a sample.
+     *
+     * The dispersion and the nearest-better features are computed on a uniform subsample,
+     * see Options::subsample.
+     */
+    struct Features : common::HasRepr
+    {
+        //! Number of evaluated points.
+        size_t samples = 0;
+
+        //! Moments of the objective values (with transformations).
+        Moments y{};
+
+        //! Fitness distance correlation: correlation of the values and the distances to the optimum.
+        double fdc = std::numeric_limits<double>::quiet_NaN();
+
+        /** Dispersion: ratio of the mean distance between the best points and the mean distance between
+         * all points (below 1 if the best points are clustered).
+         */
+        double dispersion = std::numeric_limits<double>::quiet_NaN();
+
+        //! Ratio of the mean distances to the nearest neighbor and to the nearest better point.
+        double nb_nn_mean_ratio = std::numeric_limits<double>::quiet_NaN();
+
+        //! Ratio of the standard deviations of the distances to the nearest neighbor and to the nearest better point.
+        double nb_nn_std_ratio = std::numeric_limits<double>::quiet_NaN();
+
+        //! Correlation of the distances to the nearest neighbor and to the nearest better point.
+        double nb_nn_correlation = std::numeric_limits<double>::quiet_NaN();
+
+        //! Correlation of the values and the number of points of which a point is the nearest better point.
+        double nb_fitness_correlation = std::numeric_limits<double>::quiet_NaN();
+
+        [[nodiscard]] std::string repr() const override
+        {
+            return fmt::format("<Features samples: {} y_mean: {} y_variance: {} y_skewness: {} y_kurtosis: {} "
+                               "fdc: {} dispersion: {} nb_nn_mean_ratio: {} nb_nn_std_ratio: {}>",
+                               samples, y.mean, y.variance(), y.skewness(), y.kurtosis(), fdc, dispersion,
+                               nb_nn_mean_ratio, nb_nn_std_ratio);
+        }
+    };
+
+    //! Options of the analysis.
+    struct Options
+    {
+        //! Number of threads evaluating the samples, 0 for the number of hardware threads.
+        size_t nb_threads = 0;
+
+        //! Size of the uniform subsample used by the dispersion and nearest-better features, which cost its square.
+        size_t subsample = 1000;
+
+        //! Fraction of the best points of the sample whose dispersion is measured (at most `subsample` points).
+        double best_fraction = 0.1;
+
+        //! Seed of the subsample.
+        uint64_t seed = 1;
+    };
+
+    /** The result of an analysis: the features, and the subsample with its nearest-better data,
+     * e.g. to cluster it (nearest-better clustering).
+     *
+     * @tparam T type of the problem
+     */
+    template <typename T>
+    struct Analysis
+    {
+        //! The features.
+        Features features;
+
+        //! Points of the subsample, in the order of their index in the sample.
+        std::vector<std::vector<T>> points;
+
+        //! Their objective values.
+        std::vector<double> y;
+
+        //! Distance to the nearest neighbor, in the subsample.
+        std::vector<double> nearest_distance;
+
+        //! Distance to the nearest better point, in the subsample, infinite for the best point.
+        std::vector<double> nearest_better_distance;
+
+        //! Index of the nearest better point, in the subsample, -1 for the best point.
+        std::vector<long> nearest_better;
+    };
+
+    namespace detail
+    {
+        //! A point of a sample.
+        template <typename T>
+        struct Point
+        {
+            //! Its key: value for the best points, hash of the index for the subsample.
+            double key;
+            size_t index;
+            std::vector<T> x;
+            double y;
+
+            bool operator<(const Point &other) const
+            {
+                return key < other.key or (key == other.key and index < other.index);
+            }
+        };
+
+        //! The k points of smallest keys, mergeable.
+        template <typename T>
+        class Smallest
+        {
+            size_t k_;
+            //! A max-heap.
+            std::vector<Point<T>> points_;
+
+        public:
+            explicit Smallest(const size_t k) : k_(k) {}
+
+            //! Whether a point with this key would be kept.
+            [[nodiscard]] bool accepts(const double key, const size_t index) const
+            {
+                return k_ > 0 and (points_.size() < k_ or Point<T>{key, index, {}, 0} < points_.front());
+            }
+
+            void add(Point<T> &&point)
+            {
+                if (not accepts(point.key, point.index))
+                    return;
+                if (points_.size() == k_)
+                {
+                    std::pop_heap(points_.begin(), points_.end());
+                    points_.pop_back();
+                }
+                points_.push_back(std::move(point));
+                std::push_heap(points_.begin(), points_.end());
+            }
+
+            void merge(Smallest &&other)
+            {
+                for (auto &p : other.points_)
+                    add(std::move(p));
+            }
+
+            //! The points, by increasing key.
+            [[nodiscard]] std::vector<Point<T>> sorted() &&
+            {
+                std::sort_heap(points_.begin(), points_.end());
+                return std::move(points_);
+            }
+        };
+
+        //! The accumulators of a thread.
+        template <typename T>
+        struct Accumulator
+        {
+            Moments y;
+            Correlation fdc;
+            Smallest<T> best;
+            Smallest<T> subsample;
+
+            Accumulator(const size_t nb_best, const size_t subsample) : best(nb_best), subsample(subsample) {}
+
+            void merge(Accumulator &&other)
+            {
+                y.merge(other.y);
+                fdc.merge(other.fdc);
+                best.merge(std::move(other.best));
+                subsample.merge(std::move(other.subsample));
+            }
+        };
+
+        //! Mean distance between the points.
+        template <typename T>
+        double mean_distance(const std::vector<Point<T>> &points)
+        {
+            double sum = 0;
+            size_t pairs = 0;
+            for (size_t i = 0; i < points.size(); ++i)
+                for (size_t j = i + 1; j < points.size(); ++j, ++pairs)
+                    sum += distance(points[i].x.data(), points[j].x.data(), points[i].x.size());
+            return sum / static_cast<double>(pairs);
+        }
+    } // namespace detail
+
+    /** Sample a problem and compute its landscape features.
+     *
+     * The samples are evaluated through problem::Concurrent, so that they count as evaluations of the
+     * problem, and are logged in order if a logger is attached.
+     *
+     * @param problem The problem, with finite bounds.
+     * @param sampler The sampler of the unit hypercube, of the dimension of the problem, scaled to the bounds
+     * (for integer variables, the strata [lb, lb + 1), ..., [ub, ub + 1) give lb, ..., ub).
+     * @param n Number of samples: the points of index 0 to n - 1 of the sampler.
+     * @param options Options of the analysis.
+     */
+    template <typename T>
+    Analysis<T> analyze(problem::Problem<T> &problem, const sampler::Sampler &sampler, const size_t n,
+                        const Options &options = {})
+    {
+        const auto meta_data = problem.meta_data();
+        const auto constraint = problem.constraint();
+        const auto dimension = static_cast<size_t>(meta_data.n_variables);
+        if (sampler.dimension() != dimension)
+            throw std::invalid_argument("The sampler and the problem have different dimensions.");
+        for (size_t j = 0; j < dimension; ++j)
+            if (not std::isfinite(static_cast<double>(constraint.lb.at(j))) or
+                not std::isfinite(static_cast<double>(constraint.ub.at(j))))
+                throw std::invalid_argument("Sampling needs finite bounds.");
+
+        const auto optimum = problem.objective().x;
+        const bool known_optimum = optimum.size() == dimension and
+            std::all_of(optimum.begin(), optimum.end(), [](const T xi) { return std::isfinite(static_cast<double>(xi)); });
+        const auto minimization = meta_data.optimization_type.type() == common::OptimizationType::Minimization;
+        const auto seed = sampler::detail::mix(options.seed);
+        const auto nb_best = std::min(
+            options.subsample, static_cast<size_t>(std::ceil(options.best_fraction * static_cast<double>(n))));
+
+        auto nb_threads = options.nb_threads != 0 ? options.nb_threads : std::thread::hardware_concurrency();
+        nb_threads = std::max<size_t>(1, std::min<size_t>(nb_threads, n));
+        std::vector<detail::Accumulator<T>> accumulators(nb_threads, {nb_best, options.subsample});
+        std::vector<std::exception_ptr> errors(nb_threads);
+
+        problem::Concurrent<T> concurrent(problem);
+        const auto work = [&](const size_t t) {
+            try
+            {
+                auto &acc = accumulators[t];
+                std::vector<double> u(dimension);
+                std::vector<T> x(dimension);
+                for (auto i = n * t / nb_threads; i < n * (t + 1) / nb_threads; ++i)
+                {
+                    sampler(i, u.data());
+                    for (size_t j = 0; j < dimension; ++j)
+                    {
+                        const auto lb = static_cast<double>(constraint.lb[j]), ub = static_cast<double>(constraint.ub[j]);
+                        if constexpr (std::is_floating_point_v<T>)
+                            x[j] = static_cast<T>(lb + u[j] * (ub - lb));
+                        else
+                            x[j] = static_cast<T>(std::min(ub, lb + std::floor(u[j] * (ub - lb + 1))));
+                    }
+                    const auto y = concurrent(x);
+                    acc.y.add(y);
+                    if (known_optimum)
+                        acc.fdc.add(distance(x.data(), optimum.data(), dimension), y);
+                    const auto key = minimization ? y : -y;
+                    if (acc.best.accepts(key, i))
+                        acc.best.add({key, i, x, y});
+                    const auto hash = sampler::detail::unit(sampler::detail::mix(seed ^ i));
+                    if (acc.subsample.accepts(hash, i))
+                        acc.subsample.add({hash, i, x, y});
+                }
+            }
+            catch (...)
+            {
+                errors[t] = std::current_exception();
+            }
+        };
+        std::vector<std::thread> workers;
+        for (size_t t = 1; t < nb_threads; ++t)
+            workers.emplace_back(work, t);
+        work(0);
+        for (auto &w : workers)
+            w.join();
+        concurrent.flush();
+        for (const auto &e : errors)
+            if (e)
+                std::rethrow_exception(e);
+
+        auto &total = accumulators.front();
+        for (size_t t = 1; t < nb_threads; ++t)
+            total.merge(std::move(accumulators[t]));
+
+        Analysis<T> analysis;
+        auto &features = analysis.features;
+        features.samples = n;
+        features.y = total.y;
+        const auto subsample = std::move(total.subsample).sorted();
+        if (known_optimum)
+            features.fdc = total.fdc();
+        else if (not subsample.empty())
+        {
+            // Without known optimum, the distances are to the best point of the subsample.
+            const auto best = std::min_element(subsample.begin(), subsample.end(), [&](const auto &a, const auto &b) {
+                return minimization ? a.y < b.y : a.y > b.y;
+            });
+            Correlation fdc;
+            for (const auto &p : subsample)
+                fdc.add(distance(p.x.data(), best->x.data(), dimension), p.y);
+            features.fdc = fdc();
+        }
+        features.dispersion = detail::mean_distance(std::move(total.best).sorted()) / detail::mean_distance(subsample);
+
+        // Nearest-better data of the subsample, in the order of the indices.
+        auto points = subsample;
+        std::sort(points.begin(), points.end(), [](const auto &a, const auto &b) { return a.index < b.index; });
+        const auto m = points.size();
+        analysis.nearest_distance.assign(m, std::numeric_limits<double>::infinity());
+        analysis.nearest_better_distance.assign(m, std::numeric_limits<double>::infinity());
+        analysis.nearest_better.assign(m, -1);
+        const auto better = [&](const size_t a, const size_t b) {
+            return minimization ? points[a].y < points[b].y : points[a].y > points[b].y;
+        };
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = 0; j < m; ++j)
+            {
+                if (i == j)
+                    continue;
+                const auto d = distance(points[i].x.data(), points[j].x.data(), dimension);
+                analysis.nearest_distance[i] = std::min(analysis.nearest_distance[i], d);
+                if (better(j, i) and d < analysis.nearest_better_distance[i])
+                {
+                    analysis.nearest_better_distance[i] = d;
+                    analysis.nearest_better[i] = static_cast<long>(j);
+                }
+            }
+
+        std::vector<size_t> indegree(m);
+        Moments nn, nb;
+        Correlation nn_nb;
+        for (size_t i = 0; i < m; ++i)
+        {
+            if (analysis.nearest_better[i] < 0)
+                continue;
+            ++indegree[static_cast<size_t>(analysis.nearest_better[i])];
+            nn.add(analysis.nearest_distance[i]);
+            nb.add(analysis.nearest_better_distance[i]);
+            nn_nb.add(analysis.nearest_distance[i], analysis.nearest_better_distance[i]);
+        }
+        Correlation fitness;
+        for (size_t i = 0; i < m; ++i)
+            fitness.add(points[i].y, static_cast<double>(indegree[i]));
+        features.nb_nn_mean_ratio = nn.mean / nb.mean;
+        features.nb_nn_std_ratio = std::sqrt(nn.variance() / nb.variance());
+        features.nb_nn_correlation = nn_nb();
+        features.nb_fitness_correlation = fitness();
+
+        for (auto &p : points)
+        {
+            analysis.points.push_back(std::move(p.x));
+            analysis.y.push_back(p.y);
+        }
+        return analysis;
+    }
+} // namespace ioh::landscape
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ioh/landscape/sobol_table.hpp"
+
+/** Samplers of the unit hypercube [0, 1)^d.
+ *
+ * The points are given by their index, and do not depend on the previous ones,
+ * so that threads can sample disjoint ranges of indices of the same sequence.
+ */
+namespace ioh::landscape::sampler
+{
+    namespace detail
+    {
+        //! The finalizer of splitmix64, a bijective hash of 64 bit integers.
+        inline uint64_t mix(uint64_t z)
+        {
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        //! A uniform number in [0, 1), from the 53 high bits of a hash.
+        inline double unit(const uint64_t h) { return static_cast<double>(h >> 11) * 0x1.0p-53; }
+
+        //! A uniform number in [0, 1), for a coordinate of a point.
+        inline double unit(const uint64_t seed, const size_t index, const size_t coordinate)
+        {
+            return unit(mix(seed ^ mix(static_cast<uint64_t>(index) * 0x9e3779b97f4a7c15ULL + coordinate)));
+        }
+    } // namespace detail
+
+    //! Interface of the samplers.
+    class Sampler
+    {
+    protected:
+        //! The dimension of the points.
+        size_t dimension_;
+
+    public:
+        //! Sample points of the given dimension.
+        explicit Sampler(const size_t dimension) : dimension_(dimension)
+        {
+            if (dimension == 0)
+                throw std::invalid_argument("The dimension of the samples must be positive.");
+        }
+
+        virtual ~Sampler() = default;
+
+        /** Compute a point.
+         *
+         * @param index Its index in the sequence.
+         * @param u Its dimension() coordinates, in [0, 1).
+         */
+        virtual void operator()(size_t index, double *u) const = 0;
+
+        //! Compute a point.
+        [[nodiscard]] std::vector<double> operator()(const size_t index) const
+        {
+            std::vector<double> u(dimension_);
+            (*this)(index, u.data());
+            return u;
+        }
+
+        //! The dimension of the points.
+        [[nodiscard]] size_t dimension() const { return dimension_; }
+    };
+
+    //! Independent uniform points.
+    class Uniform final : public Sampler
+    {
+        uint64_t seed_;
+
+    public:
+        //! Sample uniform points of the given dimension, each seed giving other points.
+        explicit Uniform(const size_t dimension, const uint64_t seed = 1) : Sampler(dimension), seed_(detail::mix(seed))
+        {
+        }
+
+        void operator()(const size_t index, double *u) const override
+        {
+            for (size_t j = 0; j < dimension_; ++j)
+                u[j] = detail::unit(seed_, index, j);
+        }
+
+        using Sampler::operator();
+    };
+
+    /** Latin hypercube sample of a given size.
+     *
+     * Each coordinate of the points covers each of the `size` strata of [0, 1) once,
+     * the point being uniform in its strata.
+     */
+    class LatinHypercube final : public Sampler
+    {
+        size_t size_;
+        uint64_t seed_;
+
+        //! The strata of the points, dimension-major.
+        std::vector<uint32_t> strata_;
+
+    public:
+        /** Sample a Latin hypercube.
+         *
+         * @param dimension Dimension of the points.
+         * @param size Number of points.
+         * @param seed Seed, each seed giving other points.
+         */
+        LatinHypercube(const size_t dimension, const size_t size, const uint64_t seed = 1) :
+            Sampler(dimension), size_(size), seed_(detail::mix(seed)), strata_(dimension * size)
+        {
+            if (size == 0 or size > std::numeric_limits<uint32_t>::max())
+                throw std::invalid_argument("Invalid size of Latin hypercube.");
+            std::mt19937_64 generator(seed_);
+            for (size_t j = 0; j < dimension; ++j)
+            {
+                const auto strata = strata_.begin() + static_cast<std::ptrdiff_t>(j * size);
+                std::iota(strata, strata + static_cast<std::ptrdiff_t>(size), 0u);
+                std::shuffle(strata, strata + static_cast<std::ptrdiff_t>(size), generator);
+            }
+        }
+
+        void operator()(const size_t index, double *u) const override
+        {
+            if (index >= size_)
+                throw std::out_of_range("The Latin hypercube has " + std::to_string(size_) + " points.");
+            for (size_t j = 0; j < dimension_; ++j)
+                u[j] = (strata_[j * size_ + index] + detail::unit(seed_, index, j)) / static_cast<double>(size_);
+        }
+
+        using Sampler::operator();
+
+        //! Number of points.
+        [[nodiscard]] size_t size() const { return size_; }
+    };
+
+    /** The Sobol low discrepancy sequence, with the direction numbers of Joe and Kuo, for up to 1024 dimensions.
+     *
+     * The points are computed from the Gray code of their index, in the order of Antonov and Saleev
+     * (as most libraries do), their first 2^k points being balanced. A non zero seed applies a random
+     * digital shift, which keeps these properties.
+     */
+    class Sobol final : public Sampler
+    {
+        static constexpr size_t bits = 32;
+
+        //! Direction numbers, bits per dimension.
+        std::vector<uint32_t> directions_;
+
+        //! Digital shift, per dimension.
+        std::vector<uint32_t> shift_;
+
+    public:
+        /** Sample the Sobol sequence.
+         *
+         * @param dimension Dimension of the points, at most 1024.
+         * @param seed Seed of the digital shift, 0 for the sequence itself.
+         */
+        explicit Sobol(const size_t dimension, const uint64_t seed = 0) :
+            Sampler(dimension), directions_(dimension * bits), shift_(dimension)
+        {
+            using Table = detail::SobolTable;
+            if (dimension > Table::max_dimension)
+                throw std::invalid_argument("The Sobol sequence is available for up to " +
+                                            std::to_string(Table::max_dimension) + " dimensions.");
+            for (size_t k = 0; k < bits; ++k)
+                directions_[k] = uint32_t{1} << (bits - 1 - k);
+
+            const auto *m = Table::initial_numbers();
+            for (size_t j = 1; j < dimension; ++j)
+            {
+                const uint32_t polynomial = Table::polynomials()[j - 1];
+                size_t degree = 0;
+                while (polynomial >> (degree + 1))
+                    ++degree;
+                auto *v = directions_.data() + j * bits;
+                for (size_t k = 0; k < std::min(degree, bits); ++k)
+                    v[k] = static_cast<uint32_t>(*m++) << (bits - 1 - k);
+                for (size_t k = degree; k < bits; ++k)
+                {
+                    v[k] = v[k - degree] ^ (v[k - degree] >> degree);
+                    for (size_t l = 1; l < degree; ++l)
+                        if ((polynomial >> (degree - l)) & 1)
+                            v[k] ^= v[k - l];
+                }
+            }
+            if (seed != 0)
+                for (size_t j = 0; j < dimension; ++j)
+                    shift_[j] = static_cast<uint32_t>(detail::mix(detail::mix(seed) + j) >> 32);
+        }
+
+        void operator()(const size_t index, double *u) const override
+        {
+            if (index >> bits)
+                throw std::out_of_range("The Sobol sequence has 2^32 points.");
+            const auto gray = index ^ (index >> 1);
+            for (size_t j = 0; j < dimension_; ++j)
+            {
+                auto x = shift_[j];
+                const auto *v = directions_.data() + j * bits;
+                for (auto g = gray, k = size_t{0}; g != 0; g >>= 1, ++k)
+                    if (g & 1)
+                        x ^= v[k];
+                u[j] = static_cast<double>(x) * 0x1.0p-32;
+            }
+        }
+
+        using Sampler::operator();
+    };
+} // namespace ioh::landscape::sampler
@@ -9,7 +9,13 @@
 #include "logger/combine.hpp"
 #include "logger/eah.hpp"
 #include "logger/eaf.hpp"
+#include "logger/summary.hpp"
+#include "logger/archive.hpp"
+#include "logger/recorder.hpp"
+#include "logger/trace.hpp"
+#include "logger/live.hpp"
 #include "logger/analyzer.hpp"
+#include "logger/analyzer_reader.hpp"
 
 /** @defgroup Loggers Loggers
  * Objects that track the calls to the objective function.
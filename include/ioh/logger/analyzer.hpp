@@ -272,12 +272,55 @@ namespace ioh::logger
                 //! Has started logging?
                 bool has_started_;
 
-                //! Current log info
-                logger::Info log_info_{};
+                /** Snapshot of the last evaluation of the run, if it was not written when it happened.
+                 *
+                 * Its evaluations are 0 if the last evaluation was written. It holds the variables only if they are
+                 * stored, and its buffers are reused from one run to the next.
+                 */
+                logger::StoredInfo log_info_{};
+
+                //! Number of evaluations at the last written line of the current run.
+                size_t last_written_ = 0;
+
+                //! Copy of the meta data of the attached problem, which problem_ points to, as the problem may be gone.
+                std::optional<problem::MetaData> attached_;
+
+                //! Keep the last evaluation of the run, handed over by the problem, if it was not written.
+                void capture()
+                {
+                    const auto *last = last_info();
+                    if (last == nullptr or last->evaluations == 0 or last->evaluations == last_written_)
+                        return;
+                    log_info_.evaluations = last->evaluations;
+                    log_info_.raw_y_best = last->raw_y_best;
+                    log_info_.transformed_y = last->transformed_y;
+                    log_info_.transformed_y_best = last->transformed_y_best;
+                    log_info_.current.y = last->current.y;
+                    if (store_positions_)
+                    {
+                        last->current.x.copy_to(log_info_.x);
+                        log_info_.current.x = log_info_.x;
+                    }
+                }
 
                 //! Evals
                 size_t evals_;
 
+                /** Run entries of the info file, not yet written.
+                 *
+                 * Written when the problem changes and when the logger is closed,
+                 * so that new runs of the same problem do not access the file system.
+                 */
+                fmt::memory_buffer info_runs_;
+
+                //! Write the buffered run entries to the info file.
+                void write_info_runs()
+                {
+                    if (info_runs_.size() > 0)
+                        info_stream_.write(info_runs_.data(), static_cast<std::streamsize>(info_runs_.size()));
+                    info_runs_.clear();
+                }
+
                 //! Gets called when a new problem is attached
                 virtual void handle_new_problem(const problem::MetaData &problem)
                 {
@@ -292,13 +335,17 @@ namespace ioh::logger
                 {
                     if (best_point_.evals != 0)
                     {
-                        info_stream_ << fmt::format(", {:d}:{:d}|{:g}", problem_->instance, best_point_.evals,
-                                                    best_point_.point.y);
+                        auto out = std::back_inserter(info_runs_);
+                        fmt::format_to(out, FMT_COMPILE(", {:d}:{:d}|{:g}"), problem_->instance, best_point_.evals,
+                                       best_point_.point.y);
                         for (auto &p : attributes_.run)
-                            info_stream_ << fmt::format(";{:g}", *p.second);
+                            fmt::format_to(out, FMT_COMPILE(";{:g}"), *p.second);
 
                         if (log_info_.evaluations != 0)
+                        {
                             FlatFile::call(log_info_);
+                            log_info_.evaluations = 0;
+                        }
                     }
                 }
 
@@ -330,7 +377,10 @@ namespace ioh::logger
                 void update_info_file(const problem::MetaData &problem, const std::string &dat_path)
                 {
                     if (problem_ != nullptr)
+                    {
                         handle_last_eval();
+                        write_info_runs();
+                    }
 
                     if (problem_ == nullptr || problem_->problem_id != problem.problem_id)
                         handle_new_problem(problem);
@@ -373,12 +423,15 @@ namespace ioh::logger
                     path_(root, folder_name), algorithm_(algorithm_name, algorithm_info), best_point_{},
                     attributes_(attributes), has_started_(false)
                 {
+                    flush_runs_ = false; // The info file is not up to date between the runs either.
                 }
 
                  //! close data file
                 virtual void close() override {
                     if (info_stream_.is_open()){
+                        capture();
                         handle_last_eval();
+                        write_info_runs();
                         IOH_DBG(debug, "close info file")
                         info_stream_.close();
                     }
@@ -392,25 +445,41 @@ namespace ioh::logger
                     close();
                 }
 
-                //! Part of public interface. Updates info file.
+                /** Part of public interface. Updates info file.
+                 *
+                 * A new run of the same problem keeps the files open, and only buffers the entry of the previous run.
+                 */
                 virtual void attach_problem(const problem::MetaData &problem) override
                 {
-                    const auto dat_directory = fmt::format("data_f{:d}_{}", problem.problem_id, problem.name);
-                    const auto dat_filename =
-                        fmt::format("IOHprofiler_f{:d}_DIM{:d}.dat", problem.problem_id, problem.n_variables);
+                    capture();
+                    if (problem_ != nullptr and *problem_ == problem and (out_.is_open() or gz_))
+                        handle_last_eval();
+                    else
+                    {
+                        const auto dat_directory = fmt::format("data_f{:d}_{}", problem.problem_id, problem.name);
+                        const auto dat_filename =
+                            fmt::format("IOHprofiler_f{:d}_DIM{:d}.dat", problem.problem_id, problem.n_variables);
 
-                    update_info_file(problem, fmt::format("{}/{}", dat_directory, dat_filename));
-                    open_stream(dat_filename, path_ / dat_directory);
-                    FlatFile::attach_problem(problem);
-                    best_point_ = {0, {std::vector<double>(problem.n_variables), problem.initial_objective_value}};
+                        update_info_file(problem, fmt::format("{}/{}{}", dat_directory, dat_filename, file_suffix()));
+                        open_stream(dat_filename, path_ / dat_directory);
+                        attached_ = problem;
+                    }
+                    FlatFile::attach_problem(*attached_);
+                    best_point_.evals = 0;
+                    best_point_.point.x.assign(problem.n_variables, 0.);
+                    best_point_.point.y = problem.initial_objective_value;
                     has_started_ = true;
                 }
 
-                //! Set log_info_ in order to check if the last line has been logged
-                virtual void log(const logger::Info &log_info) override
+                /** Start a new run.
+                 *
+                 * The last evaluation of the previous run is written on the next call to attach_problem, or on close.
+                 */
+                virtual void reset() override
                 {
-                    log_info_ = log_info;
-                    FlatFile::log(log_info);
+                    capture();
+                    last_written_ = 0;
+                    FlatFile::reset();
                 }
 
                 //! See: logger::FlatFile::call. Updates `best_point_`
@@ -419,8 +488,12 @@ namespace ioh::logger
                     evals_ = log_info.evaluations;
                     FlatFile::call(log_info);
                     if (problem_->optimization_type(log_info.current.y, best_point_.point.y))
-                        best_point_ = {log_info.evaluations, log_info.current.as_double()};
-                    log_info_ = {};
+                    {
+                        best_point_.evals = log_info.evaluations;
+                        best_point_.point.x.assign(log_info.current.x.begin(), log_info.current.x.end());
+                        best_point_.point.y = log_info.current.y;
+                    }
+                    last_written_ = log_info.evaluations;
                 }
 
                 //! Watcher::watch is protected, so it can only be called before track_problem is called for the first
@@ -533,7 +606,10 @@ namespace ioh::logger
                                 static_cast<size_t>(problem_->instance), evals_, best_point_,
                                 common::as_vector<std::string, double, structures::Attribute<double>>(attributes_.run));
                         if (log_info_.evaluations != 0)
+                        {
                             FlatFile::call(log_info_);
+                            log_info_.evaluations = 0;
+                        }
                     }
                 }
 
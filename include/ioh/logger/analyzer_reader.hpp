@@ -0,0 +1,642 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <sstream>
+#include <thread>
+
+#include "ioh/common/file.hpp"
+#include "ioh/common/gzip.hpp"
+#include "ioh/logger/analyzer.hpp"
+
+namespace ioh::logger::analyzer::v1
+{
+    /** Fast parsing of the text files written by analyzer::v1::Analyzer.
+     *
+     * The parsers work on the raw bytes of memory-mapped files (see common::file::MappedFile),
+     * and never build an intermediate string per line or per value.
+     */
+    namespace parse
+    {
+        //! A [first,last) range of characters in a buffer.
+        struct Span
+        {
+            //! First character.
+            const char *first;
+            //! Past the last character.
+            const char *last;
+
+            //! Number of characters.
+            [[nodiscard]] size_t size() const { return static_cast<size_t>(last - first); }
+
+            //! True if there is no character.
+            [[nodiscard]] bool empty() const { return first == last; }
+
+            //! Copy as a string.
+            [[nodiscard]] std::string str() const { return {first, last}; }
+
+            //! Compare with a literal.
+            [[nodiscard]] bool operator==(const std::string_view s) const
+            {
+                return std::string_view(first, size()) == s;
+            }
+        };
+
+        //! Split the next line out of `[cursor,last)`, without its end of line (LF or CRLF), and move the cursor.
+        inline Span next_line(const char *&cursor, const char *last)
+        {
+            const auto *first = cursor;
+            const auto *eol = static_cast<const char *>(std::memchr(first, '\n', static_cast<size_t>(last - first)));
+            cursor = eol ? eol + 1 : last;
+            const auto *end = eol ? eol : last;
+            if (end != first and *(end - 1) == '\r')
+                --end;
+            return {first, end};
+        }
+
+        /** Parse a floating point number in `[first,last)`.
+         *
+         * `None` (written by the Analyzer for missing values) and `nan` give NaN, `inf` and `-inf` are accepted.
+         *
+         * @throws std::runtime_error if the whole range is not a number.
+         */
+        inline double number(const char *first, const char *last)
+        {
+            if (std::string_view(first, static_cast<size_t>(last - first)) == "None")
+                return std::numeric_limits<double>::quiet_NaN();
+            double value = 0;
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+            const auto [end, err] = std::from_chars(first, last, value);
+            if (err == std::errc() and end == last)
+                return value;
+#else
+            // std::strtod needs a null-terminated string, numbers are short enough for the small string buffer.
+            const std::string token(first, last);
+            char *end = nullptr;
+            errno = 0;
+            value = std::strtod(token.c_str(), &end);
+            if (errno == 0 and end == token.c_str() + token.size() and not token.empty())
+                return value;
+#endif
+            throw std::runtime_error(fmt::format("Not a number: \"{}\"", std::string(first, last)));
+        }
+
+        //! Parse a non-negative integer in `[first,last)`.
+        inline size_t integer(const char *first, const char *last)
+        {
+            size_t value = 0;
+            const auto [end, err] = std::from_chars(first, last, value);
+            if (err != std::errc() or end != last)
+                throw std::runtime_error(fmt::format("Not an integer: \"{}\"", std::string(first, last)));
+            return value;
+        }
+
+        /** Split the quoted column titles of a header line of a .dat file.
+         *
+         * The titles are separated by single spaces and may themselves contain spaces, e.g.:
+         * `"function evaluation" "current f(x)" x0`.
+         */
+        inline std::vector<std::string> titles(const Span line)
+        {
+            std::vector<std::string> names;
+            const auto *c = line.first;
+            while (c != line.last)
+            {
+                if (*c == ' ')
+                {
+                    ++c;
+                    continue;
+                }
+                if (*c == '"')
+                {
+                    const auto *close = std::find(c + 1, line.last, '"');
+                    if (close == line.last)
+                        throw std::runtime_error("Unterminated column title: " + line.str());
+                    names.emplace_back(c + 1, close);
+                    c = close + 1;
+                }
+                else
+                {
+                    const auto *end = std::find(c, line.last, ' ');
+                    names.emplace_back(c, end);
+                    c = end;
+                }
+            }
+            return names;
+        }
+
+        /** Parse the `key = "value", key = value, ...` header line of a block of an .info file.
+         *
+         * Quoted values may contain commas.
+         */
+        inline std::vector<std::pair<std::string, std::string>> attributes(const Span line)
+        {
+            std::vector<std::pair<std::string, std::string>> attrs;
+            const auto *c = line.first;
+            while (c != line.last)
+            {
+                while (c != line.last and (*c == ' ' or *c == ','))
+                    ++c;
+                if (c == line.last)
+                    break;
+                const auto *eq = std::find(c, line.last, '=');
+                if (eq == line.last)
+                    throw std::runtime_error("Missing '=' in info header: " + line.str());
+                auto key = Span{c, eq};
+                while (not key.empty() and *(key.last - 1) == ' ')
+                    --key.last;
+                c = eq + 1;
+                while (c != line.last and *c == ' ')
+                    ++c;
+                Span value{c, c};
+                if (c != line.last and *c == '"')
+                {
+                    const auto *close = std::find(c + 1, line.last, '"');
+                    if (close == line.last)
+                        throw std::runtime_error("Unterminated value in info header: " + line.str());
+                    value = {c + 1, close};
+                    c = close + 1;
+                }
+                else
+                {
+                    value.last = std::find(c, line.last, ',');
+                    c = value.last;
+                }
+                attrs.emplace_back(key.str(), value.str());
+            }
+            return attrs;
+        }
+    } // namespace parse
+
+    /** Columnar view of the content of a .dat file.
+     *
+     * Each column holds one value per logged line, the lines of all the runs being concatenated.
+     * The lines of the i-th run are in `[run_starts[i], run_starts[i+1])`.
+     * Missing values (`None`) are NaN.
+     */
+    struct Table
+    {
+        //! Unquoted column titles, e.g. "function evaluation", "best af(x)+b", "x0".
+        std::vector<std::string> names;
+
+        //! One vector of values per column.
+        std::vector<std::vector<double>> columns;
+
+        //! Index of the first line of each run, followed by the total number of lines.
+        std::vector<size_t> run_starts{0};
+
+        //! Total number of lines.
+        [[nodiscard]] size_t size() const { return run_starts.back(); }
+
+        //! Number of runs.
+        [[nodiscard]] size_t nb_runs() const { return run_starts.size() - 1; }
+
+        //! Index of the column with the given title, or names.size() if there is none.
+        [[nodiscard]] size_t index(const std::string &name) const
+        {
+            return static_cast<size_t>(std::find(names.begin(), names.end(), name) - names.begin());
+        }
+
+        //! Values of the column with the given title.
+        [[nodiscard]] const std::vector<double> &column(const std::string &name) const
+        {
+            const auto i = index(name);
+            if (i == names.size())
+                throw std::out_of_range("No column named \"" + name + "\"");
+            return columns[i];
+        }
+
+        /** Parse a whole .dat file, or a .dat.gz file written by an Analyzer with compressed output.
+         *
+         * A run starts with each header line (the Analyzer repeats it for every run),
+         * all the runs of a file must have the same columns.
+         *
+         * @throws std::runtime_error if the file cannot be read or is malformed.
+         */
+        static Table read(const fs::path &file)
+        {
+            if (file.extension() == ".gz")
+            {
+                const auto text = common::gzip::decompress(file);
+                return parse(text.data(), text.size(), file);
+            }
+            const common::file::MappedFile content(file);
+            return parse(content.data(), content.size(), file);
+        }
+
+        //! Parse the content of a .dat file.
+        static Table parse(const char *data, const size_t size, const fs::path &file)
+        {
+            Table table;
+            const auto *cursor = data;
+            const auto *last = cursor + size;
+            size_t line_number = 0;
+            size_t rows = 0;
+            while (cursor != last)
+            {
+                const auto line = parse::next_line(cursor, last);
+                ++line_number;
+                if (line.empty())
+                    continue;
+
+                if (*line.first == '"')
+                {
+                    auto names = parse::titles(line);
+                    if (table.names.empty())
+                    {
+                        table.names = std::move(names);
+                        table.columns.resize(table.names.size());
+                        // Most lines are about the same length, this avoids most reallocations.
+                        const auto estimate = size / (line.size() + 1);
+                        for (auto &col : table.columns)
+                            col.reserve(estimate);
+                    }
+                    else if (names != table.names)
+                        throw std::runtime_error(fmt::format("{}:{}: columns differ from the first run's ones",
+                                                             file.string(), line_number));
+                    if (rows != table.run_starts.back())
+                        table.run_starts.push_back(rows);
+                    continue;
+                }
+
+                if (table.names.empty())
+                    throw std::runtime_error(fmt::format("{}:{}: values before any header", file.string(),
+                                                         line_number));
+                size_t col = 0;
+                const auto *c = line.first;
+                while (c != line.last)
+                {
+                    const auto *end = std::find(c, line.last, ' ');
+                    if (end != c)
+                    {
+                        if (col == table.columns.size())
+                            break;
+                        table.columns[col++].push_back(parse::number(c, end));
+                    }
+                    c = end == line.last ? end : end + 1;
+                }
+                if (col != table.columns.size() or c != line.last)
+                    throw std::runtime_error(fmt::format("{}:{}: expected {} values", file.string(), line_number,
+                                                         table.columns.size()));
+                ++rows;
+            }
+            if (rows != table.run_starts.back())
+                table.run_starts.push_back(rows);
+            return table;
+        }
+    };
+
+    /** Read back the data of an analyzer::v1::Analyzer.
+     *
+     * The reader parses every .info file below a root directory at construction,
+     * the .dat files (which hold most of the data) are parsed on demand, possibly in parallel.
+     *
+     * The runs can then be browsed as a columnar Table per .dat file,
+     * or replayed through any Logger, e.g. to compute an EAF, an EAH or to fill a Store
+     * from data that was logged on disk:
+     * @code
+        logger::analyzer::v1::Reader reader("ioh_data");
+        logger::EAF eaf;
+        reader.replay(eaf);
+     * @endcode
+     *
+     * @note Only the v1 .info format is read; the v2 logger writes JSON files instead.
+     *
+     * @ingroup Logging
+     */
+    class Reader
+    {
+    public:
+        //! Where the lines of a run are in the tables.
+        struct Location
+        {
+            //! Index of the .dat file in data_files().
+            size_t file;
+            //! Index of the run in the Table of that file.
+            size_t run;
+        };
+
+    protected:
+        //! Directory that was scanned.
+        fs::path root_;
+
+        //! One experiment per .info file, holding one scenario per block of that file.
+        std::vector<structures::ExperimentInfo> experiments_;
+
+        //! The distinct .dat files, in order of first appearance.
+        std::vector<fs::path> data_files_;
+
+        //! Location of each run, indexed as experiments_[e].dims[s].runs[r].
+        std::vector<std::vector<std::vector<Location>>> locations_;
+
+        //! The problems attached by replay, which the loggers refer to.
+        mutable std::deque<problem::MetaData> problems_;
+
+        //! Parse one .info file.
+        static structures::ExperimentInfo read_info(const fs::path &file)
+        {
+            const common::file::MappedFile content(file);
+            const auto *cursor = content.data();
+            const auto *last = cursor + content.size();
+
+            std::optional<structures::ExperimentInfo> experiment;
+            std::vector<std::string> run_attribute_names;
+            while (cursor != last)
+            {
+                const auto header = parse::next_line(cursor, last);
+                if (header.empty())
+                    continue;
+                const auto separator = parse::next_line(cursor, last);
+                const auto data = parse::next_line(cursor, last);
+                if (not(separator == "%") or data.empty())
+                    throw std::runtime_error(file.string() + ": malformed block: " + header.str());
+
+                std::string suite, name, alg_name, alg_info;
+                int id = 0, dim = 0;
+                bool maximization = false;
+                std::vector<structures::Attribute<std::string>> extra;
+                run_attribute_names.clear();
+                for (const auto &[key, value] : parse::attributes(header))
+                {
+                    if (key == "suite")
+                        suite = value;
+                    else if (key == "funcId")
+                        id = std::stoi(value);
+                    else if (key == "funcName")
+                        name = value;
+                    else if (key == "DIM")
+                        dim = std::stoi(value);
+                    else if (key == "maximization")
+                        maximization = value == "T";
+                    else if (key == "algId")
+                        alg_name = value;
+                    else if (key == "algInfo")
+                        alg_info = value;
+                    else if (key == "dynamicAttribute")
+                    {
+                        std::stringstream names(value);
+                        for (std::string n; std::getline(names, n, '|');)
+                            run_attribute_names.push_back(n);
+                    }
+                    else
+                        extra.emplace_back(key, value);
+                }
+
+                // The data line: "path, instance:evals|best[;attribute...], ..."
+                const auto *c = data.first;
+                const auto *comma = std::find(c, data.last, ',');
+                structures::ScenarioInfo scenario(static_cast<size_t>(dim), std::string(c, comma));
+                c = comma;
+                while (c != data.last)
+                {
+                    c += 2; // ", "
+                    comma = std::find(c, data.last, ',');
+                    const auto *colon = std::find(c, comma, ':');
+                    const auto *bar = std::find(colon, comma, '|');
+                    const auto *semi = std::find(bar, comma, ';');
+                    if (colon == comma or bar == comma)
+                        throw std::runtime_error(file.string() + ": malformed run: " + std::string(c, comma));
+                    const auto evals = parse::integer(colon + 1, bar);
+                    const auto best = parse::number(bar + 1, semi);
+                    std::vector<structures::Attribute<double>> attrs;
+                    for (const auto &attr_name : run_attribute_names)
+                    {
+                        if (semi == comma)
+                            throw std::runtime_error(file.string() + ": missing run attribute " + attr_name);
+                        const auto *next = std::find(semi + 1, comma, ';');
+                        attrs.emplace_back(attr_name, parse::number(semi + 1, next));
+                        semi = next;
+                    }
+                    scenario.runs.emplace_back(parse::integer(c, colon), evals,
+                                               structures::BestPoint(evals, {{}, best}),
+                                               attrs);
+                    c = comma;
+                }
+
+                if (not experiment)
+                {
+                    const auto type =
+                        maximization ? common::OptimizationType::Maximization : common::OptimizationType::Minimization;
+                    experiment.emplace(suite, problem::MetaData(id, 0, name, dim, type),
+                                       structures::AlgorithmInfo(alg_name, alg_info), extra, run_attribute_names);
+                }
+                else if (experiment->problem.problem_id != id)
+                    throw std::runtime_error(file.string() + ": blocks for different problems");
+                experiment->dims.push_back(scenario);
+            }
+            if (not experiment)
+                throw std::runtime_error(file.string() + ": no data");
+            return *experiment;
+        }
+
+    public:
+        /** Parse all the .info files below a directory (usually an Analyzer's output_directory()).
+         *
+         * @throws std::runtime_error if a file is malformed or a .dat file is missing.
+         */
+        explicit Reader(const fs::path &root) : root_(root)
+        {
+            std::vector<fs::path> infos;
+            for (const auto &entry : fs::recursive_directory_iterator(root))
+                if (entry.is_regular_file() and entry.path().extension() == ".info")
+                    infos.push_back(entry.path());
+            std::sort(infos.begin(), infos.end());
+
+            std::vector<size_t> referenced;
+            for (const auto &info : infos)
+            {
+                experiments_.push_back(read_info(info));
+                auto &locations = locations_.emplace_back();
+                for (const auto &scenario : experiments_.back().dims)
+                {
+                    const auto dat = info.parent_path() / scenario.data_file;
+                    if (not fs::exists(dat))
+                        throw std::runtime_error(fmt::format("{}: missing data file {}", info.string(), dat.string()));
+                    auto f = static_cast<size_t>(std::find(data_files_.begin(), data_files_.end(), dat) -
+                                                 data_files_.begin());
+                    if (f == data_files_.size())
+                    {
+                        data_files_.push_back(dat);
+                        referenced.push_back(0);
+                    }
+                    auto &runs = locations.emplace_back();
+                    for (size_t r = 0; r < scenario.runs.size(); ++r)
+                        runs.push_back({f, referenced[f]++});
+                }
+            }
+        }
+
+        //! The directory that was scanned.
+        [[nodiscard]] const fs::path &root() const { return root_; }
+
+        //! One experiment per .info file, with one scenario per block (i.e. per dimension) of the file.
+        [[nodiscard]] const std::vector<structures::ExperimentInfo> &experiments() const { return experiments_; }
+
+        //! The .dat files referenced by the .info files.
+        [[nodiscard]] const std::vector<fs::path> &data_files() const { return data_files_; }
+
+        //! Where the lines of the r-th run of the s-th scenario of the e-th experiment are.
+        [[nodiscard]] Location location(const size_t e, const size_t s, const size_t r) const
+        {
+            return locations_.at(e).at(s).at(r);
+        }
+
+        //! Parse the i-th data file.
+        [[nodiscard]] Table table(const size_t i) const { return Table::read(data_files_.at(i)); }
+
+        /** Parse all the data files, one per thread.
+         *
+         * @param nb_threads Number of threads, the number of hardware threads if zero.
+         * @returns one Table per data file, in the order of data_files().
+         */
+        [[nodiscard]] std::vector<Table> tables(size_t nb_threads = 0) const
+        {
+            std::vector<Table> result(data_files_.size());
+            if (nb_threads == 0)
+                nb_threads = std::max(1u, std::thread::hardware_concurrency());
+            nb_threads = std::min(nb_threads, data_files_.size());
+
+            std::atomic<size_t> next{0};
+            std::vector<std::exception_ptr> errors(nb_threads);
+            const auto work = [&](const size_t t) {
+                try
+                {
+                    for (auto i = next++; i < data_files_.size(); i = next++)
+                        result[i] = table(i);
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception();
+                    next = data_files_.size();
+                }
+            };
+            if (nb_threads <= 1)
+                work(0);
+            else
+            {
+                std::vector<std::thread> workers;
+                for (size_t t = 0; t < nb_threads; ++t)
+                    workers.emplace_back(work, t);
+                for (auto &w : workers)
+                    w.join();
+            }
+            for (const auto &e : errors)
+                if (e)
+                    std::rethrow_exception(e);
+            return result;
+        }
+
+        /** Feed all the runs to a logger, as if the problems were solved again.
+         *
+         * For each run, the logger is attached to the problem, logged with every line of the run, and reset.
+         * The logger's triggers still apply, but only the logged lines can be replayed:
+         * use (a subset of) the triggers that wrote the data.
+         *
+         * Only the columns of the default properties of the Analyzer
+         * (and the solution's variables, if positions were stored) fill the logger::Info,
+         * other columns are only available through the tables.
+         *
+         * The data files are parsed in parallel, the logger is fed sequentially.
+         * The meta data of the attached problems are kept by the reader, which must outlive the logger's
+         * use of them (e.g. until it is closed).
+         *
+         * @note If a .dat file holds more runs than its .info file references
+         *       (the Analyzer overwrites the .info file of a problem that comes back after another one),
+         *       the last runs of the .dat file are used.
+         */
+        void replay(Logger &logger, const size_t nb_threads = 0) const
+        {
+            const auto data = tables(nb_threads);
+
+            // Columns, if any, of each field of the logger::Info.
+            struct Columns
+            {
+                const std::vector<double> *evals, *y, *y_best, *t_y, *t_y_best;
+                std::vector<const std::vector<double> *> x;
+            };
+            std::vector<Columns> columns;
+            std::vector<size_t> skip;
+            for (size_t f = 0; f < data.size(); ++f)
+            {
+                const auto &t = data[f];
+                const auto get = [&t](const std::string &name) {
+                    const auto i = t.index(name);
+                    return i == t.names.size() ? nullptr : &t.columns[i];
+                };
+                auto &cols = columns.emplace_back(Columns{get("function evaluation"), get("current f(x)"),
+                                                          get("best-so-far f(x)"), get("current af(x)+b"),
+                                                          get("best af(x)+b"), {}});
+                if (not cols.evals)
+                    throw std::runtime_error(data_files_[f].string() + ": no \"function evaluation\" column");
+                for (auto x = get("x0"); x; x = get("x" + std::to_string(cols.x.size())))
+                    cols.x.push_back(x);
+                skip.push_back(0);
+            }
+            for (const auto &locations : locations_)
+                for (const auto &runs : locations)
+                    for (const auto &loc : runs)
+                        skip[loc.file] = std::max(skip[loc.file], loc.run + 1);
+            for (size_t f = 0; f < data.size(); ++f)
+            {
+                if (data[f].nb_runs() < skip[f])
+                    throw std::runtime_error(fmt::format("{}: {} runs referenced, {} found", data_files_[f].string(),
+                                                         skip[f], data[f].nb_runs()));
+                skip[f] = data[f].nb_runs() - skip[f];
+            }
+
+            const auto value = [](const std::vector<double> *col, const size_t i) {
+                return col ? (*col)[i] : std::numeric_limits<double>::quiet_NaN();
+            };
+            std::string suite;
+            logger::StoredInfo info{};
+            for (size_t e = 0; e < experiments_.size(); ++e)
+            {
+                const auto &experiment = experiments_[e];
+                if (e == 0 or experiment.suite != suite)
+                {
+                    suite = experiment.suite;
+                    logger.attach_suite(suite);
+                }
+                for (size_t s = 0; s < experiment.dims.size(); ++s)
+                {
+                    const auto &scenario = experiment.dims[s];
+                    const auto dim = static_cast<int>(scenario.dimension);
+                    for (size_t r = 0; r < scenario.runs.size(); ++r)
+                    {
+                        const auto [f, run] = locations_[e][s][r];
+                        const auto &cols = columns[f];
+                        const problem::MetaData meta(experiment.problem.problem_id,
+                                                     static_cast<int>(scenario.runs[r].instance),
+                                                     experiment.problem.name, dim,
+                                                     experiment.problem.optimization_type.type());
+                        // Consecutive runs of a problem share its meta data, as they would share the problem.
+                        if (problems_.empty() or not(problems_.back() == meta))
+                            problems_.push_back(meta);
+                        info.optimum = problem::Solution<double>(dim, meta.optimization_type.type());
+                        info.resize(cols.x.size());
+                        logger.attach_problem(problems_.back());
+                        for (auto i = data[f].run_starts[skip[f] + run]; i < data[f].run_starts[skip[f] + run + 1];
+                             ++i)
+                        {
+                            info.evaluations = static_cast<size_t>((*cols.evals)[i]);
+                            info.current.y = value(cols.y, i);
+                            info.raw_y_best = value(cols.y_best, i);
+                            info.transformed_y = value(cols.t_y, i);
+                            info.transformed_y_best = value(cols.t_y_best, i);
+                            for (size_t k = 0; k < cols.x.size(); ++k)
+                                info.x[k] = (*cols.x[k])[i];
+                            logger.log(info);
+                        }
+                        logger.reset();
+                    }
+                }
+            }
+        }
+    };
+} // namespace ioh::logger::analyzer::v1
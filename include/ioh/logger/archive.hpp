@@ -0,0 +1,735 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ioh/common/file.hpp"
+#include "eaf.hpp"
+#include "eah.hpp"
+#include "store.hpp"
+
+namespace ioh::logger
+{
+    /** Binary archives of the data of the in-memory loggers (logger::EAF, logger::EAH and logger::Store).
+     *
+     * Archives allow to persist the data of a campaign, or to move it between processes,
+     * and to compute statistics on the runs of several processes, once merged in a single logger:
+     * @code
+        logger::EAF eaf;
+        for(const auto& file : files) {
+            logger::archive::load(file, eaf);
+        }
+        auto levels = logger::eaf::levels(eaf.optimization_type(), eaf);
+     * @endcode
+     *
+     * Layout (numbers are in the byte order of the writing machine, which is checked when reading):
+     * - header: magic string (8 bytes), byte order mark (u32), format version (u16), kind (u8), reserved (u8),
+     * - meta data: size (u32), then the kind-specific meta data
+     *   (EAF: the optimization type, EAH: kind (u8), min, max and size of both scales, Store: nothing),
+     * - index: number of entries (u64), then for each run:
+     *   suite name (u32 size and bytes), problem, dimension, instance (i32), run (u64),
+     *   offset (from the start of the payload) and size of its data (u64),
+     * - payload: the data of each run, in the kind-specific encoding
+     *   (EAF: the points of the front, EAH: the bits of the attainment matrix,
+     *    Store: the names of the properties, then the values at each evaluation).
+     *
+     * Reading maps the file and only decodes the index, runs being decoded when they are accessed (see archive::Reader).
+     *
+     * @ingroup Logging
+     */
+    namespace archive
+    {
+        //! Which logger's data is in an archive.
+        enum class Kind : uint8_t
+        {
+            EAF = 1,
+            EAH = 2,
+            Store = 3
+        };
+
+        /** Version of the format written by this library.
+         *
+         * Version 1 did not store the kind of the scales of the EAH archives.
+         */
+        inline constexpr uint16_t version = 2;
+
+        //! First bytes of an archive.
+        inline constexpr char magic[8] = {'I', 'O', 'H', 'A', 'R', 'C', 'H', '\0'};
+
+        //! Written as is, so as to detect archives written with another byte order.
+        inline constexpr uint32_t byte_order_mark = 0x01020304;
+
+        //! Where a run is in the data structures of the loggers.
+        struct Key
+        {
+            //! Suite name (empty for logger::EAH, which does not track suites).
+            std::string suite;
+            //! Problem id.
+            int problem;
+            //! Dimension.
+            int dimension;
+            //! Instance.
+            int instance;
+            //! Run id.
+            size_t run;
+        };
+
+        //! A run in an archive.
+        struct Entry
+        {
+            //! Where the run was.
+            Key key;
+            //! Offset of its data, from the start of the payload.
+            uint64_t offset;
+            //! Size of its data.
+            uint64_t size;
+        };
+
+        //! Kind of a scale of logger::EAH.
+        enum class ScaleKind : uint8_t
+        {
+            Unknown = 0, //!< A user-defined scale, or a scale of a version 1 archive.
+            Linear = 1,
+            Log2 = 2,
+            Log10 = 3
+        };
+
+        //! Kind and domain of a scale of logger::EAH.
+        struct ScaleDomain
+        {
+            //! Kind.
+            ScaleKind kind;
+            //! Minimum.
+            double min;
+            //! Maximum.
+            double max;
+            //! Number of buckets.
+            uint64_t size;
+
+            //! Kind of a scale.
+            template <class R>
+            [[nodiscard]] static ScaleKind kind_of(const eah::Scale<R> &scale)
+            {
+                if (dynamic_cast<const eah::LinearScale<R> *>(&scale) != nullptr)
+                    return ScaleKind::Linear;
+                if (dynamic_cast<const eah::Log2Scale<R> *>(&scale) != nullptr)
+                    return ScaleKind::Log2;
+                if (dynamic_cast<const eah::Log10Scale<R> *>(&scale) != nullptr)
+                    return ScaleKind::Log10;
+                return ScaleKind::Unknown;
+            }
+
+            //! Kind and domain of a scale.
+            template <class R>
+            [[nodiscard]] static ScaleDomain of(const eah::Scale<R> &scale)
+            {
+                return {kind_of(scale), static_cast<double>(scale.min()), static_cast<double>(scale.max()),
+                        static_cast<uint64_t>(scale.size())};
+            }
+
+            //! Whether the given scale has this kind and domain, so that their buckets are the same.
+            template <class R>
+            [[nodiscard]] bool matches(const eah::Scale<R> &scale) const
+            {
+                return kind == kind_of(scale) and min == static_cast<double>(scale.min()) and
+                    max == static_cast<double>(scale.max()) and size == scale.size();
+            }
+        };
+
+        /** Implementation details of the archives. */
+        namespace detail
+        {
+            //! Appends raw values to a buffer.
+            class Writer
+            {
+                std::string buffer_;
+
+            public:
+                //! Append a value.
+                template <class T>
+                void put(const T value)
+                {
+                    static_assert(std::is_trivially_copyable_v<T>);
+                    buffer_.append(reinterpret_cast<const char *>(&value), sizeof(T));
+                }
+
+                //! Append a string, preceded by its size.
+                void put(const std::string &s)
+                {
+                    put(static_cast<uint32_t>(s.size()));
+                    buffer_.append(s);
+                }
+
+                //! Append raw bytes.
+                void append(const std::string &bytes) { buffer_.append(bytes); }
+
+                //! Size written so far.
+                [[nodiscard]] size_t size() const { return buffer_.size(); }
+
+                //! The content.
+                [[nodiscard]] const std::string &str() const { return buffer_; }
+            };
+
+            //! Reads raw values from a memory range.
+            class Cursor
+            {
+                const char *p_;
+                const char *end_;
+
+                //! Check that n bytes can be read.
+                void require(const size_t n) const
+                {
+                    if (static_cast<size_t>(end_ - p_) < n)
+                        throw std::runtime_error("Truncated archive.");
+                }
+
+            public:
+                //! Read within [begin, end[.
+                Cursor(const char *begin, const char *end) : p_(begin), end_(end) {}
+
+                //! Read a value.
+                template <class T>
+                T get()
+                {
+                    static_assert(std::is_trivially_copyable_v<T>);
+                    require(sizeof(T));
+                    T value;
+                    std::memcpy(&value, p_, sizeof(T));
+                    p_ += sizeof(T);
+                    return value;
+                }
+
+                //! Read a string, preceded by its size.
+                std::string get_string()
+                {
+                    const auto n = get<uint32_t>();
+                    require(n);
+                    std::string s(p_, n);
+                    p_ += n;
+                    return s;
+                }
+
+                //! Skip n bytes, returning where they start.
+                const char *skip(const size_t n)
+                {
+                    require(n);
+                    const char *at = p_;
+                    p_ += n;
+                    return at;
+                }
+
+                //! Current position.
+                [[nodiscard]] const char *position() const { return p_; }
+
+                //! True if everything has been read.
+                [[nodiscard]] bool done() const { return p_ == end_; }
+            };
+
+            /** @name Encoding of the runs.
+             * @{ */
+
+            //! EAF: number of points, then their quality and time (the run is the one of the entry).
+            inline void encode(Writer &out, const eaf::Front &front)
+            {
+                out.put(static_cast<uint64_t>(front.size()));
+                for (const auto &p : front)
+                {
+                    out.put(p.qual);
+                    out.put(static_cast<uint64_t>(p.time));
+                }
+            }
+
+            //! EAF.
+            inline void decode(Cursor &in, const size_t run, eaf::Front &front)
+            {
+                const auto n = in.get<uint64_t>();
+                front.clear();
+                front.reserve(n);
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    const auto qual = in.get<double>();
+                    const auto time = in.get<uint64_t>();
+                    front.emplace_back(qual, static_cast<size_t>(time), run);
+                }
+            }
+
+            //! EAH: number of rows and columns, then the bits, row by row.
+            inline void encode(Writer &out, const eah::AttainmentMatrix &mat)
+            {
+                const uint64_t rows = mat.size();
+                const uint64_t cols = rows == 0 ? 0 : mat[0].size();
+                out.put(rows);
+                out.put(cols);
+                std::string bits((rows * cols + 7) / 8, '\0');
+                size_t k = 0;
+                for (const auto &row : mat)
+                {
+                    assert(row.size() == cols);
+                    for (const bool b : row)
+                    {
+                        if (b)
+                            bits[k / 8] = static_cast<char>(bits[k / 8] | (1 << (k % 8)));
+                        ++k;
+                    }
+                }
+                out.append(bits);
+            }
+
+            //! EAH.
+            inline void decode(Cursor &in, const size_t, eah::AttainmentMatrix &mat)
+            {
+                const auto rows = in.get<uint64_t>();
+                const auto cols = in.get<uint64_t>();
+                const auto bits = reinterpret_cast<const unsigned char *>(in.skip((rows * cols + 7) / 8));
+                mat.assign(rows, std::vector<bool>(cols, false));
+                size_t k = 0;
+                for (auto &row : mat)
+                    for (size_t j = 0; j < cols; ++j, ++k)
+                        row[j] = (bits[k / 8] >> (k % 8)) & 1;
+            }
+
+            //! Store: the names of the properties, then for each evaluation, its number and its values (with a flag).
+            inline void encode(Writer &out, const Store::Run &run)
+            {
+                std::map<std::string, uint32_t> ids;
+                std::vector<const std::string *> names;
+                for (const auto &[evaluation, attributes] : run)
+                    for (const auto &attribute : attributes)
+                        if (ids.emplace(attribute.first, static_cast<uint32_t>(names.size())).second)
+                            names.push_back(&attribute.first);
+
+                out.put(static_cast<uint32_t>(names.size()));
+                for (const auto name : names)
+                    out.put(*name);
+                out.put(static_cast<uint64_t>(run.size()));
+                for (const auto &[evaluation, attributes] : run)
+                {
+                    out.put(static_cast<uint64_t>(evaluation));
+                    out.put(static_cast<uint32_t>(attributes.size()));
+                    for (const auto &[name, value] : attributes)
+                    {
+                        out.put(ids.at(name));
+                        out.put(static_cast<uint8_t>(value.has_value()));
+                        if (value)
+                            out.put(value.value());
+                    }
+                }
+            }
+
+            //! Store.
+            inline void decode(Cursor &in, const size_t, Store::Run &run)
+            {
+                std::vector<std::string> names(in.get<uint32_t>());
+                for (auto &name : names)
+                    name = in.get_string();
+
+                run.clear();
+                const auto n = in.get<uint64_t>();
+                for (uint64_t e = 0; e < n; ++e)
+                {
+                    const auto evaluation = static_cast<size_t>(in.get<uint64_t>());
+                    auto &attributes = run.emplace_hint(run.end(), evaluation, Store::Attributes())->second;
+                    const auto m = in.get<uint32_t>();
+                    for (uint32_t a = 0; a < m; ++a)
+                    {
+                        const auto id = in.get<uint32_t>();
+                        if (id >= names.size())
+                            throw std::runtime_error("Corrupted archive: unknown property.");
+                        Store::Value value;
+                        if (in.get<uint8_t>() != 0)
+                            value = in.get<double>();
+                        // Names were encoded in the order of the map.
+                        attributes.emplace_hint(attributes.end(), names[id], value);
+                    }
+                }
+            }
+
+            /** @} */
+
+            //! Write an archive of the runs with the given keys, the i-th run being encoded by `encode_run(payload, i)`.
+            template <class Encode>
+            void write(const fs::path &file, const Kind kind, const Writer &meta, const std::vector<Key> &keys,
+                       Encode &&encode_run)
+            {
+                Writer payload;
+                Writer index;
+                index.put(static_cast<uint64_t>(keys.size()));
+                for (size_t i = 0; i < keys.size(); ++i)
+                {
+                    const auto &key = keys[i];
+                    const auto offset = payload.size();
+                    encode_run(payload, i);
+                    index.put(key.suite);
+                    index.put(static_cast<int32_t>(key.problem));
+                    index.put(static_cast<int32_t>(key.dimension));
+                    index.put(static_cast<int32_t>(key.instance));
+                    index.put(static_cast<uint64_t>(key.run));
+                    index.put(static_cast<uint64_t>(offset));
+                    index.put(static_cast<uint64_t>(payload.size() - offset));
+                }
+
+                Writer header;
+                for (const char c : magic)
+                    header.put(c);
+                header.put(byte_order_mark);
+                header.put(version);
+                header.put(static_cast<uint8_t>(kind));
+                header.put(static_cast<uint8_t>(0));
+                header.put(static_cast<uint32_t>(meta.size()));
+                header.append(meta.str());
+
+                if (file.has_parent_path() and not exists(file.parent_path()))
+                    create_directories(file.parent_path());
+                std::ofstream out(file, std::ios::binary);
+                if (not out)
+                    throw std::runtime_error(fmt::format("Cannot write {}", file.generic_string()));
+                for (const auto *part : {&header, &index, &payload})
+                    out.write(part->str().data(), static_cast<std::streamsize>(part->size()));
+            }
+
+            //! Write an archive of the given runs.
+            template <class Leaf>
+            void write(const fs::path &file, const Kind kind, const Writer &meta,
+                       const std::vector<std::pair<Key, const Leaf *>> &runs)
+            {
+                std::vector<Key> keys;
+                keys.reserve(runs.size());
+                for (const auto &run : runs)
+                    keys.push_back(run.first);
+                write(file, kind, meta, keys, [&runs](Writer &out, const size_t i) { encode(out, *runs[i].second); });
+            }
+
+            //! Meta data of EAH archives.
+            inline Writer eah_meta(const ScaleDomain &errors, const ScaleDomain &evaluations)
+            {
+                Writer meta;
+                for (const auto &s : {errors, evaluations})
+                {
+                    meta.put(static_cast<uint8_t>(s.kind));
+                    meta.put(s.min);
+                    meta.put(s.max);
+                    meta.put(s.size);
+                }
+                return meta;
+            }
+        } // namespace detail
+
+        /** Save the data of a logger::EAF.
+         *
+         * @param file The archive to write.
+         * @param data The runs.
+         * @param optim_type The optimization type of the problems on which they have been logged.
+         */
+        inline void save(const fs::path &file, const EAF::Suites &data, const common::OptimizationType optim_type)
+        {
+            std::vector<std::pair<Key, const eaf::Front *>> runs;
+            for (const auto &[suite, problems] : data)
+                for (const auto &[pb, dimensions] : problems)
+                    for (const auto &[dim, instances] : dimensions)
+                        for (const auto &[ins, rs] : instances)
+                            for (const auto &[run, front] : rs)
+                                runs.emplace_back(Key{suite, pb, dim, ins, run}, &front);
+            detail::Writer meta;
+            meta.put(static_cast<uint8_t>(optim_type == common::OptimizationType::Minimization ? 1 : 2));
+            detail::write(file, Kind::EAF, meta, runs);
+        }
+
+        //! Save the data of a logger::EAF.
+        inline void save(const fs::path &file, const EAF &logger)
+        {
+            save(file, logger.data(), logger.optimization_type());
+        }
+
+        /** Save the data of a logger::EAH.
+         *
+         * @param file The archive to write.
+         * @param data The attainment matrices.
+         * @param errors The kind and domain of the error scale.
+         * @param evaluations The kind and domain of the evaluations scale.
+         */
+        inline void save(const fs::path &file, const eah::AttainmentSuite &data, const ScaleDomain &errors,
+                         const ScaleDomain &evaluations)
+        {
+            std::vector<std::pair<Key, const eah::AttainmentMatrix *>> runs;
+            for (const auto &[pb, dimensions] : data)
+                for (const auto &[dim, instances] : dimensions)
+                    for (const auto &[ins, rs] : instances)
+                        for (const auto &[run, mat] : rs)
+                            runs.emplace_back(
+                                Key{"", static_cast<int>(pb), static_cast<int>(dim), static_cast<int>(ins), run},
+                                &mat);
+            detail::write(file, Kind::EAH, detail::eah_meta(errors, evaluations), runs);
+        }
+
+        //! Save the data of a logger::EAH.
+        inline void save(const fs::path &file, const EAH &logger)
+        {
+            save(file, logger.data(), ScaleDomain::of(logger.error_range()), ScaleDomain::of(logger.eval_range()));
+        }
+
+        /** Save the data of a logger::Store.
+         *
+         * @param file The archive to write.
+         * @param data The runs.
+         */
+        inline void save(const fs::path &file, const Store::Suites &data)
+        {
+            std::vector<std::pair<Key, const Store::Run *>> runs;
+            for (const auto &[suite, problems] : data)
+                for (const auto &[pb, dimensions] : problems)
+                    for (const auto &[dim, instances] : dimensions)
+                        for (const auto &[ins, rs] : instances)
+                            for (const auto &[run, r] : rs)
+                                runs.emplace_back(Key{suite, pb, dim, ins, run}, &r);
+            detail::write(file, Kind::Store, detail::Writer(), runs);
+        }
+
+        /** Save the data of a logger::Store, one run at a time.
+         *
+         * Contrary to `save(file, logger.data())`, the runs spilled to disk are not all loaded at once.
+         *
+         * @param file The archive to write.
+         * @param logger The logger.
+         */
+        inline void save(const fs::path &file, Store &logger)
+        {
+            const auto cursors = logger.runs();
+            std::vector<Key> keys;
+            keys.reserve(cursors.size());
+            for (const auto &c : cursors)
+                keys.push_back(Key{c.suite, c.pb, c.dim, c.instance, c.run});
+            detail::write(file, Kind::Store, detail::Writer(), keys,
+                          [&](detail::Writer &out, const size_t i) { detail::encode(out, logger.run(cursors[i])); });
+        }
+
+        /** Read access to an archive.
+         *
+         * The file is mapped in memory and only its index is decoded at construction,
+         * runs being decoded when they are accessed.
+         */
+        class Reader
+        {
+            //! The content of the archive.
+            common::file::MappedFile file_;
+
+            //! Kind of the archive.
+            Kind kind_;
+
+            //! Version of the format.
+            uint16_t version_;
+
+            //! Kind-specific meta data.
+            const char *meta_;
+
+            //! Size of the meta data.
+            size_t meta_size_;
+
+            //! The runs.
+            std::vector<Entry> entries_;
+
+            //! Start of the payload.
+            const char *payload_;
+
+            //! Size of the payload.
+            size_t payload_size_;
+
+            //! Throw if the archive is not of the given kind.
+            void expect(const Kind kind) const
+            {
+                if (kind_ != kind)
+                    throw std::runtime_error("The archive does not hold data of this kind of logger.");
+            }
+
+            //! Decode a run.
+            template <class Leaf>
+            Leaf decode(const Entry &entry) const
+            {
+                if (entry.offset > payload_size_ or entry.size > payload_size_ - entry.offset)
+                    throw std::runtime_error("Corrupted archive: run out of the payload.");
+                detail::Cursor in(payload_ + entry.offset, payload_ + entry.offset + entry.size);
+                Leaf leaf;
+                detail::decode(in, entry.key.run, leaf);
+                return leaf;
+            }
+
+        public:
+            /** Open an archive.
+             *
+             * @param file The archive.
+             * @throws std::runtime_error if the file is not an archive, or cannot be read by this version.
+             */
+            explicit Reader(const fs::path &file) : file_(file)
+            {
+                detail::Cursor in(file_.data(), file_.data() + file_.size());
+                for (const char c : magic)
+                    if (in.get<char>() != c)
+                        throw std::runtime_error(fmt::format("{} is not an archive.", file.generic_string()));
+                if (in.get<uint32_t>() != byte_order_mark)
+                    throw std::runtime_error("The archive has been written with another byte order.");
+                version_ = in.get<uint16_t>();
+                if (version_ > version)
+                    throw std::runtime_error(fmt::format("Unsupported archive version {}.", version_));
+                kind_ = static_cast<Kind>(in.get<uint8_t>());
+                in.get<uint8_t>();
+                meta_size_ = in.get<uint32_t>();
+                meta_ = in.skip(meta_size_);
+
+                const auto n = in.get<uint64_t>();
+                entries_.reserve(static_cast<size_t>(std::min<uint64_t>(n, file_.size())));
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    Entry e;
+                    e.key.suite = in.get_string();
+                    e.key.problem = in.get<int32_t>();
+                    e.key.dimension = in.get<int32_t>();
+                    e.key.instance = in.get<int32_t>();
+                    e.key.run = static_cast<size_t>(in.get<uint64_t>());
+                    e.offset = in.get<uint64_t>();
+                    e.size = in.get<uint64_t>();
+                    entries_.push_back(std::move(e));
+                }
+                payload_ = in.position();
+                payload_size_ = static_cast<size_t>(file_.data() + file_.size() - payload_);
+            }
+
+            //! Kind of the archive.
+            [[nodiscard]] Kind kind() const { return kind_; }
+
+            //! Version of the format in which it has been written.
+            [[nodiscard]] uint16_t format_version() const { return version_; }
+
+            //! The runs in the archive.
+            [[nodiscard]] const std::vector<Entry> &entries() const { return entries_; }
+
+            /** @name Meta data
+             * @{ */
+
+            //! Optimization type of the problems of an EAF archive.
+            [[nodiscard]] common::OptimizationType optimization_type() const
+            {
+                expect(Kind::EAF);
+                detail::Cursor in(meta_, meta_ + meta_size_);
+                return in.get<uint8_t>() == 1 ? common::OptimizationType::Minimization
+                                              : common::OptimizationType::Maximization;
+            }
+
+            //! Kinds and domains of the error and evaluations scales of an EAH archive.
+            [[nodiscard]] std::pair<ScaleDomain, ScaleDomain> scales() const
+            {
+                expect(Kind::EAH);
+                detail::Cursor in(meta_, meta_ + meta_size_);
+                ScaleDomain s[2];
+                for (auto &d : s)
+                {
+                    d.kind = version_ >= 2 ? static_cast<ScaleKind>(in.get<uint8_t>()) : ScaleKind::Unknown;
+                    d.min = in.get<double>();
+                    d.max = in.get<double>();
+                    d.size = in.get<uint64_t>();
+                }
+                return {s[0], s[1]};
+            }
+
+            /** @} */
+
+            /** @name Decoding of a single run
+             * @{ */
+
+            //! The front of a run of an EAF archive.
+            [[nodiscard]] eaf::Front front(const Entry &entry) const
+            {
+                expect(Kind::EAF);
+                return decode<eaf::Front>(entry);
+            }
+
+            //! The attainment matrix of a run of an EAH archive.
+            [[nodiscard]] eah::AttainmentMatrix matrix(const Entry &entry) const
+            {
+                expect(Kind::EAH);
+                return decode<eah::AttainmentMatrix>(entry);
+            }
+
+            //! The values of a run of a Store archive.
+            [[nodiscard]] Store::Run run(const Entry &entry) const
+            {
+                expect(Kind::Store);
+                return decode<Store::Run>(entry);
+            }
+
+            /** @} */
+
+            /** @name Decoding of all the runs
+             * @{ */
+
+            //! The data of an EAF archive.
+            [[nodiscard]] EAF::Suites eaf_suites() const
+            {
+                EAF::Suites data;
+                for (const auto &e : entries_)
+                    data[e.key.suite][e.key.problem][e.key.dimension][e.key.instance][e.key.run] = front(e);
+                return data;
+            }
+
+            //! The data of an EAH archive.
+            [[nodiscard]] eah::AttainmentSuite attainment_suite() const
+            {
+                eah::AttainmentSuite data;
+                for (const auto &e : entries_)
+                    data[static_cast<size_t>(e.key.problem)][static_cast<size_t>(e.key.dimension)]
+                        [static_cast<size_t>(e.key.instance)][e.key.run] = matrix(e);
+                return data;
+            }
+
+            //! The data of a Store archive.
+            [[nodiscard]] Store::Suites store_suites() const
+            {
+                Store::Suites data;
+                for (const auto &e : entries_)
+                    data[e.key.suite][e.key.problem][e.key.dimension][e.key.instance][e.key.run] = run(e);
+                return data;
+            }
+
+            /** @} */
+        };
+
+        /** Add the runs of an archive to a logger::EAF (see EAF::merge).
+         *
+         * @param file The archive.
+         * @param logger The logger in which to add the runs.
+         */
+        inline void load(const fs::path &file, EAF &logger)
+        {
+            const Reader reader(file);
+            logger.merge(reader.eaf_suites(), reader.optimization_type());
+        }
+
+        /** Add the runs of an archive to a logger::EAH (see EAH::merge).
+         *
+         * @param file The archive.
+         * @param logger The logger in which to add the runs.
+         * @throws std::invalid_argument if the scales of the logger differ from the ones of the archive, in kind
+         * or domain (the kind of the scales of version 1 archives is unknown, so they only match user-defined scales).
+         */
+        inline void load(const fs::path &file, EAH &logger)
+        {
+            const Reader reader(file);
+            const auto [errors, evaluations] = reader.scales();
+            if (not errors.matches(logger.error_range()) or not evaluations.matches(logger.eval_range()))
+                throw std::invalid_argument("The scales of the archive differ from the ones of the EAH logger.");
+            logger.merge(reader.attainment_suite());
+        }
+
+        /** Add the runs of an archive to a logger::Store (see Store::merge).
+         *
+         * @param file The archive.
+         * @param logger The logger in which to add the runs.
+         */
+        inline void load(const fs::path &file, Store &logger)
+        {
+            const Reader reader(file);
+            logger.merge(reader.store_suites());
+        }
+    } // namespace archive
+} // namespace ioh::logger
@@ -69,6 +69,7 @@ namespace ioh::logger
         void append(Logger& logger)
         {
             _loggers.push_back(logger);
+            next_evaluation_ = 0;
         }
 
         /** Logger interface */
@@ -88,14 +89,29 @@ namespace ioh::logger
             }
         }
 
+        void hand_over(std::shared_ptr<logger::Handover> handover) override
+        {
+            for(auto& logger : _loggers) {
+                logger.get().hand_over(handover);
+            }
+            Logger::hand_over(std::move(handover));
+        }
+
         // We override the high-level interface because a Combine has no properties or triggers.
         // Hence, we cannot use the Logger's implementation, which check for existing ones.
-        // So here, we just proxy to sub-loggers' `log` method to do it.
+        // So here, we just proxy to sub-loggers' `log` method to do it,
+        // and we are due as soon as one of them is.
         void log(const logger::Info &logger_info) override
         {
             IOH_DBG(debug,"call sub-loggers")
+            // The best value may have improved if the current one equals it.
+            const bool improved = logger_info.transformed_y == logger_info.transformed_y_best;
+            next_evaluation_ = trigger::never;
             for(auto &logger : _loggers) {
-                logger.get().log(logger_info);
+                if(logger.get().is_due(logger_info.evaluations, improved)) {
+                    logger.get().log(logger_info);
+                }
+                next_evaluation_ = std::min(next_evaluation_, logger.get().next_evaluation());
             }
         }
 
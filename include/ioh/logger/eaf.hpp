@@ -212,10 +212,10 @@ namespace logger {
         {
             // Do not use the Logger's constructor, to avoid passing references to uninitialized members.
             // /!\ needed by the algorithm, do not change unless you know what you're doing.
-            triggers_.insert(std::ref(_on_improvement));
+            triggers_->insert(std::ref(_on_improvement));
             // /!\ needed by the related eaf::stat::* classes.
-            properties_.insert_or_assign(_transformed_y_best.name(), _transformed_y_best);
-            properties_.insert_or_assign(       _evaluations.name(), _evaluations);
+            _transformed_y_best_id = add_property(_transformed_y_best);
+            _evaluations_id        = add_property(_evaluations);
         }
 
         /** Set the current suite name.
@@ -262,8 +262,9 @@ namespace logger {
         {
             IOH_DBG(debug, "EAF called after improvement")
             // Access the properties that were instantiated in the constructor.
-            const std::optional<double> transformed_y_best = properties_.at("transformed_y_best").get()(log_info);
-            const std::optional<double> evaluations        = properties_.at("evaluations").get()(log_info);
+            gather(log_info);
+            const std::optional<double> transformed_y_best = values_[_transformed_y_best_id];
+            const std::optional<double> evaluations        = values_[_evaluations_id];
 #ifndef NDEBUG
             assert(transformed_y_best); // Assert that the optional holds a value, which should be the case here.
             assert(evaluations);
@@ -293,6 +294,44 @@ namespace logger {
             return _current_problem_type.type();
         }
 
+        /** Add runs logged elsewhere (for instance by another process, see logger::archive).
+         *
+         * The added runs are numbered after the runs already logged
+         * for the same problem, dimension and instance.
+         *
+         * @note Should not be called during a run.
+         *
+         * @param data The runs to add.
+         * @param optim_type The optimization type of the problems on which they have been logged.
+         * @throws std::invalid_argument if the logger already holds runs of another optimization type,
+         *         whose fronts could not be compared.
+         */
+        void merge(const Suites& data, const common::OptimizationType optim_type)
+        {
+            if(_has_problem_type and _current_problem_type.type() != optim_type) {
+                throw std::invalid_argument("Cannot merge runs of another optimization type in an EAF logger.");
+            }
+            _current_problem_type = optim_type;
+            _has_problem_type = true;
+
+            for(const auto& [suite, problems] : data) {
+                for(const auto& [pb, dimensions] : problems) {
+                    for(const auto& [dim, instances] : dimensions) {
+                        for(const auto& [ins, runs] : instances) {
+                            Runs& into = _data[suite][pb][dim][ins];
+                            for(const auto& run_front : runs) {
+                                const size_t run = into.size();
+                                eaf::Front& front = into.emplace_hint(into.end(), run, run_front.second)->second;
+                                for(auto& p : front) {
+                                    p.run = run;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
     protected:
 #ifndef NDEBUG
         // Use to double check that trigger::on_improvement do its job.
@@ -327,6 +366,11 @@ namespace logger {
         //! Property watching the objective function value.
         watch::TransformedYBest _transformed_y_best;
 
+        //! Id of the number of evaluations property.
+        size_t _evaluations_id = 0;
+
+        //! Id of the objective function value property.
+        size_t _transformed_y_best_id = 0;
 
     }; // class EAF
 
@@ -461,11 +505,12 @@ namespace logger {
                 /** Extract the runs from the logger and computes the attainment levelsets. */
                 Type operator()(const EAF& logger)
                 {
-                    // Not a perfect guard, because this only tests the last attached problem.
+                    // Not a perfect guard, because this only tests the last attached problem
+                    // (or the type of the last merged runs).
                     // But, there is no way to ensure that all problems seen by the loggers
                     // have been of the same type.
                     // This is at least a check.
-                    assert(_optim_type == logger.problem().optimization_type.type());
+                    assert(_optim_type == logger.optimization_type());
                     
                     // Input:
                     std::vector<eaf::Front> fronts;
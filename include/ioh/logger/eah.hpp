@@ -1,7 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <cmath>
+#include <cstring>
+#include <limits>
 
 #include "loggers.hpp"
 
@@ -36,6 +39,11 @@ namespace ioh
              *          this uses a closed [min,max] interval for the "origin" values.
              *          So that any value at `max` will be assigned to the `size-1`th bucket.
              *
+             * Scales may tabulate their buckets (see Scale::tabulate),
+             * in which case indices are found among the lowest values of the buckets
+             * (a cheap key of the value giving the few candidate buckets, searched by bisection),
+             * instead of evaluating the scale's formula for each value.
+             *
              * Used in EAH.
              * 
              * @ingroup EAH_API
@@ -95,6 +103,44 @@ namespace ioh
                  */
                 virtual BoundsType bounds(size_t i) const = 0;
 
+                /** Indices of several values at once.
+                 *
+                 * Faster than calling `index` for each value, if the scale is tabulated.
+                 *
+                 * @param xs The targeted real values.
+                 * @returns The corresponding indices.
+                 */
+                std::vector<size_t> indices(const std::vector<double> &xs) const
+                {
+                    std::vector<size_t> res(xs.size());
+                    indices(xs.data(), xs.size(), res.data());
+                    return res;
+                }
+
+                /** Indices of several values at once.
+                 *
+                 * @param xs Pointer to the first value.
+                 * @param n Number of values.
+                 * @param out Pointer to the first of the `n` indices to write.
+                 */
+                void indices(const double *xs, const size_t n, size_t *out) const
+                {
+                    if (not _starts.empty())
+                        for (size_t k = 0; k < n; ++k)
+                            out[k] = lookup(xs[k]);
+                    else
+                        for (size_t k = 0; k < n; ++k)
+                            out[k] = index(xs[k]);
+                }
+
+                /** Lowest value of each bucket, but the first one, if the scale is tabulated.
+                 *
+                 * @note Contrary to `bounds`, these are exactly the values at which `index` changes.
+                 */
+                const std::vector<double> &thresholds() const { return _thresholds; }
+
+                virtual ~Scale() = default;
+
             protected:
                 //! Minimum.
                 R _min;
@@ -102,6 +148,149 @@ namespace ioh
                 R _max;
                 //! Number of buckets.
                 size_t _size;
+
+                //! Lowest value of each bucket, but the first one, empty if the scale is not tabulated.
+                std::vector<double> _thresholds;
+
+                //! Number of thresholds having a key lower than each key, plus the total number of thresholds.
+                std::vector<size_t> _starts;
+
+                //! Size of the searched window: a power of two, larger than the number of thresholds of any key.
+                size_t _window = 1;
+
+                //! The thresholds, followed by `_window` infinite values, so that the search never leaves the table.
+                std::vector<double> _table;
+
+                //! Key of a value in the table, bounded by the number of keys.
+                size_t key(const double x) const { return std::min(raw_key(x), _starts.size() - 2); }
+
+                /** Key of a value: the binary exponent of `1 + (x - min)`, read from its bits.
+                 *
+                 * This is a non-decreasing function of the value,
+                 * so that the thresholds having a lower (higher) key than a value are lower (higher) than it.
+                 */
+                size_t raw_key(const double x) const
+                {
+                    const double y = 1.0 + (x - static_cast<double>(_min));
+                    uint64_t bits;
+                    std::memcpy(&bits, &y, sizeof(bits));
+                    const auto e = static_cast<int64_t>((bits >> 52) & 0x7ff) - 1023;
+                    return y >= 1.0 ? static_cast<size_t>(e) : 0;
+                }
+
+                /** Index of a value in a tabulated scale.
+                 *
+                 * This is the number of thresholds lower or equal to the value.
+                 * The thresholds having a lower key are all counted,
+                 * those having a higher key are all greater than the value,
+                 * so that only a window starting at the first threshold having the same key is searched.
+                 * The bisection has no branch (the comparison is a conditional move),
+                 * and always the same number of steps, which keeps it predictable.
+                 */
+                size_t lookup(const double x) const
+                {
+                    const double *base = _table.data() + _starts[key(x)];
+                    for (size_t n = _window; n > 1; n /= 2)
+                        base = (base[n / 2] <= x) ? base + n / 2 : base;
+                    return static_cast<size_t>(base - _table.data()) + (*base <= x);
+                }
+
+                /** Compute the thresholds of the buckets, so that `lookup` matches the given index function.
+                 *
+                 * To be called in the constructor of subclasses.
+                 * The threshold of bucket `i` is the lowest double in [min,max] for which `compute(x) >= i`,
+                 * searched around the given guess.
+                 * The index function is thus assumed to be non-decreasing.
+                 *
+                 * @param compute The index function (without the special case of `max`).
+                 * @param guess Approximation of the lowest value of a bucket, from its index.
+                 */
+                template <class F, class G>
+                void tabulate(F compute, G guess)
+                {
+                    find_thresholds(compute, guess);
+
+                    _starts.assign(raw_key(static_cast<double>(_max)) + 2, 0);
+                    for (const auto t : _thresholds)
+                        ++_starts[key(t) + 1];
+                    size_t most = 0;
+                    for (size_t k = 1; k < _starts.size(); ++k)
+                    {
+                        most = std::max(most, _starts[k]);
+                        _starts[k] += _starts[k - 1];
+                    }
+
+                    _window = 1;
+                    while (_window <= most)
+                        _window *= 2;
+                    _table = _thresholds;
+                    _table.resize(_thresholds.size() + _window, std::numeric_limits<double>::infinity());
+                }
+
+            private:
+                //! Compute the thresholds (see Scale::tabulate).
+                template <class F, class G>
+                void find_thresholds(F compute, G guess)
+                {
+                    const auto lo = to_ordered(static_cast<double>(_min));
+                    const auto hi = to_ordered(static_cast<double>(_max));
+                    _thresholds.clear();
+                    _thresholds.reserve(_size - 1);
+                    for (size_t i = 1; i < _size; ++i)
+                    {
+                        const auto reached = [&](const int64_t k) { return compute(from_ordered(k)) >= i; };
+
+                        // Bracket the threshold in [a,b], starting from the guess, by doubling steps.
+                        const double g = guess(i);
+                        auto a = std::isfinite(g) ? std::clamp(to_ordered(g), lo, hi) : lo;
+                        if (not _thresholds.empty())
+                            a = std::max(a, to_ordered(_thresholds.back()));
+                        auto b = a;
+                        for (int64_t step = 1; a > lo and reached(a); step *= 2)
+                            a = std::max(lo, a - step);
+                        for (int64_t step = 1; b < hi and not reached(b); step *= 2)
+                            b = std::min(hi, b + step);
+
+                        if (not reached(b))
+                        {
+                            // Only `max` reaches this bucket (and all the following ones).
+                            _thresholds.resize(_size - 1, static_cast<double>(_max));
+                            return;
+                        }
+                        if (reached(a))
+                        {
+                            _thresholds.push_back(from_ordered(a));
+                            continue;
+                        }
+                        // Bisect, keeping not reached(a) and reached(b).
+                        while (b - a > 1)
+                        {
+                            const auto mid = a + (b - a) / 2;
+                            if (reached(mid))
+                                b = mid;
+                            else
+                                a = mid;
+                        }
+                        _thresholds.push_back(from_ordered(b));
+                    }
+                }
+
+                //! Map a double to an integer, keeping the order and making adjacent doubles adjacent integers.
+                static int64_t to_ordered(const double x)
+                {
+                    int64_t k;
+                    std::memcpy(&k, &x, sizeof(k));
+                    return k < 0 ? std::numeric_limits<int64_t>::min() - k : k;
+                }
+
+                //! Inverse of to_ordered.
+                static double from_ordered(const int64_t k)
+                {
+                    const int64_t bits = k < 0 ? std::numeric_limits<int64_t>::min() - k : k;
+                    double x;
+                    std::memcpy(&x, &bits, sizeof(x));
+                    return x;
+                }
             };
 
             /** Linear scale.
@@ -135,6 +324,7 @@ namespace ioh
                     {
                         return this->size() - 1;
                     }
+                    // A single division is cheaper than a lookup in a table, so this scale is not tabulated.
                     return static_cast<size_t>(std::floor(
                         (x - this->min()) / this->length() * this->size()));
                 }
@@ -195,6 +385,8 @@ namespace ioh
                     _k(std::log2(1 + max - min))
                 {
                     // FIXME check size against max-min ?
+                    this->tabulate([this](const double x) { return compute_index(x); },
+                                   [this](const size_t i) { return this->bounds(i).first; });
                 }
 
                 /** Returns the index of the bucket in which a value falls.
@@ -210,6 +402,15 @@ namespace ioh
                     {
                         return this->size() - 1;
                     }
+                    return this->lookup(x);
+                }
+
+                /** Computes the index of the bucket in which a value falls, from the scale's formula.
+                 *
+                 * Same as `index` for values in [min,max[, but slower.
+                 */
+                size_t compute_index(const double x) const
+                {
                     return static_cast<size_t>(
                         std::floor(std::log2(1 + (x - _m)) / _k * _s)
                     );
@@ -270,6 +471,8 @@ namespace ioh
                     _k(std::log10(1 + max - min))
                 {
                     // FIXME check size against max-min ?
+                    this->tabulate([this](const double x) { return compute_index(x); },
+                                   [this](const size_t i) { return this->bounds(i).first; });
                 }
 
                 /** Returns the index of the bucket in which a value falls.
@@ -285,6 +488,15 @@ namespace ioh
                     {
                         return this->size() - 1;
                     }
+                    return this->lookup(x);
+                }
+
+                /** Computes the index of the bucket in which a value falls, from the scale's formula.
+                 *
+                 * Same as `index` for values in [min,max[, but slower.
+                 */
+                size_t compute_index(const double x) const
+                {
                     return static_cast<size_t>(
                         std::floor(std::log10(1 + (x - _m)) / _k * _s)
                     );
@@ -455,10 +667,10 @@ namespace ioh
                                            false))
             {
                 // Insert references after members are instantiated.
-                triggers_.insert(std::ref(_on_improvement));
-                assert(triggers_.size() > 0);
-                properties_.insert_or_assign(_transformed_y_best.name(), _transformed_y_best);
-                properties_.insert_or_assign(_evaluations.name(), _evaluations);
+                triggers_->insert(std::ref(_on_improvement));
+                assert(triggers_->size() > 0);
+                _transformed_y_best_id = add_property(_transformed_y_best);
+                _evaluations_id = add_property(_evaluations);
                 assert(consistent_properties());
             }
 
@@ -479,10 +691,10 @@ namespace ioh
                                            false))
             {
                 // Insert references after members are instantiated.
-                triggers_.insert(std::ref(_on_improvement));
-                assert(triggers_.size() > 0);
-                properties_.insert_or_assign(_transformed_y_best.name(), _transformed_y_best);
-                properties_.insert_or_assign(_evaluations.name(), _evaluations);
+                triggers_->insert(std::ref(_on_improvement));
+                assert(triggers_->size() > 0);
+                _transformed_y_best_id = add_property(_transformed_y_best);
+                _evaluations_id = add_property(_evaluations);
                 assert(consistent_properties());
             }
 
@@ -529,9 +741,10 @@ namespace ioh
                 }
 
                 // Access the properties that were instantiated in the constructor.
-                const std::optional<double> transformed_y_best = properties_.at("transformed_y_best").get()(log_info);
+                gather(log_info);
+                const std::optional<double> transformed_y_best = values_[_transformed_y_best_id];
                 assert(transformed_y_best); // Assert that the optional holds a value, which should be the case here.
-                const std::optional<double> evaluations = properties_.at("evaluations").get()(log_info);
+                const std::optional<double> evaluations = values_[_evaluations_id];
                 assert(evaluations);
 
                 double err;
@@ -640,6 +853,37 @@ namespace ioh
 
             /** @} */
 
+            /** Add runs logged elsewhere (for instance by another process, see logger::archive).
+             *
+             * The added runs are numbered after the runs already logged
+             * for the same problem, dimension and instance.
+             *
+             * @note Should not be called during a run.
+             *
+             * @param data The attainment matrices to add, which should have been computed on the same scales.
+             * @throws std::invalid_argument if a matrix does not have the size of the scales.
+             */
+            void merge(const eah::AttainmentSuite &data)
+            {
+                for (const auto &[pb, dimensions] : data)
+                    for (const auto &[dim, instances] : dimensions)
+                        for (const auto &[ins, runs] : instances)
+                            for (const auto &run : runs)
+                                if (run.second.size() != _range_error.size() or
+                                    (not run.second.empty() and run.second[0].size() != _range_evals.size()))
+                                    throw std::invalid_argument("EAH::merge: attainment matrices sizes differ.");
+
+                for (const auto &[pb, dimensions] : data)
+                    for (const auto &[dim, instances] : dimensions)
+                        for (const auto &[ins, runs] : instances)
+                        {
+                            auto &into = _eah_suite[pb][dim][ins];
+                            // Runs are numbered from one.
+                            for (const auto &run : runs)
+                                into.emplace_hint(into.end(), into.size() + 1, run.second);
+                        }
+            }
+
         protected:
             /** Internal methods  @{ */
 
@@ -786,6 +1030,12 @@ namespace ioh
             //! Property watching the objective function value.
             watch::TransformedYBest _transformed_y_best;
 
+            //! Id of the number of evaluations property.
+            size_t _evaluations_id = 0;
+
+            //! Id of the objective function value property.
+            size_t _transformed_y_best_id = 0;
+
             /** @} */
         };
 
@@ -1092,19 +1342,25 @@ namespace ioh
                         const Scale<double> &range_error = logger.error_range();
                         const Scale<size_t> &range_evals = logger.eval_range();
 
+                        // Widths of buckets vary for log ranges, but not across the matrix.
+                        std::vector<double> ws_evals(mat[0].size());
+                        for (size_t j = 0; j < ws_evals.size(); ++j)
+                        {
+                            const auto [lo, hi] = range_evals.bounds(j);
+                            ws_evals[j] = (hi - lo) / range_evals.length();
+                        }
+
                         double res = init;
                         for (size_t i = 0; i < mat.size(); ++i)
                         {
+                            const auto [lo, hi] = range_error.bounds(i);
+                            const double w_error = (hi - lo) / range_error.length();
+                            assert(0 <= w_error and w_error <= 1);
                             for (size_t j = 0; j < mat[0].size(); ++j)
                             {
                                 const double w_proba = static_cast<double>(mat[i][j]) / histo.nb_attainments();
                                 assert(0 <= w_proba and w_proba <= 1);
-                                // Within the loop because widths of buckets vary for log ranges.
-                                const double w_error = (range_error.bounds(i).second - range_error.bounds(i).first) /
-                                    range_error.length();
-                                assert(0 <= w_error and w_error <= 1);
-                                const double w_evals = (range_evals.bounds(j).second - range_evals.bounds(j).first) /
-                                    range_evals.length();
+                                const double w_evals = ws_evals[j];
                                 assert(0 <= w_evals and w_evals <= 1);
                                 // TODO allow to multiply by a weight each axis?
                                 res = op(res, w_proba * w_error * w_evals);
@@ -3,6 +3,7 @@
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include "ioh/common/gzip.hpp"
 #include "ioh/problem/problem.hpp"
 
 namespace ioh::logger
@@ -12,6 +13,13 @@ namespace ioh::logger
      * Each line displays the problem metadata and the watched properties.
      * This format displays a lot of redundant information, but is very easy to parse.
      *
+     * Lines are formatted in a reusable buffer, which is written to the file by chunks,
+     * and at least at the beginning of each run and when the logger is closed.
+     * A new run of the same problem only updates the cached meta data.
+     * Derived loggers may write the lines of the previous runs only when the problem changes (see `flush_runs_`),
+     * so that campaigns of many short runs do not access the file system between runs.
+     * Positions are written with the shortest representation that round-trips.
+     *
      * @code
         logger::FlatFile(
             {trigger::always},
@@ -50,6 +58,9 @@ namespace ioh::logger
         //! Requires header?
         bool requires_header_;
 
+        //! Write the lines of the previous runs when a new run of the same problem starts?
+        bool flush_runs_ = true;
+
         //! Log meta data?
         const bool log_meta_data_;
         
@@ -62,6 +73,12 @@ namespace ioh::logger
         //! Output stream
         std::ofstream out_;
 
+        //! zlib level of the compressed output, 0 if the output is not compressed.
+        int compression_ = 0;
+
+        //! Compressed output stream, used instead of out_ if compression_ is not 0.
+        std::unique_ptr<common::gzip::Writer> gz_;
+
         //! Current suite
         std::string current_suite_;
         
@@ -71,13 +88,131 @@ namespace ioh::logger
         //! Current meta data
         std::string current_meta_data_;
 
+        //! Meta data of the current problem, up to the run number (empty if it has to be cached again).
+        std::string meta_data_prefix_;
+
+        //! Header line, cached for the properties and the dimension it was made for.
+        std::string header_;
+
+        //! Number of properties in the cached header.
+        size_t header_properties_ = 0;
+
+        //! Dimension of the cached header.
+        size_t header_dimension_ = 0;
+
+        //! Size above which the buffered lines are written to the file.
+        static constexpr size_t chunk_size_ = 1 << 16;
+
+        //! Formatted lines, not yet written to the file.
+        fmt::memory_buffer buffer_;
+
+        //! How to format the value of a property, parsed once from its format string.
+        struct Spec
+        {
+            //! Common formats, for which the format string is parsed at compile time.
+            enum class Kind { fixed, general, shortest, runtime } kind;
+            //! The format string, used for Kind::runtime.
+            std::string format;
+        };
+
+        //! Format specs, indexed by property id.
+        std::vector<Spec> specs_;
+
+        //! Write the buffered lines to the file.
+        void write_buffer()
+        {
+            if (buffer_.size() > 0 and gz_)
+                gz_->write(buffer_.data(), buffer_.size());
+            else if (buffer_.size() > 0 and out_.is_open())
+                out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            buffer_.clear();
+        }
+
+        //! Close the output stream.
+        void close_stream()
+        {
+            out_.close();
+            if (gz_)
+                gz_->close();
+            gz_.reset();
+        }
+
+        //! Append a string to the buffer.
+        void append(const std::string &str) { buffer_.append(str.data(), str.data() + str.size()); }
+
+        //! The header line, made again only if the properties or the dimension changed.
+        const std::string &header(const size_t dimension)
+        {
+            if (header_.empty() or header_properties_ != properties_vector_.size() or header_dimension_ != dimension)
+            {
+                header_ = com_ + common_header_ + format("{}", fmt::join(properties_vector_, sep_));
+                if (store_positions_)
+                    for (size_t i = 0; i < dimension; i++)
+                        fmt::format_to(std::back_inserter(header_), "{}x{}", sep_, i);
+                header_ += eol_;
+                header_properties_ = properties_vector_.size();
+                header_dimension_ = dimension;
+            }
+            return header_;
+        }
+
+        //! Parse the format strings of the properties added since last call.
+        void parse_specs()
+        {
+            for (size_t i = specs_.size(); i < properties_vector_.size(); ++i)
+            {
+                const std::string format = properties_vector_[i].get().format();
+                if (format == "{:f}")
+                    specs_.push_back({Spec::Kind::fixed, format});
+                else if (format == "{:g}")
+                    specs_.push_back({Spec::Kind::general, format});
+                else if (format == "{}")
+                    specs_.push_back({Spec::Kind::shortest, format});
+                else
+                    specs_.push_back({Spec::Kind::runtime, format});
+            }
+        }
+
+        //! Append the gathered value of the i-th property to the buffer.
+        void append_value(const size_t i)
+        {
+            if (!values_[i])
+            {
+                append(nan_);
+                return;
+            }
+
+            const double value = values_[i].value();
+            auto out = std::back_inserter(buffer_);
+            switch (specs_[i].kind)
+            {
+            case Spec::Kind::fixed:
+                // Integral values (e.g. evaluations, or the objective values of most PBO problems)
+                // are formatted as integers, avoiding the exact (and slow) fixed-point conversion.
+                if (std::abs(value) < 1e15 and value == std::trunc(value) and not std::signbit(value))
+                    fmt::format_to(out, FMT_COMPILE("{}.000000"), static_cast<long long>(value));
+                else
+                    fmt::format_to(out, FMT_COMPILE("{:f}"), value);
+                break;
+            case Spec::Kind::general:
+                fmt::format_to(out, FMT_COMPILE("{:g}"), value);
+                break;
+            case Spec::Kind::shortest:
+                fmt::format_to(out, FMT_COMPILE("{}"), value);
+                break;
+            default:
+                fmt::format_to(out, specs_[i].format, value);
+            }
+        }
+
         //! Open a file
         void open_stream(const std::string &filename, const fs::path &output_directory)
         {
+            write_buffer();
             if (filename != filename_)
             {
                 filename_ = filename;
-                out_.close();
+                close_stream();
             }
             if (output_directory_ != output_directory)
             {
@@ -87,12 +222,16 @@ namespace ioh::logger
                     IOH_DBG(debug, "some directories do not exist in " << output_directory_ << ", try to create them")
                     create_directories(output_directory_);
                 }
-                out_.close();
+                close_stream();
             }
-            if (!out_.is_open())
+            if (!out_.is_open() and !gz_)
             {
-                IOH_DBG(debug, "will output data in " << output_directory_ / filename_)
-                out_ = std::ofstream(output_directory_ / filename_);
+                IOH_DBG(debug, "will output data in " << output_directory_ / (filename_ + file_suffix()))
+                if (compression_)
+                    gz_ = std::make_unique<common::gzip::Writer>(output_directory_ / (filename_ + file_suffix()),
+                                                                 compression_);
+                else
+                    out_ = std::ofstream(output_directory_ / filename_);
                 requires_header_ = true;
             }
         }
@@ -133,12 +272,17 @@ namespace ioh::logger
             assert(common_header_titles.empty() || common_header_titles.size() == 7);
         }
 
-        void attach_suite(const std::string &suite_name) override { current_suite_ = suite_name; }
+        void attach_suite(const std::string &suite_name) override
+        {
+            current_suite_ = suite_name;
+            meta_data_prefix_.clear();
+        }
 
         void attach_problem(const problem::MetaData &problem) override
         {
             // If this is a new problem.
-            if (problem_ == nullptr or *problem_ != problem)
+            const bool new_problem = problem_ == nullptr or *problem_ != problem;
+            if (new_problem)
             {
                 IOH_DBG(xdebug, "reset run counter")
                 current_run_ = 0; // Then reset the run counter.
@@ -150,10 +294,24 @@ namespace ioh::logger
             }
 
             Logger::attach_problem(problem);
-            open_stream(filename_, output_directory_);
+            if (new_problem or not(out_.is_open() or gz_))
+                open_stream(filename_, output_directory_);
 
             requires_header_ = requires_header_ or repeat_header_;
-            cache_meta_data();
+            cache_meta_data(new_problem);
+
+            if (gz_)
+            {
+                // Each run is in its own members, compressed on the background thread.
+                write_buffer();
+                gz_->cut(common::gzip::run_start);
+            }
+            else if (new_problem or flush_runs_)
+            {
+                // Previous runs are entirely on disk.
+                write_buffer();
+                out_.flush();
+            }
         }
 
         void call(const Info &log_info) override
@@ -161,27 +319,36 @@ namespace ioh::logger
             if (requires_header_)
             {
                 IOH_DBG(xdebug, "print header")
-                out_ << com_ + common_header_ + format("{}", fmt::join(properties_vector_, sep_));
-                if (store_positions_)
-                    for (size_t i = 0; i < log_info.current.x.size(); i++)
-                        out_ << sep_ << "x" << i;
-                out_ << eol_;
+                append(header(log_info.current.x.size()));
                 requires_header_ = false;
             }
 
             IOH_DBG(xdebug, "print problem meta data")
-            out_ << current_meta_data_;
+            append(current_meta_data_);
             
             IOH_DBG(xdebug, "print watched properties")
-            for (auto p = properties_vector_.begin(); p != properties_vector_.end();){
-                out_ << p->get().call_to_string(log_info, nan_) << (++p != properties_vector_.end() ? sep_ : "");
+            gather(log_info);
+            parse_specs();
+            for (size_t i = 0; i < properties_vector_.size(); ++i)
+            {
+                if (i > 0)
+                    append(sep_);
+                append_value(i);
             }
 
+            // The variables are formatted with their own type, which gives the same text for integers.
             if (store_positions_)
-                out_ << sep_ << format("{:f}", fmt::join(log_info.current.x, sep_));
+                log_info.current.x.visit([this](const auto *x, const size_t n) {
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        append(sep_);
+                        fmt::format_to(std::back_inserter(buffer_), FMT_COMPILE("{}"), x[i]);
+                    }
+                });
 
-            out_ << eol_;
-            out_.flush();
+            append(eol_);
+            if (buffer_.size() >= chunk_size_)
+                write_buffer();
         }
 
         //! Accessor for output directory
@@ -190,11 +357,39 @@ namespace ioh::logger
         //! Accessor for filename
         std::string filename() const { return filename_; }
 
+        /** Write gzip files (with a ".gz" suffix), compressed by blocks on a background thread.
+         *
+         * Each run starts a new gzip member, so that readers can decompress the runs separately
+         * (see common::gzip). Any gzip tool can decompress the whole files.
+         *
+         * @param level zlib level, from 1 (fastest) to 9 (smallest), 0 to write plain text files.
+         *
+         * @warning Call it before attaching the logger, the files already opened are not affected.
+         * @throws std::runtime_error if built without zlib (see IOH_HAS_ZLIB).
+         */
+        void compress(const int level = 1)
+        {
+#ifndef IOH_HAS_ZLIB
+            if (level != 0)
+                throw std::runtime_error("Compressed output needs zlib: build with IOH_HAS_ZLIB defined.");
+#endif
+            if (level < 0 or level > 9)
+                throw std::invalid_argument("The compression level should be in [0, 9].");
+            compression_ = level;
+        }
+
+        //! zlib level of the compressed output, 0 if the output is not compressed.
+        [[nodiscard]] int compression() const { return compression_; }
+
+        //! Suffix of the written files, after the filename (".gz" if they are compressed).
+        [[nodiscard]] std::string file_suffix() const { return compression_ ? ".gz" : ""; }
+
         //! close data file
         virtual void close() override {
-            if (out_.is_open()){
+            if (out_.is_open() or gz_){
                 IOH_DBG(debug, "close data file")
-                out_.close();
+                write_buffer();
+                close_stream();
             }
         }
         
@@ -207,21 +402,28 @@ namespace ioh::logger
         /**
          * \brief Caches the meta data logged at every row. If log_meta_data is false,
          * it will store an empty string.
+         *
+         * \param new_problem If false, only the run number changed.
          */
-        void cache_meta_data()
+        void cache_meta_data(const bool new_problem)
         {
             current_meta_data_.clear();
             if (log_meta_data_)
             {
-                std::stringstream ss;
-                ss /* no sep */ << current_suite_;
-                ss << sep_ << problem_->name;
-                ss << sep_ << problem_->problem_id;
-                ss << sep_ << problem_->instance;
-                ss << sep_ << (problem_->optimization_type == common::OptimizationType::Minimization ? "min" : "max");
-                ss << sep_ << problem_->n_variables;
-                ss << sep_ << current_run_;
-                current_meta_data_ = ss.str();
+                if (new_problem or meta_data_prefix_.empty())
+                {
+                    std::stringstream ss;
+                    ss /* no sep */ << current_suite_;
+                    ss << sep_ << problem_->name;
+                    ss << sep_ << problem_->problem_id;
+                    ss << sep_ << problem_->instance;
+                    ss << sep_ << (problem_->optimization_type == common::OptimizationType::Minimization ? "min" : "max");
+                    ss << sep_ << problem_->n_variables;
+                    ss << sep_;
+                    meta_data_prefix_ = ss.str();
+                }
+                current_meta_data_ = meta_data_prefix_;
+                fmt::format_to(std::back_inserter(current_meta_data_), FMT_COMPILE("{}"), current_run_);
             }
         }
     };
@@ -0,0 +1,545 @@
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <optional>
+#include <thread>
+
+#include "ioh/common/file.hpp"
+#include "ioh/logger/archive.hpp"
+#include "ioh/logger/loggers.hpp"
+
+namespace ioh::logger
+{
+    /** Live results of a campaign, published in a POSIX shared memory segment.
+     *
+     * The segment has a fixed layout, in native byte order, so that any process can map it read-only
+     * (see live::Reader, and the ioh.live module in Python):
+     * - header (64 bytes): magic string (8 bytes), byte order mark (u32), format version (u16), header size (u16),
+     *   slot size (u32), number of slots (u32), trajectory capacity (u32), reserved (u32),
+     *   number of runs started (u64), writer's process id (u64), closed flag (u64), reserved (u64),
+     * - a ring of slots, run `r` being in slot `r % number of slots`, each made of:
+     *   - a record (128 bytes): sequence (u64), run (u64), suite name and problem name (32 bytes each, zero padded),
+     *     problem id, instance, dimension (i32), optimization type (u8, 1: min, 2: max), state (u8, 1: running,
+     *     2: finished), reserved (u16), evaluations (u64), best-so-far objective value (f64), evaluation of the best
+     *     (u64), number of improvements (u64),
+     *   - the best-so-far trajectory: (evaluations (u64), objective value (f64)) for each improvement,
+     *     up to the trajectory capacity, after which the last point is replaced by the newest one.
+     *
+     * The slots are seqlocks: the writer makes the sequence odd while it updates the slot, and even again after.
+     * Readers copy a slot, and retry if the sequence was odd or changed meanwhile.
+     * The writer thus never waits for the readers, and does not make any system call while logging.
+     *
+     * @ingroup Logging
+     */
+    namespace live
+    {
+        //! Magic string at the start of a segment.
+        inline constexpr char magic[8] = {'I', 'O', 'H', 'L', 'I', 'V', 'E', '\0'};
+
+        //! Version of the layout.
+        inline constexpr uint16_t version = 1;
+
+        //! Size of the fixed-size strings.
+        inline constexpr size_t name_size = 32;
+
+        //! State of a run.
+        enum class State : uint8_t
+        {
+            Running = 1,
+            Finished = 2
+        };
+
+        //! Header of a segment.
+        struct Header
+        {
+            //! Magic string.
+            char magic[8];
+            //! archive::byte_order_mark, as written by the writer.
+            uint32_t byte_order_mark;
+            //! Layout version.
+            uint16_t version;
+            //! Size of the header.
+            uint16_t header_size;
+            //! Size of a slot (record and trajectory).
+            uint32_t slot_size;
+            //! Number of slots in the ring.
+            uint32_t nb_slots;
+            //! Maximum number of points of a trajectory.
+            uint32_t trajectory_capacity;
+            //! Reserved.
+            uint32_t reserved;
+            //! Number of runs started.
+            std::atomic<uint64_t> nb_runs;
+            //! Process id of the writer.
+            uint64_t pid;
+            //! Non zero once the writer is closed.
+            std::atomic<uint64_t> closed;
+            //! Reserved.
+            uint64_t reserved2;
+        };
+
+        //! Record of a run, at the start of a slot.
+        struct Record
+        {
+            //! Seqlock: odd while the slot is written.
+            std::atomic<uint64_t> sequence;
+            //! Run number, counted over the whole campaign.
+            uint64_t run;
+            //! Suite name.
+            char suite[name_size];
+            //! Problem name.
+            char problem[name_size];
+            //! Problem id.
+            int32_t problem_id;
+            //! Instance.
+            int32_t instance;
+            //! Dimension.
+            int32_t n_variables;
+            //! Optimization type (1: minimization, 2: maximization).
+            uint8_t optimization_type;
+            //! See live::State.
+            uint8_t state;
+            //! Reserved.
+            uint16_t reserved;
+            //! Number of evaluations at the last update.
+            uint64_t evaluations;
+            //! Best-so-far objective value.
+            double best_y;
+            //! Evaluation at which the best-so-far was found.
+            uint64_t best_evaluation;
+            //! Number of improvements (the trajectory holds at most the trajectory capacity).
+            uint64_t nb_points;
+        };
+
+        //! A point of a best-so-far trajectory.
+        struct Point
+        {
+            //! Number of evaluations.
+            uint64_t evaluations;
+            //! Best-so-far objective value.
+            double y;
+        };
+
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "The seqlocks need lock-free atomics.");
+        static_assert(sizeof(Header) == 64 and sizeof(Record) == 128 and sizeof(Point) == 16,
+                      "The layout of the segment is fixed.");
+
+        //! A consistent copy of a run.
+        struct Run
+        {
+            //! Run number, counted over the whole campaign.
+            uint64_t run;
+            //! Suite name.
+            std::string suite;
+            //! Problem name.
+            std::string problem;
+            //! Problem id.
+            int problem_id;
+            //! Instance.
+            int instance;
+            //! Dimension.
+            int n_variables;
+            //! Optimization type.
+            common::OptimizationType optimization_type;
+            //! Whether the run is finished.
+            bool finished;
+            //! Number of evaluations at the last update.
+            size_t evaluations;
+            //! Best-so-far objective value.
+            double best_y;
+            //! Evaluation at which the best-so-far was found.
+            size_t best_evaluation;
+            //! Number of improvements.
+            size_t nb_points;
+            //! Best-so-far trajectory.
+            std::vector<Point> trajectory;
+        };
+
+        namespace detail
+        {
+            //! Name of a segment, as expected by shm_open.
+            inline std::string segment_name(const std::string &name)
+            {
+                if (name.empty() or name.size() > 250 or name.find('/', 1) != std::string::npos)
+                    throw std::invalid_argument("Invalid shared memory name: " + name);
+                return name.front() == '/' ? name : "/" + name;
+            }
+
+            //! Copy a string into a fixed-size, zero padded, field.
+            inline void copy_name(char (&to)[name_size], const std::string &from)
+            {
+                std::memset(to, 0, name_size);
+                std::memcpy(to, from.data(), std::min(from.size(), name_size - 1));
+            }
+
+            [[noreturn]] inline void no_shm()
+            {
+                throw std::runtime_error("Shared memory segments are only supported on POSIX systems.");
+            }
+        } // namespace detail
+
+        /** Maps a segment written by a logger::Live, read-only.
+         *
+         * @code
+            logger::live::Reader reader("my-campaign");
+            for(const auto& run : reader.snapshot())
+                std::cout << run.problem_id << ": " << run.best_y << " after " << run.evaluations << std::endl;
+         * @endcode
+         */
+        class Reader
+        {
+            const char *data_ = nullptr;
+            size_t size_ = 0;
+
+            [[nodiscard]] const Header &header() const { return *reinterpret_cast<const Header *>(data_); }
+
+            [[nodiscard]] const char *slot(const uint64_t run) const
+            {
+                return data_ + header().header_size + (run % header().nb_slots) * header().slot_size;
+            }
+
+        public:
+            /** Map a segment.
+             *
+             * @param name Name of the segment.
+             * @throws std::runtime_error if it does not exist or is not a segment of this layout version.
+             */
+            explicit Reader(const std::string &name)
+            {
+#ifdef IOH_HAS_MMAP
+                const auto shm = detail::segment_name(name);
+                const int fd = ::shm_open(shm.c_str(), O_RDONLY, 0);
+                if (fd < 0)
+                    throw std::runtime_error("Cannot open the shared memory segment " + shm);
+                struct stat st
+                {
+                };
+                void *addr = MAP_FAILED;
+                if (::fstat(fd, &st) == 0 and static_cast<size_t>(st.st_size) >= sizeof(Header))
+                    addr = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+                ::close(fd);
+                if (addr == MAP_FAILED)
+                    throw std::runtime_error("Cannot map the shared memory segment " + shm);
+                data_ = static_cast<const char *>(addr);
+                size_ = static_cast<size_t>(st.st_size);
+
+                const auto &h = header();
+                if (std::memcmp(h.magic, magic, sizeof(magic)) != 0 or h.byte_order_mark != archive::byte_order_mark or
+                    h.version != version or h.header_size != sizeof(Header) or h.nb_slots == 0 or
+                    h.slot_size != sizeof(Record) + h.trajectory_capacity * sizeof(Point) or
+                    size_ < h.header_size + static_cast<size_t>(h.nb_slots) * h.slot_size)
+                {
+                    ::munmap(const_cast<char *>(data_), size_);
+                    throw std::runtime_error("Not a live results segment of version " + std::to_string(version) +
+                                             ": " + shm);
+                }
+#else
+                (void)name;
+                detail::no_shm();
+#endif
+            }
+
+            Reader(const Reader &) = delete;
+            Reader &operator=(const Reader &) = delete;
+
+            ~Reader()
+            {
+#ifdef IOH_HAS_MMAP
+                if (data_ != nullptr)
+                    ::munmap(const_cast<char *>(data_), size_);
+#endif
+            }
+
+            //! Number of runs started so far.
+            [[nodiscard]] size_t nb_runs() const { return header().nb_runs.load(std::memory_order_acquire); }
+
+            //! Number of runs kept in the ring.
+            [[nodiscard]] size_t nb_slots() const { return header().nb_slots; }
+
+            //! Maximum number of points of the trajectories.
+            [[nodiscard]] size_t trajectory_capacity() const { return header().trajectory_capacity; }
+
+            //! Whether the writer is closed.
+            [[nodiscard]] bool closed() const { return header().closed.load(std::memory_order_acquire) != 0; }
+
+            //! Process id of the writer.
+            [[nodiscard]] uint64_t pid() const { return header().pid; }
+
+            /** A consistent copy of a run.
+             *
+             * @return Nothing if the run has not started, or has been overwritten by a later run.
+             */
+            [[nodiscard]] std::optional<Run> run(const uint64_t id) const
+            {
+                if (id >= nb_runs())
+                    return std::nullopt;
+                const char *p = slot(id);
+                const auto &sequence = reinterpret_cast<const Record *>(p)->sequence;
+                Record record;
+                std::vector<Point> points;
+                while (true)
+                {
+                    const auto before = sequence.load(std::memory_order_acquire);
+                    if (before % 2 == 0)
+                    {
+                        std::memcpy(static_cast<void *>(&record), p, sizeof(Record));
+                        const auto n = std::min<uint64_t>(record.nb_points, header().trajectory_capacity);
+                        points.resize(n);
+                        std::memcpy(static_cast<void *>(points.data()), p + sizeof(Record), n * sizeof(Point));
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        if (sequence.load(std::memory_order_relaxed) == before)
+                            break;
+                    }
+                    std::this_thread::yield();
+                }
+                if (record.run != id)
+                    return std::nullopt;
+                return Run{record.run,
+                           std::string(record.suite, strnlen(record.suite, name_size)),
+                           std::string(record.problem, strnlen(record.problem, name_size)),
+                           record.problem_id,
+                           record.instance,
+                           record.n_variables,
+                           record.optimization_type == 2 ? common::OptimizationType::Maximization
+                                                         : common::OptimizationType::Minimization,
+                           record.state == static_cast<uint8_t>(State::Finished),
+                           static_cast<size_t>(record.evaluations),
+                           record.best_y,
+                           static_cast<size_t>(record.best_evaluation),
+                           static_cast<size_t>(record.nb_points),
+                           std::move(points)};
+            }
+
+            //! Consistent copies of the runs still in the ring, in order.
+            [[nodiscard]] std::vector<Run> snapshot() const
+            {
+                std::vector<Run> runs;
+                const uint64_t n = nb_runs();
+                for (uint64_t id = n > header().nb_slots ? n - header().nb_slots : 0; id < n; ++id)
+                    if (auto r = run(id))
+                        runs.push_back(std::move(r.value()));
+                return runs;
+            }
+        };
+    } // namespace live
+
+    /** A logger publishing the best-so-far trajectory and a summary of each run in shared memory.
+     *
+     * Other processes can follow a running campaign by mapping the segment read-only (see live::Reader,
+     * or ioh.live in Python), without parsing files that are being written.
+     * The number of evaluations of the current run is published at each evaluation,
+     * its trajectory at each improvement.
+     * The segment keeps the last `nb_slots` runs, see logger::live for its layout.
+     *
+     * @code
+        logger::Live live("my-campaign");
+        suite.attach_logger(live);
+        // Meanwhile, in another process:
+        logger::live::Reader reader("my-campaign");
+        auto runs = reader.snapshot();
+     * @endcode
+     *
+     * @ingroup Logging
+     */
+    class Live : public Logger
+    {
+    protected:
+        //! Detects the improvements, which are added to the trajectory (the logger itself sees every evaluation).
+        trigger::OnImprovement on_improvement_;
+
+        //! Default property, the Logger requires at least one.
+        watch::TransformedYBest transformed_y_best_{"transformed_y_best"};
+
+        //! Name of the segment.
+        std::string name_;
+
+        //! Whether to remove the segment when the logger is closed.
+        bool unlink_;
+
+        //! The mapped segment.
+        char *data_ = nullptr;
+
+        //! Its size.
+        size_t size_ = 0;
+
+        //! The suite name.
+        std::string suite_ = "unknown_suite";
+
+        //! The record of the current run, if any.
+        live::Record *record_ = nullptr;
+
+        [[nodiscard]] live::Header &header() { return *reinterpret_cast<live::Header *>(data_); }
+
+        //! Make the current record odd, before updating it.
+        void begin_write()
+        {
+            record_->sequence.store(record_->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        //! Make the current record even, publishing the update.
+        void end_write()
+        {
+            record_->sequence.store(record_->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        //! Mark the current run as finished.
+        void finish()
+        {
+            if (record_ == nullptr)
+                return;
+            begin_write();
+            record_->state = static_cast<uint8_t>(live::State::Finished);
+            end_write();
+            record_ = nullptr;
+        }
+
+        //! Start a new run in the next slot of the ring, at its first event, so that empty runs are not published.
+        void start()
+        {
+            const auto &problem = *problem_;
+            auto &h = header();
+            const auto run = h.nb_runs.load(std::memory_order_relaxed);
+            record_ = reinterpret_cast<live::Record *>(data_ + h.header_size + (run % h.nb_slots) * h.slot_size);
+            begin_write();
+            record_->run = run;
+            live::detail::copy_name(record_->suite, suite_);
+            live::detail::copy_name(record_->problem, problem.name);
+            record_->problem_id = problem.problem_id;
+            record_->instance = problem.instance;
+            record_->n_variables = problem.n_variables;
+            record_->optimization_type =
+                problem.optimization_type == common::OptimizationType::Minimization ? 1 : 2;
+            record_->state = static_cast<uint8_t>(live::State::Running);
+            record_->evaluations = 0;
+            record_->best_y = problem.initial_objective_value;
+            record_->best_evaluation = 0;
+            record_->nb_points = 0;
+            end_write();
+            h.nb_runs.store(run + 1, std::memory_order_release);
+            on_improvement_.reset();
+        }
+
+    public:
+        /** Create the segment.
+         *
+         * @param name Name of the shared memory segment, replaced if it exists.
+         * @param nb_slots Number of runs kept in the segment, the oldest ones being overwritten.
+         * @param trajectory_capacity Maximum number of points of the trajectories.
+         * @param unlink Whether to remove the segment when the logger is closed
+         * (readers which mapped it can still read it).
+         *
+         * @throws std::runtime_error if the segment cannot be created.
+         */
+        explicit Live(const std::string &name, const size_t nb_slots = 1024, const size_t trajectory_capacity = 256,
+                      const bool unlink = true) :
+            Logger(), name_(live::detail::segment_name(name)), unlink_(unlink)
+        {
+            // Do not use the Logger's constructor, to avoid passing references to uninitialized members.
+            trigger(trigger::always);
+            add_property(transformed_y_best_);
+
+            if (nb_slots == 0 or nb_slots > std::numeric_limits<uint32_t>::max() or
+                trajectory_capacity > std::numeric_limits<uint32_t>::max() / sizeof(live::Point))
+                throw std::invalid_argument("Invalid number of slots or trajectory capacity.");
+#ifdef IOH_HAS_MMAP
+            const size_t slot_size = sizeof(live::Record) + trajectory_capacity * sizeof(live::Point);
+            size_ = sizeof(live::Header) + nb_slots * slot_size;
+            const int fd = ::shm_open(name_.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+            if (fd < 0)
+                throw std::runtime_error("Cannot create the shared memory segment " + name_);
+            void *addr = MAP_FAILED;
+            if (::ftruncate(fd, static_cast<off_t>(size_)) == 0)
+                addr = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (addr == MAP_FAILED)
+            {
+                ::shm_unlink(name_.c_str());
+                throw std::runtime_error("Cannot map the shared memory segment " + name_);
+            }
+            data_ = static_cast<char *>(addr); // Zero filled.
+
+            auto &h = header();
+            std::memcpy(h.magic, live::magic, sizeof(live::magic));
+            h.byte_order_mark = archive::byte_order_mark;
+            h.version = live::version;
+            h.header_size = sizeof(live::Header);
+            h.slot_size = static_cast<uint32_t>(slot_size);
+            h.nb_slots = static_cast<uint32_t>(nb_slots);
+            h.trajectory_capacity = static_cast<uint32_t>(trajectory_capacity);
+            h.pid = static_cast<uint64_t>(::getpid());
+            IOH_DBG(debug, "publish live results in " << name_)
+#else
+            (void)trajectory_capacity;
+            live::detail::no_shm();
+#endif
+        }
+
+        Live(const Live &) = delete;
+        Live &operator=(const Live &) = delete;
+
+        //! Name of the segment.
+        [[nodiscard]] std::string name() const { return name_; }
+
+        void attach_suite(const std::string &suite_name) override { suite_ = suite_name; }
+
+        //! Finish the previous run, if the problem was not reset.
+        void attach_problem(const problem::MetaData &problem) override
+        {
+            finish();
+            Logger::attach_problem(problem);
+        }
+
+        //! Publish the number of evaluations, and the best point if it has improved.
+        void call(const logger::Info &log_info) override
+        {
+            if (data_ == nullptr)
+                return;
+            if (record_ == nullptr)
+                start();
+            const bool improved = on_improvement_(log_info, *problem_);
+            begin_write();
+            record_->evaluations = log_info.evaluations;
+            if (improved)
+            {
+                record_->best_y = log_info.transformed_y_best;
+                record_->best_evaluation = log_info.evaluations;
+                const auto capacity = header().trajectory_capacity;
+                if (capacity > 0)
+                {
+                    auto *points = reinterpret_cast<live::Point *>(record_ + 1);
+                    points[std::min<uint64_t>(record_->nb_points, capacity - 1)] = {log_info.evaluations,
+                                                                                    log_info.transformed_y_best};
+                }
+                record_->nb_points++;
+            }
+            end_write();
+        }
+
+        //! Publish the end of the run.
+        void reset() override
+        {
+            finish();
+            Logger::reset();
+        }
+
+        //! Publish the end of the last run, mark the segment as closed, and remove it if asked to.
+        void close() override
+        {
+            if (data_ == nullptr)
+                return;
+            finish();
+            header().closed.store(1, std::memory_order_release);
+#ifdef IOH_HAS_MMAP
+            ::munmap(data_, size_);
+            if (unlink_)
+                ::shm_unlink(name_.c_str());
+#endif
+            data_ = nullptr;
+            IOH_DBG(debug, "closed live results " << name_)
+        }
+
+        virtual ~Live() { close(); }
+    };
+} // namespace ioh::logger
@@ -1,10 +1,82 @@
 #pragma once
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
 #include "triggers.hpp"
 #include "properties.hpp"
 
 namespace ioh {
 
+    namespace logger {
+
+        /** The last evaluation of a run, which a problem hands over to its logger.
+         *
+         * The triggers may skip the last evaluations of a run, so the logger reads it here when the run ends
+         * (see Logger::last_info). The problem and the logger share it, as either may be destroyed first:
+         * while the problem is attached, `refresh` copies its current evaluation, and a destroyed problem leaves
+         * its last one in `info`.
+         */
+        struct Handover
+        {
+            //! Copy the current evaluation of the problem in `info`, empty once the problem is gone.
+            std::function<void(StoredInfo &)> refresh;
+
+            //! The last evaluation, none if its evaluations are 0.
+            StoredInfo info;
+        };
+
+        /** The side of a Handover kept by the problem.
+         *
+         * A copy or a move of the problem does not hand anything over until it is attached itself,
+         * as `refresh` refers to the original problem.
+         */
+        class Handoff
+        {
+            std::shared_ptr<Handover> handover_;
+
+        public:
+            Handoff() = default;
+
+            Handoff(const Handoff &) {}
+
+            Handoff &operator=(const Handoff &) { return *this; }
+
+            //! Hand over the evaluations given by `refresh` to a new logger, and the last one to the previous.
+            std::shared_ptr<Handover> open(std::function<void(StoredInfo &)> refresh)
+            {
+                release();
+                handover_ = std::make_shared<Handover>();
+                handover_->refresh = std::move(refresh);
+                return handover_;
+            }
+
+            //! Leave the last evaluation to the logger, which may still have to write it.
+            void release()
+            {
+                if (handover_ != nullptr and handover_->refresh)
+                {
+                    handover_->refresh(handover_->info);
+                    handover_->refresh = nullptr;
+                }
+                handover_.reset();
+            }
+
+            //! Stop handing over, the logger having ended the run.
+            void close()
+            {
+                if (handover_ != nullptr)
+                {
+                    handover_->refresh = nullptr;
+                    handover_->info.evaluations = 0;
+                }
+                handover_.reset();
+            }
+        };
+    } // namespace logger
 
     // This is out of the logger namespace, to avoid name repetition.
     /** Interface of loggers.
@@ -21,21 +93,50 @@ namespace ioh {
      * If you need to handle any property, consider sub-classing logger::Watcher.
      * 
      * If not, the design enforces your subclass to declare which property it needs.
-     * Then, you can easily access them by their name through `_properties.at("name")`.
+     * Each property is interned to a small integer id (its rank of insertion, see `property_id`),
+     * and `gather(log_info)` computes the values of all the properties at once in the flat `values_` array,
+     * so that `call` does not need to access properties by their name.
      * 
      * @ingroup Logging
      */
     class Logger {
     protected:
+        //! Clones of the stateful triggers given to this logger (see logger::Trigger::clone).
+        std::vector<std::shared_ptr<logger::Trigger>> owned_triggers_;
+
         //! Default combination of triggers instance.
         trigger::Any any_;
         
-        //! Lower-level interface.
-        trigger::Set& triggers_;
+        //! Lower-level interface, either `any_` or a clone of the set given at construction.
+        trigger::Set* triggers_;
 
         //! Access to the problem.
         const problem::MetaData* problem_;
 
+        /** Number of evaluations before which no trigger can fire, unless the best value improves.
+         *
+         * Updated after each call to `log`, from logger::Trigger::next.
+         * Zero means that the logger needs to see the next evaluation.
+         */
+        size_t next_evaluation_;
+
+        //! The last evaluation of the attached problem, see `last_info`.
+        std::shared_ptr<logger::Handover> handover_;
+
+        /** The last evaluation of the attached problem, which the triggers may have skipped, or nullptr.
+         *
+         * To be read when the run ends: on `reset` (before the problem resets its state), on `attach_problem`
+         * (for the previous problem), and on `close`. Its evaluations are 0 if the run has already ended.
+         */
+        const logger::Info *last_info()
+        {
+            if (handover_ == nullptr)
+                return nullptr;
+            if (handover_->refresh)
+                handover_->refresh(handover_->info);
+            return &handover_->info;
+        }
+
         /** Map property names to property references.
          * 
          * If your logger is handling any property, you can just iterate over them,
@@ -62,9 +163,14 @@ namespace ioh {
         // As all share a common interface, we can have a container of references of this base class.
         std::map<std::string,std::reference_wrapper<logger::Property>> properties_;
         
-        //! A vector with all the properties
+        //! A vector with all the properties, indexed by property id.
         logger::Properties properties_vector_{}; 
-        // TODO: check why we use a map here, and not a vector, with a map we cannot control order        
+
+        //! The fields accessed by built-in properties, indexed by property id.
+        std::vector<logger::Field> fields_{};
+
+        //! The values of all properties at the current log event, indexed by property id (see `gather`).
+        std::vector<std::optional<double>> values_{};
 
 #ifndef NDEBUG
         //! Check that there is no duplicated properties (only in Debug builds).
@@ -86,15 +192,86 @@ namespace ioh {
         }
 #endif
 
+        /** Add a property to the managed ones.
+         *
+         * @returns the id of the property, to be used as an index in `values_`.
+         */
+        size_t add_property(logger::Property& property)
+        {
+            // operator[] of an std::map<K,T> requires that T be default-constructible.
+            // But reference_wrapper is not.
+            // Thus, we must directly forward the reference.
+            properties_.insert_or_assign(property.name(), std::ref(property));
+            properties_vector_.push_back(property);
+            fields_.push_back(property.field());
+            values_.emplace_back();
+            return properties_vector_.size() - 1;
+        }
+
+        /** Returns the clone of the given trigger, owned by this logger, or the trigger itself if it is stateless.
+         *
+         * This way, stateful triggers (like trigger::on_improvement) can be passed to several loggers.
+         */
+        logger::Trigger& own_trigger(logger::Trigger& trigger)
+        {
+            if(auto copy = trigger.clone()) {
+                owned_triggers_.push_back(std::move(copy));
+                return *owned_triggers_.back();
+            }
+            return trigger;
+        }
+
+        //! See own_trigger.
+        logger::Triggers own_triggers(const logger::Triggers& triggers)
+        {
+            logger::Triggers owned;
+            for(const auto& t : triggers) {
+                owned.push_back(std::ref(own_trigger(t.get())));
+            }
+            return owned;
+        }
+
+        //! See own_trigger.
+        trigger::Set& own_set(trigger::Set& triggers)
+        {
+            // The clone of a set is of the same type.
+            return static_cast<trigger::Set&>(own_trigger(triggers));
+        }
+
         //! Convert a vector of properties in a map of {name => property}.
         void store_properties(std::vector<std::reference_wrapper<logger::Property>>& properties)
         {
             for(auto& p : properties) {
-                // operator[] of an std::map<K,T> requires that T be default-constructible.
-                // But reference_wrapper is not.
-                // Thus, we must directly forward the reference.
-                properties_.insert_or_assign(p.get().name(), std::ref(p.get()));
-                properties_vector_.push_back(p);
+                add_property(p.get());
+            }
+        }
+
+        /** Returns the id of the property with the given name.
+         *
+         * @note This does a lookup by name, call it once (at construction or attach time) and keep the id.
+         */
+        [[nodiscard]] size_t property_id(const std::string& name) const
+        {
+            for(size_t i = 0; i < properties_vector_.size(); ++i) {
+                if(properties_vector_[i].get().name() == name) {
+                    return i;
+                }
+            }
+            throw std::out_of_range("Property " + name + " is not managed by this logger.");
+        }
+
+        /** Computes the values of all the properties for this log event, in `values_`.
+         *
+         * Built-in properties are read directly from the logger::Info, without a virtual call.
+         */
+        void gather(const logger::Info& log_info)
+        {
+            for(size_t i = 0; i < fields_.size(); ++i) {
+                if(fields_[i] != logger::Field::none) {
+                    values_[i] = logger::field(fields_[i], log_info);
+                } else {
+                    values_[i] = properties_vector_[i].get()(log_info);
+                }
             }
         }
         
@@ -109,9 +286,11 @@ namespace ioh {
          */
         Logger(std::vector<std::reference_wrapper<logger::Trigger >> triggers,
                std::vector<std::reference_wrapper<logger::Property>> properties)
-        : any_(triggers)
-        , triggers_(any_)
+        : owned_triggers_()
+        , any_(own_triggers(triggers))
+        , triggers_(&any_)
         , problem_(nullptr)
+        , next_evaluation_(0)
         {
             //  auto ref = properties_.at("Att_PtrRef");
             //     std::cout << "ref addr " << &ref.get() << std::endl;
@@ -129,9 +308,11 @@ namespace ioh {
          */
         Logger(trigger::Set& triggers,
                std::vector<std::reference_wrapper<logger::Property>> properties               )
-        : any_()
-        , triggers_(triggers)
+        : owned_triggers_()
+        , any_()
+        , triggers_(&own_set(triggers))
         , problem_(nullptr)
+        , next_evaluation_(0)
         {
             store_properties(properties);
             assert(consistent_properties());
@@ -141,21 +322,64 @@ namespace ioh {
          * for instance if you define default triggers/properties in your constructor.
          * 
          * @note If you manage your own default triggers/properties,
-         *       use `_properties.insert_or_assign(name, std::ref(tp));`
+         *       use `add_property(tp);`
          *       instead of classical access operators.
          * 
          * Used by logger::Combine, for instance.
          */
         // _triggers needs to be a reference, because it's an interface.
         // thus we initialize it with an (empty) _any.
-        Logger() : any_(), triggers_(any_), problem_(nullptr), properties_() {}
+        Logger() : any_(), triggers_(&any_), problem_(nullptr), next_evaluation_(0), properties_() {}
+
+        /** Move a logger, which keeps managing the same triggers.
+         *
+         * Loggers cannot be copied, as the copies would share the states of their triggers.
+         */
+        Logger(Logger&& other) : Logger() { *this = std::move(other); }
+
+        //! See the move constructor.
+        Logger& operator=(Logger&& other)
+        {
+            if(this != &other) {
+                const bool any = other.triggers_ == &other.any_;
+                owned_triggers_ = std::move(other.owned_triggers_);
+                any_ = std::move(other.any_);
+                triggers_ = any ? &any_ : other.triggers_;
+                other.triggers_ = &other.any_;
+                problem_ = other.problem_;
+                next_evaluation_ = other.next_evaluation_;
+                handover_ = std::move(other.handover_);
+                properties_ = std::move(other.properties_);
+                properties_vector_ = std::move(other.properties_vector_);
+                fields_ = std::move(other.fields_);
+                values_ = std::move(other.values_);
+            }
+            return *this;
+        }
 
         /** Add the given trigger to the list. */
         void trigger(logger::Trigger& when)
         {
-            triggers_.push_back(when);
+            triggers_->push_back(own_trigger(when));
+            next_evaluation_ = 0;
         }
 
+        /** Returns true if a log event may be triggered at the given evaluation.
+         *
+         * If this returns false, calling `log` would not trigger anything and may be skipped altogether.
+         * This is the single test the Problem does before building a logger::Info.
+         *
+         * @param evaluations The current number of evaluations.
+         * @param improved Whether the best transformed value has (possibly) just improved.
+         */
+        [[nodiscard]] bool is_due(const size_t evaluations, const bool improved) const
+        {
+            return improved or evaluations >= next_evaluation_;
+        }
+
+        /** Number of evaluations before which the logger does not need to be called, unless the best value improves. */
+        [[nodiscard]] size_t next_evaluation() const { return next_evaluation_; }
+
         /** Check if the logger should be triggered and if so, call `call(log_info)`. */
         // This is virtual because logger::Combine needs to bypass the default behaviour.
         virtual void log(const logger::Info& log_info)
@@ -167,11 +391,12 @@ namespace ioh {
             }
 
             assert(properties_.size() > 0);
-            assert(triggers_.size() > 0);
-            if(triggers_(log_info, *problem_)) {
+            assert(triggers_->size() > 0);
+            if((*triggers_)(log_info, *problem_)) {
                 IOH_DBG(debug,"logger triggered")
                 call(log_info);
             }
+            next_evaluation_ = triggers_->next(log_info.evaluations);
         }
 
         /** Starts a new session for the given problem/instance/dimension/run.
@@ -185,8 +410,15 @@ namespace ioh {
         {
             IOH_DBG(xdebug,"attach problem " << problem.problem_id)
             problem_ = &problem;
+            next_evaluation_ = 0;
         }
 
+        /** Called by the problem after `attach_problem`, to hand over its last evaluations (see `last_info`).
+         *
+         * @warning If you override this function, do not forget to call the base class' one.
+         */
+        virtual void hand_over(std::shared_ptr<logger::Handover> handover) { handover_ = std::move(handover); }
+
         //! Starts a new session for the given Suite name.
         virtual void attach_suite(const std::string& suite_name) = 0;
 
@@ -202,7 +434,8 @@ namespace ioh {
         virtual void reset()
         {
             IOH_DBG(debug,"reset")
-            triggers_.reset();
+            triggers_->reset();
+            next_evaluation_ = 0;
         }
 
         //! Shutdown behaviour
@@ -251,7 +484,7 @@ namespace ioh {
              * for instance if you define default triggers/properties in your own constructor.
              * 
              * @note If you manage your own default triggers/properties,
-             *       use `_properties.insert_or_assign(name, std::ref(tp));`
+             *       use `add_property(tp);`
              *       instead of classical access operators.
              */
              Watcher() : Logger() { }
@@ -265,8 +498,7 @@ namespace ioh {
                 assert(std::find_if(std::begin(properties_),std::end(properties_),
                                     [&property](const auto rwp){return property.name() == rwp.second.get().name();}
                                    ) == std::end(properties_));
-                properties_.insert_or_assign(property.name(), property);
-                properties_vector_.push_back(property);
+                add_property(property);
                 assert(consistent_properties()); // Double check duplicates, in case the code above would be changed.
             }
 
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <iterator>
+#include <limits>
 #include <stdexcept>
+#include <type_traits>
 
 #include "ioh/problem/structures.hpp"
 
@@ -9,6 +12,149 @@ namespace ioh {
     /** Shared structure related to loggers. */
     namespace logger {
 
+        /** A view of the variables of a solution, with their type, which the problem does not copy.
+         *
+         * Loggers storing the variables of integer problems convert them to double one at a time, only for the
+         * events they store, or format them directly with their own type.
+         *
+         * @ingroup Logging
+         */
+        class Variables
+        {
+        public:
+            //! Type of the variables.
+            enum class Type : uint8_t
+            {
+                Real,
+                Integer
+            };
+
+            //! Iterator over the variables, converted to double.
+            class const_iterator
+            {
+                const Variables *variables_ = nullptr;
+                size_t i_ = 0;
+
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type = double;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = double;
+
+                const_iterator() = default;
+
+                //! Iterator at the i-th variable.
+                const_iterator(const Variables *variables, const size_t i) : variables_(variables), i_(i) {}
+
+                double operator*() const { return (*variables_)[i_]; }
+                double operator[](const difference_type n) const { return *(*this + n); }
+                const_iterator &operator++() { ++i_; return *this; }
+                const_iterator operator++(int) { auto it = *this; ++i_; return it; }
+                const_iterator &operator--() { --i_; return *this; }
+                const_iterator operator--(int) { auto it = *this; --i_; return it; }
+                const_iterator &operator+=(const difference_type n) { i_ = static_cast<size_t>(static_cast<difference_type>(i_) + n); return *this; }
+                const_iterator &operator-=(const difference_type n) { return *this += -n; }
+                const_iterator operator+(const difference_type n) const { auto it = *this; return it += n; }
+                const_iterator operator-(const difference_type n) const { auto it = *this; return it -= n; }
+                difference_type operator-(const const_iterator &other) const
+                {
+                    return static_cast<difference_type>(i_) - static_cast<difference_type>(other.i_);
+                }
+                bool operator==(const const_iterator &other) const { return i_ == other.i_; }
+                bool operator!=(const const_iterator &other) const { return i_ != other.i_; }
+                bool operator<(const const_iterator &other) const { return i_ < other.i_; }
+                bool operator>(const const_iterator &other) const { return i_ > other.i_; }
+                bool operator<=(const const_iterator &other) const { return i_ <= other.i_; }
+                bool operator>=(const const_iterator &other) const { return i_ >= other.i_; }
+            };
+
+        private:
+            const void *data_ = nullptr;
+            size_t size_ = 0;
+            Type type_ = Type::Real;
+
+        public:
+            //! No variables.
+            Variables() = default;
+
+            //! View real variables.
+            Variables(const double *data, const size_t size) : data_(data), size_(size), type_(Type::Real) {}
+
+            //! View integer variables.
+            Variables(const int *data, const size_t size) : data_(data), size_(size), type_(Type::Integer) {}
+
+            //! View the variables of a vector, which must outlive the view.
+            template <typename T, typename = std::enable_if_t<std::is_same_v<T, double> or std::is_same_v<T, int>>>
+            Variables(const std::vector<T> &x) : Variables(x.data(), x.size())
+            {
+            }
+
+            //! A temporary vector would not outlive the view.
+            template <typename T>
+            Variables(const std::vector<T> &&) = delete;
+
+            //! Number of variables.
+            [[nodiscard]] size_t size() const { return size_; }
+
+            //! Whether there are no variables.
+            [[nodiscard]] bool empty() const { return size_ == 0; }
+
+            //! Type of the variables.
+            [[nodiscard]] Type type() const { return type_; }
+
+            //! The i-th variable, converted to double.
+            [[nodiscard]] double operator[](const size_t i) const
+            {
+                return type_ == Type::Real ? static_cast<const double *>(data_)[i]
+                                           : static_cast<double>(static_cast<const int *>(data_)[i]);
+            }
+
+            //! Start of the variables, converted to double.
+            [[nodiscard]] const_iterator begin() const { return {this, 0}; }
+
+            //! End of the variables.
+            [[nodiscard]] const_iterator end() const { return {this, size_}; }
+
+            /** Call f with a pointer to the variables, of their own type, and their number, so that loops over
+             * the variables do not test their type.
+             */
+            template <typename F>
+            decltype(auto) visit(F &&f) const
+            {
+                if (type_ == Type::Real)
+                    return f(static_cast<const double *>(data_), size_);
+                return f(static_cast<const int *>(data_), size_);
+            }
+
+            //! Copy the variables, converted to double, reusing the memory of x.
+            void copy_to(std::vector<double> &x) const
+            {
+                visit([&x](const auto *data, const size_t size) { x.assign(data, data + size); });
+            }
+
+            //! The variables, converted to double.
+            [[nodiscard]] std::vector<double> as_double() const
+            {
+                std::vector<double> x;
+                copy_to(x);
+                return x;
+            }
+        };
+
+        /** A solution viewed by the log info: its variables, of the type of the problem, and its objective value.
+         *
+         * @ingroup Logging
+         */
+        struct SolutionView
+        {
+            //! The variables of the solution, owned by the problem.
+            Variables x;
+
+            //! The objective value of the solution.
+            double y = std::numeric_limits<double>::quiet_NaN();
+        };
+
         /** Information about the current log.
          * 
          * @note The properties for bests values holds a state since the first start or the last call to reset.
@@ -34,13 +180,56 @@ namespace ioh {
             //! The current best transformed objective function value (since the last reset).
             double transformed_y_best;
             
-            //! Currently considered solution with the corresponding transformed objective function value.
-            problem::Solution<double> current;
+            /** Currently considered solution with the corresponding transformed objective function value.
+             *
+             * Its variables are a view of those of the problem, valid until its next evaluation.
+             */
+            SolutionView current;
             
             //! Optimum to the current problem instance, with the corresponding transformed objective function value.
             problem::Solution<double> optimum; // was objective
         };
 
+        /** A log info which owns the variables of its current solution, converted to double.
+         *
+         * Used to keep a log info after the problem evaluated other solutions, and to replay stored data.
+         *
+         * @ingroup Logging
+         */
+        struct StoredInfo : Info
+        {
+            //! The variables viewed by current.x.
+            std::vector<double> x;
+
+            StoredInfo() = default;
+
+            //! Copy a log info, and its variables.
+            explicit StoredInfo(const Info &info) { *this = info; }
+
+            StoredInfo(const StoredInfo &other) : StoredInfo(static_cast<const Info &>(other)) {}
+
+            StoredInfo &operator=(const StoredInfo &other) { return *this = static_cast<const Info &>(other); }
+
+            //! Copy a log info, and its variables, reusing the memory of x.
+            StoredInfo &operator=(const Info &info)
+            {
+                if (&info != this)
+                {
+                    Info::operator=(info);
+                    info.current.x.copy_to(x);
+                    current.x = x;
+                }
+                return *this;
+            }
+
+            //! Set the number of variables, to 0, and view them.
+            void resize(const size_t n_variables)
+            {
+                x.assign(n_variables, 0.);
+                current.x = x;
+            }
+        };
+
     } // log
 } // ioh
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cassert>
+#include <limits>
 #include <optional>
 
 #include "loginfo.hpp"
@@ -22,6 +24,11 @@ namespace ioh
          *       The functions are templated so that you don't need to do the casting by yourself,
          *       but it is nonetheless mandatory.
          *
+         * @note Properties do not manage any state (their call interface is `const`),
+         *       so that the convenience instances (like watch::evaluations) can be shared by several loggers,
+         *       including loggers used concurrently in different threads.
+         *       Watching a variable which is modified by another thread is your responsibility.
+         *
          * For example:
          * @code
                 double my_algo_parameter = 42;
@@ -54,6 +61,50 @@ namespace ioh
          * @ingroup Loggers
          */
 
+        /** Fields of logger::Info that are directly accessed by the built-in properties.
+         *
+         * Loggers read those fields without going through the virtual call interface of the Property
+         * (see logger::field and Logger::gather).
+         *
+         * @warning If you derive from a built-in property to override its call interface,
+         *          pass `Field::none` to the logger::Property constructor, or your override will be bypassed.
+         *
+         * @ingroup Logging
+         */
+        enum class Field
+        {
+            none, //!< Not a built-in property, use the call interface.
+            evaluations,
+            raw_y_best,
+            current_y,
+            transformed_y,
+            transformed_y_best
+        };
+
+        /** Non-virtual access to a field of logger::Info.
+         *
+         * @ingroup Logging
+         */
+        inline double field(const Field f, const logger::Info &log_info)
+        {
+            switch (f)
+            {
+            case Field::evaluations:
+                return static_cast<double>(log_info.evaluations);
+            case Field::raw_y_best:
+                return log_info.raw_y_best;
+            case Field::current_y:
+                return log_info.current.y;
+            case Field::transformed_y:
+                return log_info.transformed_y;
+            case Field::transformed_y_best:
+                return log_info.transformed_y_best;
+            default:
+                assert(false);
+                return std::numeric_limits<double>::signaling_NaN();
+            }
+        }
+
         /** Interface for callbacks toward variable to be logged.
          *
          * A class that inherit this interface
@@ -71,9 +122,13 @@ namespace ioh
             //! format specification for fmt
             const std::string format_;
 
+            //! Field of logger::Info accessed by a built-in property.
+            const Field field_;
+
         public:
             //! Constructor.
-            Property(const std::string &name, const std::string &format = "{:f}") : name_(name), format_(format)
+            Property(const std::string &name, const std::string &format = "{:f}", const Field field = Field::none) :
+                name_(name), format_(format), field_(field)
             {
                 assert(!name_.empty());
             }
@@ -98,6 +153,9 @@ namespace ioh
             //! Configured format accessor.
             std::string format() const { return format_; }
 
+            //! Accessed field, if this is a built-in property.
+            Field field() const { return field_; }
+
             //! Destructor.
             virtual ~Property() = default;
 
@@ -110,9 +168,19 @@ namespace ioh
             [[nodiscard]] virtual std::string call_to_string(const logger::Info &log_info,
                                                              const std::string &nan = "") const
             {
-                auto opt = (*this)(log_info);
-                if (opt)
-                    return fmt::format(format(), opt.value());
+                return to_string((*this)(log_info), nan);
+            }
+
+            /**
+             * \brief Method to format an already gathered value of this property
+             * \param value The value of the property.
+             * \param nan The value to log when there is no data.
+             * \return a string representation of the value
+             */
+            [[nodiscard]] std::string to_string(const std::optional<double> &value, const std::string &nan = "") const
+            {
+                if (value)
+                    return fmt::format(format_, value.value());
                 return nan;
             }
         };
@@ -135,7 +203,7 @@ namespace ioh
         {
             //! Constructor.
             Evaluations(const std::string name = "evaluations", const std::string &format = "{:g}") :
-                logger::Property(name, format)
+                logger::Property(name, format, logger::Field::evaluations)
             {
             }
             //! Main call interface.
@@ -159,7 +227,7 @@ namespace ioh
         {
             //! Constructor.
             RawYBest(const std::string name = "raw_y_best", const std::string &format = "{:f}") :
-                logger::Property(name, format)
+                logger::Property(name, format, logger::Field::raw_y_best)
             {
             }
             //! Main call interface.
@@ -183,7 +251,7 @@ namespace ioh
             //! Constructor.
             //! Main call interface.
             CurrentY(const std::string name = "current_y", const std::string &format = "{:f}") :
-                logger::Property(name, format)
+                logger::Property(name, format, logger::Field::current_y)
             {
             }
             std::optional<double> operator()(const logger::Info &log_info) const override
@@ -206,7 +274,7 @@ namespace ioh
             //! Constructor.
             //! Main call interface.
             TransformedY(const std::string name = "transformed_y", const std::string &format = "{:f}") :
-                logger::Property(name, format)
+                logger::Property(name, format, logger::Field::transformed_y)
             {
             }
             std::optional<double> operator()(const logger::Info &log_info) const override
@@ -227,7 +295,7 @@ namespace ioh
         {
             //! Constructor.
             TransformedYBest(const std::string name = "transformed_y_best", const std::string &format = "{:f}") :
-                logger::Property(name, format)
+                logger::Property(name, format, logger::Field::transformed_y_best)
             {
             }
             //! Main call interface.
@@ -0,0 +1,366 @@
+#pragma once
+
+#include <deque>
+#include <fstream>
+
+#include "ioh/common/file.hpp"
+#include "ioh/logger/archive.hpp"
+#include "ioh/logger/loggers.hpp"
+
+namespace ioh::logger
+{
+    /** Record the stream of logger::Info events of a campaign, to replay it later through other loggers.
+     *
+     * The recording is a flat sequence of binary records, in native byte order:
+     * - header: magic string (8 bytes), byte order mark (u32), format version (u16), has positions (u8),
+     * - suite: tag, name (u32 size then bytes),
+     * - problem: tag, problem id (i32), instance (i32), dimension (i32), optimization type (u8), name,
+     * - optimum: tag, objective value (f64) [, variables (dimension × f64)],
+     * - event: tag, evaluations (u64), raw best, transformed, transformed best, current objective values (4 × f64)
+     *   [, variables (dimension × f64)],
+     * - reset: tag, has state (u8) [, the event payload of the last state of the run].
+     *
+     * @ingroup Logging
+     */
+    namespace recorder
+    {
+        //! Magic string at the start of a recording.
+        inline constexpr char magic[8] = {'I', 'O', 'H', 'R', 'E', 'C', 'R', 'D'};
+
+        //! Version of the format.
+        inline constexpr uint16_t version = 1;
+
+        //! Type of a record.
+        enum class Tag : uint8_t
+        {
+            Suite = 1,
+            Problem = 2,
+            Optimum = 3,
+            Event = 4,
+            Reset = 5
+        };
+    } // namespace recorder
+
+    /** A logger that records every event it is triggered on in a compact binary file.
+     *
+     * Choosing loggers after the fact (an EAH with other buckets, a FlatFile with other triggers, ...)
+     * then does not need to run the optimization again: see logger::Replayer.
+     *
+     * The default trigger records every evaluation. With sparser triggers,
+     * the loggers fed by the replay can only see the recorded evaluations (and the last one of each run).
+     *
+     * @code
+        logger::Recorder recorder("campaign.iohrec");
+        suite.attach_logger(recorder);
+        // ... run the algorithm, then later:
+        logger::EAH eah(0, 1e8, 100, 0, 10000, 100);
+        logger::Replayer("campaign.iohrec").replay(eah);
+     * @endcode
+     *
+     * @ingroup Logging
+     */
+    class Recorder : public Logger
+    {
+    protected:
+        //! Default trigger.
+        trigger::Always always_;
+
+        //! Default property, the Logger requires at least one.
+        watch::Evaluations evaluations_{"evaluations"};
+
+        //! The recording.
+        std::ofstream out_;
+
+        //! Records not written yet.
+        std::string buffer_;
+
+        //! Whether to record the variables.
+        bool store_positions_;
+
+        //! Whether the optimum of the current problem has been recorded.
+        bool has_optimum_;
+
+        //! Last Info seen by log(), which the problem updates before a reset.
+        const logger::Info *last_info_;
+
+        //! Write the buffer to the file once it gets this large.
+        static constexpr size_t flush_size = 1 << 20;
+
+        //! Append a value to the buffer.
+        template <class T>
+        void put(const T value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            buffer_.append(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        //! Append a string, preceded by its size.
+        void put(const std::string &s)
+        {
+            put(static_cast<uint32_t>(s.size()));
+            buffer_.append(s);
+        }
+
+        //! Append variables, if they are recorded, as doubles.
+        void put_positions(const logger::Variables &x)
+        {
+            if (store_positions_)
+            {
+                assert(x.size() == static_cast<size_t>(problem_->n_variables));
+                x.visit([this](const auto *data, const size_t size) {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(*data)>, double>)
+                        buffer_.append(reinterpret_cast<const char *>(data), size * sizeof(double));
+                    else
+                        for (size_t i = 0; i < size; ++i)
+                            put(static_cast<double>(data[i]));
+                });
+            }
+        }
+
+        //! Append the payload of an event.
+        void put_state(const logger::Info &info)
+        {
+            put(static_cast<uint64_t>(info.evaluations));
+            put(info.raw_y_best);
+            put(info.transformed_y);
+            put(info.transformed_y_best);
+            put(info.current.y);
+            put_positions(info.current.x);
+        }
+
+        //! Write the buffer if it is large enough.
+        void flush_if_full()
+        {
+            if (buffer_.size() >= flush_size)
+                flush();
+        }
+
+    public:
+        /** Constructor.
+         *
+         * @param file The recording to write, overwritten if it exists.
+         * @param store_positions Whether to record the variables of each solution (and of the optimum).
+         */
+        explicit Recorder(const fs::path &file, const bool store_positions = false) :
+            Logger(), out_(file, std::ios::binary), store_positions_(store_positions), has_optimum_(false),
+            last_info_(nullptr)
+        {
+            if (not out_)
+                throw std::runtime_error("Cannot write the recording " + file.string());
+            // Do not use the Logger's constructor, to avoid passing references to uninitialized members.
+            trigger(always_);
+            add_property(evaluations_);
+
+            buffer_.reserve(flush_size + 4096);
+            buffer_.append(recorder::magic, sizeof(recorder::magic));
+            put(archive::byte_order_mark);
+            put(recorder::version);
+            put(static_cast<uint8_t>(store_positions_));
+        }
+
+        //! Whether the variables are recorded.
+        [[nodiscard]] bool store_positions() const { return store_positions_; }
+
+        //! Record the suite name.
+        void attach_suite(const std::string &suite_name) override
+        {
+            put(recorder::Tag::Suite);
+            put(suite_name);
+        }
+
+        //! Record the start of a run.
+        void attach_problem(const problem::MetaData &problem) override
+        {
+            Logger::attach_problem(problem);
+            put(recorder::Tag::Problem);
+            put(static_cast<int32_t>(problem.problem_id));
+            put(static_cast<int32_t>(problem.instance));
+            put(static_cast<int32_t>(problem.n_variables));
+            put(static_cast<uint8_t>(problem.optimization_type == common::OptimizationType::Minimization ? 1 : 2));
+            put(problem.name);
+            has_optimum_ = false;
+            last_info_ = nullptr;
+        }
+
+        //! Keep track of the problem's log info, in order to record the last state of the run.
+        void log(const logger::Info &log_info) override
+        {
+            last_info_ = &log_info;
+            Logger::log(log_info);
+        }
+
+        //! Record an event.
+        void call(const logger::Info &log_info) override
+        {
+            if (not has_optimum_)
+            {
+                put(recorder::Tag::Optimum);
+                put(log_info.optimum.y);
+                put_positions(log_info.optimum.x);
+                has_optimum_ = true;
+            }
+            put(recorder::Tag::Event);
+            put_state(log_info);
+            flush_if_full();
+        }
+
+        //! Record the end of a run, with its last state.
+        void reset() override
+        {
+            put(recorder::Tag::Reset);
+            put(static_cast<uint8_t>(last_info_ != nullptr));
+            if (last_info_ != nullptr)
+                put_state(*last_info_);
+            last_info_ = nullptr;
+            Logger::reset();
+            flush_if_full();
+        }
+
+        //! Write the pending records.
+        void flush()
+        {
+            out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            buffer_.clear();
+        }
+
+        //! Write the pending records and close the file.
+        void close() override
+        {
+            if (out_.is_open())
+            {
+                flush();
+                IOH_DBG(debug, "close recording")
+                out_.close();
+            }
+        }
+
+        virtual ~Recorder() { close(); }
+    };
+
+    /** Replay a recording made by a logger::Recorder through any logger.
+     *
+     * The loggers see the same sequence of calls as if they were attached to the problems
+     * (attach_suite, attach_problem, log, reset), without evaluating anything.
+     * As the problems do, the replay skips the events for which the logger is not due (see Logger::is_due).
+     *
+     * The replayer owns the problems' meta data that the loggers refer to,
+     * so it should outlive the use of the replayed loggers' `problem()`.
+     *
+     * @ingroup Logging
+     */
+    class Replayer
+    {
+        //! The recording.
+        common::file::MappedFile file_;
+
+        //! Whether the variables were recorded.
+        bool store_positions_;
+
+        //! Where the records start.
+        size_t start_;
+
+        //! The problems attached so far, which the loggers refer to.
+        std::deque<problem::MetaData> problems_;
+
+        //! Read the payload of an event.
+        void get_state(archive::detail::Cursor &in, logger::StoredInfo &info) const
+        {
+            info.evaluations = static_cast<size_t>(in.get<uint64_t>());
+            info.raw_y_best = in.get<double>();
+            info.transformed_y = in.get<double>();
+            info.transformed_y_best = in.get<double>();
+            info.current.y = in.get<double>();
+            get_positions(in, info.x);
+        }
+
+        //! Read variables, if they were recorded.
+        void get_positions(archive::detail::Cursor &in, std::vector<double> &x) const
+        {
+            if (store_positions_)
+                std::memcpy(x.data(), in.skip(x.size() * sizeof(double)), x.size() * sizeof(double));
+        }
+
+    public:
+        /** Open a recording.
+         *
+         * @throws std::runtime_error if the file is not a recording of this version.
+         */
+        explicit Replayer(const fs::path &file) : file_(file), store_positions_(false), start_(0)
+        {
+            archive::detail::Cursor in(file_.data(), file_.data() + file_.size());
+            if (file_.size() < sizeof(recorder::magic) or
+                std::memcmp(in.skip(sizeof(recorder::magic)), recorder::magic, sizeof(recorder::magic)) != 0)
+                throw std::runtime_error(file.string() + " is not a recording.");
+            if (in.get<uint32_t>() != archive::byte_order_mark)
+                throw std::runtime_error(file.string() + " has been recorded with another byte order.");
+            if (const auto v = in.get<uint16_t>(); v != recorder::version)
+                throw std::runtime_error(fmt::format("{} has format version {}, not {}.", file.string(), v,
+                                                     recorder::version));
+            store_positions_ = in.get<uint8_t>() != 0;
+            start_ = sizeof(recorder::magic) + sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint8_t);
+        }
+
+        //! Whether the variables were recorded.
+        [[nodiscard]] bool store_positions() const { return store_positions_; }
+
+        /** Feed the whole recording to a logger (which may be a logger::Combine).
+         *
+         * @throws std::runtime_error if the recording is truncated or corrupted.
+         */
+        void replay(Logger &logger)
+        {
+            archive::detail::Cursor in(file_.data() + start_, file_.data() + file_.size());
+            logger::StoredInfo info{};
+            // As a problem, hands over the last state of each run to the logger.
+            logger::Handoff handoff;
+            double previous_best = 0;
+            bool started = false;
+            while (not in.done())
+            {
+                switch (static_cast<recorder::Tag>(in.get<uint8_t>()))
+                {
+                case recorder::Tag::Suite:
+                    logger.attach_suite(in.get_string());
+                    break;
+                case recorder::Tag::Problem: {
+                    const auto id = in.get<int32_t>();
+                    const auto instance = in.get<int32_t>();
+                    const auto n = in.get<int32_t>();
+                    const auto type = in.get<uint8_t>() == 1 ? common::OptimizationType::Minimization
+                                                             : common::OptimizationType::Maximization;
+                    problems_.emplace_back(id, instance, in.get_string(), n, type);
+                    info.resize(static_cast<size_t>(n));
+                    info.optimum = problem::Solution<double>(n, type);
+                    started = false;
+                    logger.attach_problem(problems_.back());
+                    logger.hand_over(handoff.open([&info](logger::StoredInfo &last) { last = info; }));
+                    break;
+                }
+                case recorder::Tag::Optimum:
+                    info.optimum.y = in.get<double>();
+                    get_positions(in, info.optimum.x);
+                    break;
+                case recorder::Tag::Event: {
+                    get_state(in, info);
+                    const bool improved = not started or info.transformed_y_best != previous_best;
+                    previous_best = info.transformed_y_best;
+                    started = true;
+                    if (logger.is_due(info.evaluations, improved))
+                        logger.log(info);
+                    break;
+                }
+                case recorder::Tag::Reset:
+                    // The loggers read the last state of the run, which the problem then resets.
+                    if (in.get<uint8_t>() != 0)
+                        get_state(in, info);
+                    logger.reset();
+                    info.evaluations = 0;
+                    break;
+                default:
+                    throw std::runtime_error("Corrupted recording.");
+                }
+            }
+            handoff.release();
+        }
+    };
+} // namespace ioh::logger
@@ -1,13 +1,23 @@
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
 #include <map>
+#include <memory>
 #include <optional>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
 
+#include "ioh/common/file.hpp"
 #include "loggers.hpp"
 
 namespace ioh::logger {
     
-    /** A logger that stores all the possible information in-memory, in nested maps.
+    /** A logger that stores all the possible information in-memory, accessed as nested maps.
      * 
      * The order of the entry keys is:
      *  suite_name > problem_id > n_variables > instance > run_id > evaluation > property_name > property_value
@@ -35,6 +45,17 @@ namespace ioh::logger {
      * 
      * @note If track_suite has never been called, the default suite name is Store::default_suite ("None");
      *
+     * If a memory budget is given, the logged rows are spilled to a temporary file
+     * each time the budget is exceeded, be they of completed runs or of the current one.
+     * The spilled runs are stored row by row, as in memory, and read back from a mapping of the file,
+     * accessing them with a Cursor is thus transparent (though slower):
+     * @code
+            logger::Store store({trigger::always}, {watch::transformed_y}, 64 << 20); // At most ~64 MiB in memory.
+            // [Attach to a problem and run...]
+            std::cout << store.memory_usage() << " bytes in memory, "
+                      << store.spilled_size() << " bytes on disk" << std::endl;
+     * @endcode
+     *
      * @ingroup Loggers
      */
     class Store : public Watcher {
@@ -65,8 +86,25 @@ namespace ioh::logger {
             /** When attached directly to a Problem (out of a Suites), use the following key for the Suites map. */
             inline static const std::string default_suite = "None";
 
-            /** Direct accessor to the data structure. */
-            Suites data() {return _data;}
+            /** Direct accessor to the data structure.
+             *
+             * @note The runs are stored row by row, and the spilled runs on disk:
+             *       they are all converted to nested maps in the returned copy.
+             *       To go through the runs one at a time, use `runs()` and `run(cursor)` instead.
+             */
+            Suites data()
+            {
+                Suites all;
+                for(const auto& [key, run] : _runs) {
+                    const auto& [suite, pb, dim, ins, id] = key;
+                    Runs& into = all[suite][pb][dim][ins];
+                    into.emplace_hint(into.end(), id, materialize(run));
+                }
+                if(not _current_run.empty()) {
+                    all[_current.suite][_current.pb][_current.dim][_current.instance][_current.run] = materialize(_current_run);
+                }
+                return all;
+            }
 
             /** A set of keys leading to a set of property values within the data structure. */
             struct Cursor {
@@ -107,10 +145,53 @@ namespace ioh::logger {
                 { }
             };
 
-            /** Access a map of property values with a Cursor. */
+            /** The cursors of all the runs (at their first evaluation), in the order of the data structure. */
+            std::vector<Cursor> runs() const
+            {
+                std::vector<Cursor> cursors;
+                for(const auto& [key, run] : _runs) {
+                    const auto& [suite, pb, dim, ins, id] = key;
+                    cursors.emplace_back(suite, pb, dim, ins, id);
+                }
+                if(not _current_run.empty()) {
+                    const Key key{_current.suite, _current.pb, _current.dim, _current.instance, _current.run};
+                    const auto it = std::upper_bound(cursors.begin(), cursors.end(), key, [](const Key& k, const Cursor& c) {
+                        return k < Key{c.suite, c.pb, c.dim, c.instance, c.run};
+                    });
+                    cursors.emplace(it, _current.suite, _current.pb, _current.dim, _current.instance, _current.run);
+                }
+                return cursors;
+            }
+
+            /** Access a run with a Cursor (its evaluation being ignored).
+             *
+             * @throws std::out_of_range if there is no such run.
+             */
+            Run run(const Cursor current)
+            {
+                return materialize(stored(current));
+            }
+
+            /** Access a map of property values with a Cursor.
+             *
+             * @throws std::out_of_range if there is no such run or evaluation.
+             */
             Attributes data(const Cursor current)
             {
-                return _data.at(current.suite).at(current.pb).at(current.dim).at(current.instance).at(current.run).at(current.evaluation);
+                Attributes att;
+                const Stored& run = stored(current);
+                for(const auto& part : run.spilled) {
+                    const Rows rows(spilled_data() + part.offset);
+                    if(const size_t i = rows.find(current.evaluation); i < rows.size()) {
+                        rows.attributes(i, att);
+                        return att;
+                    }
+                }
+                if(const size_t i = run.table.find(current.evaluation); i < run.table.size()) {
+                    run.table.attributes(i, att);
+                    return att;
+                }
+                throw std::out_of_range("No such evaluation in the run.");
             }
 
             /** Access a property value with a Cursor and the property name. */
@@ -124,27 +205,484 @@ namespace ioh::logger {
             {
                 return data(current).at(property.name());
             }
+
+            /** Estimated size of the data held in memory, in bytes (the spilled runs are not counted). */
+            size_t memory_usage() const {return _memory;}
+
+            /** Size above which the logged rows are spilled to disk, in bytes (0 if unbounded). */
+            size_t memory_budget() const {return _budget;}
+
+            /** Size of the runs spilled to disk, in bytes. */
+            size_t spilled_size() const {return _spilled_size;}
+
+            /** Number of runs spilled to disk. */
+            size_t nb_spilled() const {return _nb_spilled;}
+
+            /** The file holding the spilled runs (empty while nothing has been spilled). */
+            const fs::path& spill_file() const {return _spill.path;}
             
         protected:
-            /** The main data structure in which log events are stored. */
-            Suites _data;
+            /** Keys of a run: suite name, problem id, dimension, instance and run id. */
+            using Key = std::tuple<std::string, int, int, int, size_t>;
+
+            /** A run held in memory, row by row.
+             *
+             * Values are stored by position, so that logging an event does not involve any property name.
+             */
+            struct Table {
+                //! Property names, in lexicographic order.
+                std::vector<std::string> names;
+                //! Logged evaluations, in increasing order.
+                std::vector<size_t> evaluations;
+                //! For each evaluation, then each property: 0 if absent, 1 if without value, 2 else.
+                std::vector<uint8_t> flags;
+                //! For each evaluation, then each property: its value (0 if it has none).
+                std::vector<double> values;
+
+                /** Number of evaluations. */
+                size_t size() const {return evaluations.size();}
+
+                /** Number of the i-th evaluation. */
+                size_t evaluation(const size_t i) const {return evaluations[i];}
+
+                /** Estimated size in memory. */
+                size_t footprint() const
+                {
+                    return evaluations.size() * sizeof(size_t) + flags.size() * sizeof(uint8_t) + values.size() * sizeof(double);
+                }
+
+                /** Index of an evaluation, or size() if it is not in the run. */
+                size_t find(const size_t evaluation) const
+                {
+                    const auto it = std::lower_bound(evaluations.begin(), evaluations.end(), evaluation);
+                    return it != evaluations.end() and *it == evaluation ? static_cast<size_t>(it - evaluations.begin()) : size();
+                }
+
+                /** Add the values of the i-th evaluation to the attributes. */
+                void attributes(const size_t i, Attributes& att) const
+                {
+                    const size_t n = names.size();
+                    for(size_t j = 0; j < n; ++j) {
+                        if(const auto flag = flags[i * n + j]; flag != 0) {
+                            att.emplace_hint(att.end(), names[j], flag == 2 ? Value(values[i * n + j]) : Value());
+                        }
+                    }
+                }
+
+                /** Add columns for new properties, absent from the existing rows.
+                 *
+                 * @param wider The new names, in lexicographic order, among which are the current ones.
+                 */
+                void widen(const std::vector<std::string>& wider)
+                {
+                    if(not evaluations.empty()) {
+                        const size_t n = names.size(), m = wider.size();
+                        std::vector<uint8_t> wider_flags(evaluations.size() * m, 0);
+                        std::vector<double> wider_values(evaluations.size() * m, 0.);
+                        for(size_t j = 0, k = 0; j < n; ++j, ++k) {
+                            while(wider[k] != names[j]) {
+                                ++k;
+                            }
+                            for(size_t i = 0; i < evaluations.size(); ++i) {
+                                wider_flags[i * m + k] = flags[i * n + j];
+                                wider_values[i * m + k] = values[i * n + j];
+                            }
+                        }
+                        flags.swap(wider_flags);
+                        values.swap(wider_values);
+                    }
+                    names = wider;
+                }
+
+                /** Convert a run given in nested maps. */
+                static Table of(const Run& run)
+                {
+                    std::set<std::string> all;
+                    for(const auto& [evaluation, attributes] : run) {
+                        for(const auto& [name, value] : attributes) {
+                            all.insert(name);
+                        }
+                    }
+                    Table table;
+                    table.names.assign(all.begin(), all.end());
+                    const size_t n = table.names.size();
+                    table.flags.reserve(run.size() * n);
+                    table.values.reserve(run.size() * n);
+                    for(const auto& [evaluation, attributes] : run) {
+                        table.evaluations.push_back(evaluation);
+                        for(const auto& name : table.names) {
+                            const auto it = attributes.find(name);
+                            const bool found = it != attributes.end();
+                            table.flags.push_back(static_cast<uint8_t>(found ? (it->second ? 2 : 1) : 0));
+                            table.values.push_back(found ? it->second.value_or(0.) : 0.);
+                        }
+                    }
+                    return table;
+                }
+            };
+
+            /** Where a run is in the spill file. */
+            struct Spilled {
+                //! Offset of the run.
+                size_t offset;
+                //! Size of its data.
+                size_t size;
+            };
+
+            /** A run: its rows spilled to disk, by parts, followed by those held in memory. */
+            struct Stored {
+                //! Where the spilled parts of the run are in the spill file, in order.
+                std::vector<Spilled> spilled;
+                //! The rows held in memory.
+                Table table;
+
+                /** True if nothing has been logged. */
+                bool empty() const {return spilled.empty() and table.evaluations.empty();}
+            };
+
+            /** The spill file, removed with the logger. */
+            struct SpillFile {
+                //! Its path (empty while nothing has been spilled).
+                fs::path path;
+                //! Output stream to the file.
+                std::ofstream out;
+                //! Mapping of the file, updated when rows have been spilled since it was made.
+                std::unique_ptr<common::file::MappedFile> map;
+
+                SpillFile() = default;
+
+                //! The moved-from file is left without a path, so that it does not remove the file.
+                SpillFile(SpillFile&& other) noexcept
+                : path(std::move(other.path)), out(std::move(other.out)), map(std::move(other.map))
+                {
+                    other.path.clear();
+                }
+
+                //! See the move constructor.
+                SpillFile& operator=(SpillFile&& other) noexcept
+                {
+                    if(this != &other) {
+                        remove();
+                        path = std::move(other.path);
+                        out = std::move(other.out);
+                        map = std::move(other.map);
+                        other.path.clear();
+                    }
+                    return *this;
+                }
+
+                ~SpillFile() {remove();}
+
+                //! Close and remove the file (if any).
+                void remove()
+                {
+                    map.reset();
+                    out.close();
+                    if(not path.empty()) {
+                        std::error_code ec;
+                        fs::remove(path, ec);
+                        path.clear();
+                    }
+                }
+            };
+
+            /** The completed runs. */
+            std::map<Key, Stored> _runs;
+
+            /** The current run, moved in `_runs` when it is completed. */
+            Stored _current_run;
 
             /** The current Cursor. */
             Cursor _current;
 
-            /** Accessor to the current attributes map. */
-            Attributes& current_attributes()
+            /** Property names in lexicographic order, those of the current run. */
+            std::vector<std::string> _names;
+
+            /** Ids of the properties of `_names`, resolved at attach time so that events only index `values_`. */
+            std::vector<size_t> _ids;
+
+            /** Number of properties at the time `_names` was last built. */
+            size_t _interned = 0;
+
+            /** Estimated size of the data held in memory. */
+            size_t _memory = 0;
+
+            /** Size of the data added by an event, for the current `_names`. */
+            size_t _event_size = 0;
+
+            /** Memory budget (0 if unbounded). */
+            size_t _budget;
+
+            /** Where the spill file is created (the temporary directory if empty). */
+            fs::path _spill_directory;
+
+            /** The spill file. */
+            SpillFile _spill;
+
+            /** Size of the spill file. */
+            size_t _spilled_size = 0;
+
+            /** Number of spilled runs. */
+            size_t _nb_spilled = 0;
+
+            /** The run at the given cursor.
+             *
+             * @throws std::out_of_range if there is no such run.
+             */
+            const Stored& stored(const Cursor& cursor) const
             {
-                return _data[_current.suite][_current.pb][_current.dim][_current.instance][_current.run][_current.evaluation];
+                if(not _current_run.empty() and cursor.suite == _current.suite and cursor.pb == _current.pb
+                   and cursor.dim == _current.dim and cursor.instance == _current.instance and cursor.run == _current.run) {
+                    return _current_run;
+                }
+                return _runs.at(Key{cursor.suite, cursor.pb, cursor.dim, cursor.instance, cursor.run});
             }
-            
+
+            /** The id following the ones of the completed runs of a problem, dimension and instance. */
+            size_t next_run(const std::string& suite, const int pb, const int dim, const int instance) const
+            {
+                const auto after = _runs.upper_bound(Key{suite, pb, dim, instance, std::numeric_limits<size_t>::max()});
+                if(after == _runs.begin()) {
+                    return 0;
+                }
+                const auto& [s, p, d, i, run] = std::prev(after)->first;
+                return s == suite and p == pb and d == dim and i == instance ? run + 1 : 0;
+            }
+
+            /** Move the current run with the completed ones (if something has been logged). */
+            void complete()
+            {
+                if(not _current_run.empty()) {
+                    Key key{_current.suite, _current.pb, _current.dim, _current.instance, _current.run};
+                    if(_runs.count(key)) { // Never overwrite a completed run.
+                        std::get<4>(key) = next_run(_current.suite, _current.pb, _current.dim, _current.instance);
+                    }
+                    _runs.emplace(std::move(key), std::move(_current_run));
+                }
+                _current_run = Stored();
+                _current_run.table.names = _names;
+            }
+
+            /** Interns the names of the properties (if some have been added). */
+            void intern_names()
+            {
+                if(_interned == properties_vector_.size()) {
+                    return;
+                }
+                _interned = properties_vector_.size();
+                _names.clear();
+                _ids.clear();
+                for(const auto& [name, rwp] : properties_) { // Ordered by name.
+                    _names.push_back(name);
+                    _ids.push_back(property_id(name));
+                }
+                _event_size = sizeof(size_t) + _ids.size() * (sizeof(uint8_t) + sizeof(double));
+                // Properties watched during a run are absent from its previous events.
+                _memory -= std::min(_memory, _current_run.table.footprint());
+                _current_run.table.widen(_names);
+                _memory += _current_run.table.footprint();
+            }
+
+            /** Read a value in the spill file. */
+            template<class T>
+            static T read(const char* p)
+            {
+                T value;
+                std::memcpy(&value, p, sizeof(T));
+                return value;
+            }
+
+            /** Append a value to a buffer. */
+            template<class T>
+            static void write(std::string& out, const T value)
+            {
+                out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+            }
+
+            /** Encode a run as it is held in memory.
+             *
+             * Layout: the number of properties (u32) and their names (u32 size and bytes),
+             * the number of evaluations (u64) and their numbers (u64),
+             * then the flags (u8) and the values (double) of the rows.
+             */
+            static void encode(std::string& out, const Table& table)
+            {
+                write(out, static_cast<uint32_t>(table.names.size()));
+                for(const auto& name : table.names) {
+                    write(out, static_cast<uint32_t>(name.size()));
+                    out.append(name);
+                }
+                write(out, static_cast<uint64_t>(table.size()));
+                for(const auto evaluation : table.evaluations) {
+                    write(out, static_cast<uint64_t>(evaluation));
+                }
+                out.append(reinterpret_cast<const char*>(table.flags.data()), table.flags.size());
+                out.append(reinterpret_cast<const char*>(table.values.data()), table.values.size() * sizeof(double));
+            }
+
+            /** A spilled run, decoded from the mapping of the spill file. */
+            class Rows {
+                const char* _evaluations;
+                const char* _flags;
+                const char* _values;
+                size_t _size;
+
+                public:
+                    /** Property names. */
+                    std::vector<std::string> names;
+
+                    /** Decode the header of a run. */
+                    Rows(const char* data)
+                    {
+                        names.resize(read<uint32_t>(data));
+                        data += sizeof(uint32_t);
+                        for(auto& name : names) {
+                            const auto n = read<uint32_t>(data);
+                            name.assign(data + sizeof(uint32_t), n);
+                            data += sizeof(uint32_t) + n;
+                        }
+                        _size = static_cast<size_t>(read<uint64_t>(data));
+                        _evaluations = data + sizeof(uint64_t);
+                        _flags = _evaluations + _size * sizeof(uint64_t);
+                        _values = _flags + _size * names.size();
+                    }
+
+                    /** Number of evaluations. */
+                    size_t size() const {return _size;}
+
+                    /** Number of the i-th evaluation. */
+                    size_t evaluation(const size_t i) const
+                    {
+                        return static_cast<size_t>(read<uint64_t>(_evaluations + i * sizeof(uint64_t)));
+                    }
+
+                    /** Index of an evaluation, or size() if it is not in the run. */
+                    size_t find(const size_t evaluation) const
+                    {
+                        size_t lo = 0, hi = _size;
+                        while(lo < hi) { // Evaluations are increasing.
+                            const size_t mid = lo + (hi - lo) / 2;
+                            if(this->evaluation(mid) < evaluation) {
+                                lo = mid + 1;
+                            } else {
+                                hi = mid;
+                            }
+                        }
+                        return lo < _size and this->evaluation(lo) == evaluation ? lo : _size;
+                    }
+
+                    /** Add the values of the i-th evaluation to the attributes. */
+                    void attributes(const size_t i, Attributes& att) const
+                    {
+                        const size_t n = names.size();
+                        for(size_t j = 0; j < n; ++j) {
+                            if(const auto flag = _flags[i * n + j]; flag != 0) {
+                                att.emplace_hint(att.end(), names[j], flag == 2
+                                    ? Value(read<double>(_values + (i * n + j) * sizeof(double)))
+                                    : Value());
+                            }
+                        }
+                    }
+            };
+
+            /** Start of the spill file, mapped in memory. */
+            const char* spilled_data()
+            {
+                if(_spill.map == nullptr or _spill.map->size() != _spilled_size) {
+                    _spill.map.reset(); // Unmap before mapping again.
+                    _spill.map = std::make_unique<common::file::MappedFile>(_spill.path);
+                }
+                return _spill.map->data();
+            }
+
+            /** Convert a run to nested maps. */
+            Run materialize(const Stored& stored)
+            {
+                Run run;
+                const auto add = [&run](const auto& rows) {
+                    for(size_t i = 0; i < rows.size(); ++i) {
+                        rows.attributes(i, run.emplace_hint(run.end(), rows.evaluation(i), Attributes())->second);
+                    }
+                };
+                for(const auto& part : stored.spilled) {
+                    add(Rows(spilled_data() + part.offset));
+                }
+                add(stored.table);
+                return run;
+            }
+
+            /** Append the rows of a run held in memory to the buffer of the spill file. */
+            void spill(std::string& buffer, Stored& run)
+            {
+                if(run.table.evaluations.empty()) {
+                    return;
+                }
+                if(run.spilled.empty()) {
+                    ++_nb_spilled;
+                }
+                const size_t offset = _spilled_size + buffer.size();
+                encode(buffer, run.table);
+                run.spilled.push_back(Spilled{offset, _spilled_size + buffer.size() - offset});
+                _memory -= std::min(_memory, run.table.footprint());
+                Table rest; // Next rows have the same properties.
+                rest.names = std::move(run.table.names);
+                run.table = std::move(rest);
+            }
+
+            /** Spill all the rows held in memory, if the memory budget is exceeded. */
+            void spill()
+            {
+                if(_budget == 0 or _memory <= _budget) {
+                    return;
+                }
+                if(_spill.path.empty()) {
+                    const auto directory = _spill_directory.empty() ? fs::temp_directory_path() : _spill_directory;
+                    std::random_device rd;
+                    do {
+                        _spill.path = directory / fmt::format("ioh-store-{:08x}{:08x}.bin", rd(), rd());
+                    } while(fs::exists(_spill.path));
+                    _spill.out.open(_spill.path, std::ios::binary);
+                    if(not _spill.out) {
+                        throw std::runtime_error(fmt::format("Cannot write {}", _spill.path.generic_string()));
+                    }
+                    IOH_DBG(note, "spilling runs to " << _spill.path)
+                }
+                std::string buffer;
+                for(auto& [key, run] : _runs) {
+                    spill(buffer, run);
+                }
+                spill(buffer, _current_run);
+                _spill.out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                _spill.out.flush();
+                if(not _spill.out) {
+                    throw std::runtime_error(fmt::format("Cannot write {}", _spill.path.generic_string()));
+                }
+                _spilled_size += buffer.size();
+            }
+
         public:
-            /** The logger::Store should at least track one logger::Property, or else it makes no sense to use it. */
+            /** The logger::Store should at least track one logger::Property, or else it makes no sense to use it.
+             *
+             * @param triggers When to log.
+             * @param Attributes What to log.
+             * @param memory_budget Estimated size of the in-memory data above which the logged rows are spilled to disk, in bytes (0 for no limit).
+             * @param spill_directory Where to create the spill file (the temporary directory if empty), which is removed with the logger.
+             */
             Store(std::vector<std::reference_wrapper<logger::Trigger >> triggers,
-                  std::vector<std::reference_wrapper<logger::Property>> Attributes)
-            : Watcher(triggers, Attributes)
+                  std::vector<std::reference_wrapper<logger::Property>> Attributes,
+                  const size_t memory_budget = 0,
+                  const fs::path& spill_directory = "")
+            : Watcher(triggers, Attributes),
+              _budget(memory_budget),
+              _spill_directory(spill_directory)
             { }
 
+            /** Move a logger, along with its spill file. */
+            Store(Store&& other) = default;
+
+            /** Move a logger, along with its spill file (the file of this one being removed). */
+            Store& operator=(Store&& other) = default;
+
             /** Track a problem/instance/dimension and/or create a new run.
              * 
              * Problem, instance and dimension are given in the argument.
@@ -155,14 +693,15 @@ namespace ioh::logger {
             virtual void attach_problem(const problem::MetaData& problem) override
             {
                 Logger::attach_problem(problem);
-                
+                complete(); // The previous run is filed under its own problem.
+
                 _current.pb         = problem.problem_id;
                 _current.dim        = problem.n_variables;
                 _current.instance   = problem.instance;
-                
                 _current.evaluation = 0;
-                const Runs& runs    = _data[_current.suite][_current.pb][_current.dim][_current.instance];
-                _current.run        = runs.size(); // De facto next run id.
+                _current.run        = next_run(_current.suite, _current.pb, _current.dim, _current.instance);
+                intern_names();
+                spill(); // The previous run is completed.
             }
 
             /** Set the current suite name.
@@ -171,20 +710,56 @@ namespace ioh::logger {
              */
             virtual void attach_suite(const std::string& suite_name) override
             {
+                complete();
                 _current.suite = suite_name;
+                spill();
             }
 
             /** Atomic log action. */
             virtual void call(const logger::Info& log_info) override
             {
-                // Get the Attributes list at the current cursor.
-                Attributes& att = current_attributes();
-                // Save the corresponding values.
-                for(const auto& rwp : this->properties_) {
-                    att[rwp.first] = rwp.second.get()(log_info);
+                gather(log_info);
+                intern_names();
+                // Append a row to the current run, in the order of the names.
+                Table& table = _current_run.table;
+                table.evaluations.push_back(_current.evaluation);
+                for(const auto id : _ids) {
+                    const auto& value = values_[id];
+                    table.flags.push_back(static_cast<uint8_t>(value ? 2 : 1));
+                    table.values.push_back(value.value_or(0.));
                 }
+                _memory += _event_size;
                 // Jump to next cursor.
                 _current.evaluation++;
+                spill(); // Long runs may not fit in the budget.
+            }
+
+            /** Add runs logged elsewhere (for instance by another process, see logger::archive).
+             *
+             * The added runs are numbered after the runs already logged
+             * for the same problem, dimension and instance, including the current one.
+             */
+            void merge(const Suites& data)
+            {
+                for(const auto& [suite, problems] : data) {
+                    for(const auto& [pb, dimensions] : problems) {
+                        for(const auto& [dim, instances] : dimensions) {
+                            for(const auto& [ins, runs] : instances) {
+                                size_t id = next_run(suite, pb, dim, ins);
+                                if(problem_ != nullptr and suite == _current.suite and pb == _current.pb
+                                   and dim == _current.dim and ins == _current.instance) {
+                                    id = std::max(id, _current.run + 1); // Keep the id of the current run.
+                                }
+                                for(const auto& run : runs) {
+                                    auto& added = _runs[Key{suite, pb, dim, ins, id++}];
+                                    added.table = Table::of(run.second);
+                                    _memory += added.table.footprint();
+                                }
+                            }
+                        }
+                    }
+                }
+                spill();
             }
     };
 
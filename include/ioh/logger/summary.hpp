@@ -0,0 +1,366 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include "eah.hpp"
+
+namespace ioh::logger
+{
+    /** A logger that writes a compact fixed-target / fixed-budget summary of each run.
+     *
+     * For each run, it only keeps:
+     * - the first evaluation at which each quality target has been attained (the fixed-target view, used for ERT),
+     * - the best quality at each budget checkpoint (the fixed-budget view, used for ECDF).
+     *
+     * The quality is the error to the optimum if it is known, the best transformed objective value else
+     * (as in logger::EAH).
+     * A target is attained if the quality is lower or equal to it,
+     * or greater or equal if the problem is maximized and its optimum is unknown.
+     *
+     * The state is in O(#targets + #budgets) per run, and each improvement is processed
+     * in O(log #targets) (amortized), the skipped evaluations not being seen at all (see trigger::OnImprovement).
+     * A single line is written at the end of each run (when the problem is reset, or another one is attached).
+     *
+     * Targets and budgets can be given as grids (see logger::Summary::grid), for instance log-spaced ones:
+     * @code
+        logger::eah::Log10Scale<double> targets(0, 1e2, 20);
+        logger::eah::Log10Scale<size_t> budgets(0, 1e4, 8);
+        logger::Summary summary(targets, budgets, "IOH-summary.dat", "./today/");
+     * @endcode
+     *
+     * Each line holds the problem meta data, the run number, the number of evaluations and the final best quality,
+     * then the evaluation at which each target has been attained, then the best quality at each budget.
+     * Targets which have not been attained and budgets which have not been reached are marked as "None".
+     *
+     * @ingroup Loggers
+     */
+    class Summary : public Logger
+    {
+    public:
+        /** Points of a grid: the upper bounds of the buckets of the given scale.
+         *
+         * Budgets being numbers of evaluations, they are rounded to the nearest integer.
+         */
+        template <class R>
+        [[nodiscard]] static std::vector<R> grid(const eah::Scale<R> &scale)
+        {
+            std::vector<R> points;
+            for (size_t i = 0; i < scale.size(); ++i)
+            {
+                const double point = scale.bounds(i).second;
+                if constexpr (std::is_integral_v<R>)
+                    points.push_back(static_cast<R>(std::llround(point)));
+                else
+                    points.push_back(static_cast<R>(point));
+            }
+            return points;
+        }
+
+    protected:
+        //! Quality targets, in increasing order.
+        std::vector<double> targets_;
+
+        //! Budget checkpoints, in increasing order.
+        std::vector<size_t> budgets_;
+
+        //! String indicating that a target has not been attained or a budget not reached.
+        const std::string nan_;
+
+        //! Output directory.
+        fs::path output_directory_;
+
+        //! Filename.
+        std::string filename_;
+
+        //! Output stream.
+        std::ofstream out_;
+
+        //! Current suite.
+        std::string current_suite_;
+
+        //! Current run.
+        size_t current_run_;
+
+        //! Meta data of the current run, written at its end (the problem may not exist anymore).
+        std::string current_meta_data_;
+
+        /** @name Current run state
+         * @{ */
+
+        //! Whether a run has started, but has not been written yet.
+        bool started_;
+
+        //! Whether the problem type and optimum are known.
+        bool is_tracked_;
+
+        //! Whether the optimum is known, in which case the quality is the error.
+        bool has_opt_;
+
+        //! The optimum.
+        double opt_;
+
+        //! Whether a lower quality is better.
+        bool minimize_;
+
+        //! Index delimiting the attained targets (a suffix if minimize_, a prefix else).
+        size_t attained_;
+
+        //! Evaluation at which each target has been attained, zero if it has not.
+        std::vector<size_t> hits_;
+
+        //! Number of budgets already passed by an improvement.
+        size_t passed_;
+
+        //! Best quality at each budget.
+        std::vector<double> bests_;
+
+        //! Best quality so far.
+        double best_;
+
+        //! Number of evaluations so far.
+        size_t evaluations_;
+
+        /** @} */
+
+        //! Only improvements matter.
+        trigger::OnImprovement on_improvement_;
+
+        //! Property watching the number of evaluations.
+        watch::Evaluations evaluations_property_;
+
+        //! Property watching the objective function value.
+        watch::TransformedYBest transformed_y_best_;
+
+        //! Id of the number of evaluations property.
+        size_t evaluations_id_;
+
+        //! Id of the objective function value property.
+        size_t transformed_y_best_id_;
+
+        //! Open the output file, if needed.
+        void open_stream()
+        {
+            if (out_.is_open())
+                return;
+            if (not exists(output_directory_))
+            {
+                IOH_DBG(debug, "some directories do not exist in " << output_directory_ << ", try to create them")
+                create_directories(output_directory_);
+            }
+            IOH_DBG(debug, "will output data in " << output_directory_ / filename_)
+            out_ = std::ofstream(output_directory_ / filename_);
+
+            fmt::memory_buffer header;
+            fmt::format_to(std::back_inserter(header), "suite_name problem_id instance dimension run evaluations best");
+            for (const auto t : targets_)
+                fmt::format_to(std::back_inserter(header), " target_{}", t);
+            for (const auto b : budgets_)
+                fmt::format_to(std::back_inserter(header), " budget_{}", b);
+            header.push_back('\n');
+            out_.write(header.data(), static_cast<std::streamsize>(header.size()));
+        }
+
+        //! Take the number of evaluations of the run from the problem, as the logger skips the last ones.
+        void count_evaluations()
+        {
+            if (const auto *last = last_info(); last != nullptr)
+                evaluations_ = std::max(evaluations_, last->evaluations);
+        }
+
+        //! Write the record of the current run, if it has started.
+        void finish_run()
+        {
+            if (not started_)
+                return;
+            started_ = false;
+            count_evaluations();
+            if (evaluations_ == 0)
+                return;
+
+            // Budgets after the last improvement, but within the run, have the same best.
+            for (; passed_ < budgets_.size() and budgets_[passed_] <= evaluations_; ++passed_)
+                bests_[passed_] = best_;
+
+            fmt::memory_buffer line;
+            auto out = std::back_inserter(line);
+            line.append(current_meta_data_.data(), current_meta_data_.data() + current_meta_data_.size());
+            fmt::format_to(out, FMT_COMPILE("{} "), evaluations_);
+            fmt::format_to(out, FMT_COMPILE("{}"), best_);
+            for (const auto hit : hits_)
+            {
+                line.push_back(' ');
+                if (hit == 0)
+                    line.append(nan_.data(), nan_.data() + nan_.size());
+                else
+                    fmt::format_to(out, FMT_COMPILE("{}"), hit);
+            }
+            for (size_t i = 0; i < bests_.size(); ++i)
+            {
+                line.push_back(' ');
+                if (i >= passed_)
+                    line.append(nan_.data(), nan_.data() + nan_.size());
+                else
+                    fmt::format_to(out, FMT_COMPILE("{}"), bests_[i]);
+            }
+            line.push_back('\n');
+            out_.write(line.data(), static_cast<std::streamsize>(line.size()));
+            out_.flush();
+        }
+
+        //! Quality of the given best transformed value.
+        [[nodiscard]] double quality(const double transformed_y_best) const
+        {
+            return has_opt_ ? std::abs(opt_ - transformed_y_best) : transformed_y_best;
+        }
+
+        //! Setup the properties and the trigger, once members are instantiated.
+        void setup()
+        {
+            std::sort(targets_.begin(), targets_.end());
+            std::sort(budgets_.begin(), budgets_.end());
+            triggers_->insert(std::ref(on_improvement_));
+            evaluations_id_ = add_property(evaluations_property_);
+            transformed_y_best_id_ = add_property(transformed_y_best_);
+        }
+
+    public:
+        /** Constructor.
+         *
+         * @param targets Quality targets.
+         * @param budgets Numbers of evaluations at which the best quality is recorded.
+         * @param filename File name in which to write the records.
+         * @param output_directory Directory in which to put the file.
+         * @param no_value The string indicating that a target has not been attained or a budget not reached.
+         */
+        Summary(std::vector<double> targets, std::vector<size_t> budgets,
+                const std::string &filename = "IOH-summary.dat",
+                const fs::path &output_directory = fs::current_path(), const std::string &no_value = "None") :
+            Logger(),
+            targets_(std::move(targets)), budgets_(std::move(budgets)), nan_(no_value),
+            output_directory_(output_directory), filename_(filename), current_suite_("unknown_suite"),
+            current_run_(0), started_(false), is_tracked_(false), has_opt_(false), opt_(0), minimize_(true),
+            attained_(0), hits_(targets_.size(), 0), passed_(0),
+            bests_(budgets_.size(), std::numeric_limits<double>::quiet_NaN()), best_(0), evaluations_(0),
+            evaluations_id_(0), transformed_y_best_id_(0)
+        {
+            // Do not use the Logger's constructor, to avoid passing references to uninitialized members.
+            setup();
+        }
+
+        /** Constructor with grids of targets and budgets (see Summary::grid).
+         *
+         * @param targets Scale from which quality targets are taken.
+         * @param budgets Scale from which budgets are taken.
+         * @param filename File name in which to write the records.
+         * @param output_directory Directory in which to put the file.
+         * @param no_value The string indicating that a target has not been attained or a budget not reached.
+         */
+        Summary(const eah::Scale<double> &targets, const eah::Scale<size_t> &budgets,
+                const std::string &filename = "IOH-summary.dat",
+                const fs::path &output_directory = fs::current_path(), const std::string &no_value = "None") :
+            Summary(grid(targets), grid(budgets), filename, output_directory, no_value)
+        {
+        }
+
+        //! Set the current suite name.
+        void attach_suite(const std::string &suite_name) override { current_suite_ = suite_name; }
+
+        //! Write the previous run and start a new one.
+        void attach_problem(const problem::MetaData &problem) override
+        {
+            finish_run();
+            if (problem_ == nullptr or *problem_ != problem)
+                current_run_ = 0;
+            else
+                current_run_++;
+
+            Logger::attach_problem(problem);
+            open_stream();
+            current_meta_data_ = fmt::format("{} {} {} {} {} ", current_suite_, problem.problem_id, problem.instance,
+                                             problem.n_variables, current_run_);
+
+            started_ = true;
+            is_tracked_ = false;
+            std::fill(hits_.begin(), hits_.end(), 0);
+            passed_ = 0;
+            best_ = std::numeric_limits<double>::quiet_NaN();
+            evaluations_ = 0;
+        }
+
+        //! Update the attained targets and the passed budgets.
+        void call(const logger::Info &log_info) override
+        {
+            if (not is_tracked_)
+            {
+                is_tracked_ = true;
+                has_opt_ = std::isfinite(log_info.optimum.y);
+                opt_ = log_info.optimum.y;
+                minimize_ = has_opt_ or problem_->optimization_type == common::OptimizationType::Minimization;
+                attained_ = minimize_ ? targets_.size() : 0;
+            }
+
+            gather(log_info);
+            const auto evaluations = static_cast<size_t>(values_[evaluations_id_].value());
+            const double q = quality(values_[transformed_y_best_id_].value());
+
+            // Budgets before this improvement hold the previous best.
+            for (; passed_ < budgets_.size() and budgets_[passed_] < evaluations; ++passed_)
+                bests_[passed_] = best_;
+            best_ = q;
+            evaluations_ = evaluations;
+
+            if (minimize_)
+            {
+                const auto k = static_cast<size_t>(
+                    std::lower_bound(targets_.begin(), targets_.begin() + attained_, q) - targets_.begin());
+                std::fill(hits_.begin() + k, hits_.begin() + attained_, evaluations);
+                attained_ = k;
+            }
+            else
+            {
+                const auto k = static_cast<size_t>(
+                    std::upper_bound(targets_.begin() + attained_, targets_.end(), q) - targets_.begin());
+                std::fill(hits_.begin() + attained_, hits_.begin() + k, evaluations);
+                attained_ = k;
+            }
+        }
+
+        //! Get the number of evaluations of the run, before the problem resets its state.
+        void reset() override
+        {
+            count_evaluations();
+            Logger::reset();
+        }
+
+        //! Write the current run and close the file.
+        void close() override
+        {
+            finish_run();
+            if (out_.is_open())
+            {
+                IOH_DBG(debug, "close summary file")
+                out_.close();
+            }
+        }
+
+        virtual ~Summary() { close(); }
+
+        //! Quality targets, in increasing order.
+        [[nodiscard]] const std::vector<double> &targets() const { return targets_; }
+
+        //! Budgets, in increasing order.
+        [[nodiscard]] const std::vector<size_t> &budgets() const { return budgets_; }
+
+        //! Accessor for output directory
+        [[nodiscard]] fs::path output_directory() const { return output_directory_; }
+
+        //! Accessor for filename
+        [[nodiscard]] std::string filename() const { return filename_; }
+    };
+} // namespace ioh::logger
@@ -0,0 +1,615 @@
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <optional>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "ioh/common/file.hpp"
+#include "ioh/logger/archive.hpp"
+#include "ioh/logger/loggers.hpp"
+
+namespace ioh::logger
+{
+    /** Lossless compression of the sequence of solutions seen by a logger.
+     *
+     * Consecutive solutions of an optimization algorithm usually differ in a few variables only.
+     * Each solution is thus encoded with respect to the previous one (the first one with respect to zeros):
+     * - Encoding::Real XORs the bits of each variable with the previous ones (as in Facebook's Gorilla),
+     *   an unchanged variable costs a single bit, a changed one stores its non-zero XOR bits only,
+     *   reusing the previous leading/trailing zeros window of the variable when the new bits fit in it.
+     * - Encoding::Integer only stores the changed variables, as run lengths of unchanged ones (Elias gamma codes),
+     *   followed by the zigzagged difference of their values. Steps that only flip binary variables
+     *   (0 to 1 or 1 to 0) do not store any difference.
+     *
+     * The bits are written most significant first, so the encoded bytes do not depend on the byte order.
+     */
+    namespace trace
+    {
+        //! How to encode the variables.
+        enum class Encoding : uint8_t
+        {
+            Real = 1,
+            Integer = 2
+        };
+
+        //! Number of leading zero bits of a non-zero value.
+        inline unsigned leading_zeros(const uint64_t v)
+        {
+            assert(v != 0);
+#ifdef _MSC_VER
+            unsigned long i;
+            _BitScanReverse64(&i, v);
+            return 63u - static_cast<unsigned>(i);
+#else
+            return static_cast<unsigned>(__builtin_clzll(v));
+#endif
+        }
+
+        //! Number of trailing zero bits of a non-zero value.
+        inline unsigned trailing_zeros(const uint64_t v)
+        {
+            assert(v != 0);
+#ifdef _MSC_VER
+            unsigned long i;
+            _BitScanForward64(&i, v);
+            return static_cast<unsigned>(i);
+#else
+            return static_cast<unsigned>(__builtin_ctzll(v));
+#endif
+        }
+
+        //! Appends bits to a byte string.
+        class BitWriter
+        {
+            std::string bytes_;
+            uint64_t acc_ = 0;
+            unsigned used_ = 0;
+
+            void put_word(const uint64_t w)
+            {
+                for (int shift = 56; shift >= 0; shift -= 8)
+                    bytes_.push_back(static_cast<char>((w >> shift) & 0xFF));
+            }
+
+        public:
+            //! Append the n (at most 64) lowest bits of v.
+            void write(uint64_t v, const unsigned n)
+            {
+                if (n == 0)
+                    return;
+                if (n < 64)
+                    v &= (uint64_t{1} << n) - 1;
+                const unsigned free = 64 - used_;
+                if (n < free)
+                {
+                    acc_ = (acc_ << n) | v;
+                    used_ += n;
+                    return;
+                }
+                const unsigned rest = n - free;
+                const uint64_t head = rest ? v >> rest : v;
+                acc_ = free == 64 ? head : (acc_ << free) | head;
+                put_word(acc_);
+                acc_ = rest ? v & ((uint64_t{1} << rest) - 1) : 0;
+                used_ = rest;
+            }
+
+            //! Append a single bit.
+            void bit(const bool b) { write(b, 1); }
+
+            //! Append an Elias gamma code of v, which must be positive.
+            void gamma(const uint64_t v)
+            {
+                assert(v > 0);
+                const auto n = 64u - leading_zeros(v);
+                write(0, n - 1);
+                write(v, n);
+            }
+
+            //! Number of bits written so far.
+            [[nodiscard]] size_t size() const { return bytes_.size() * 8 + used_; }
+
+            //! The bytes written so far, the last one being padded with zeros.
+            [[nodiscard]] std::string bytes() const
+            {
+                auto out = bytes_;
+                const auto tail = used_ ? acc_ << (64 - used_) : 0;
+                for (unsigned i = 0; i * 8 < used_; ++i)
+                    out.push_back(static_cast<char>((tail >> (56 - 8 * i)) & 0xFF));
+                return out;
+            }
+
+            //! Forget everything.
+            void clear()
+            {
+                bytes_.clear();
+                acc_ = 0;
+                used_ = 0;
+            }
+        };
+
+        //! Reads the bits written by a BitWriter.
+        class BitReader
+        {
+            const unsigned char *data_;
+            size_t size_;
+            size_t pos_ = 0;
+
+            //! The 64 bits starting at the given byte, padded with zeros.
+            [[nodiscard]] uint64_t word(const size_t byte) const
+            {
+                uint64_t w = 0;
+                const auto end = std::min(byte + 8, size_);
+                for (size_t b = byte; b < end; ++b)
+                    w |= uint64_t{data_[b]} << (56 - 8 * (b - byte));
+                return w;
+            }
+
+        public:
+            //! Read the given bytes.
+            BitReader(const char *data, const size_t size) :
+                data_(reinterpret_cast<const unsigned char *>(data)), size_(size)
+            {
+            }
+
+            //! Read n (at most 64) bits.
+            uint64_t read(const unsigned n)
+            {
+                if (n == 0)
+                    return 0;
+                if (pos_ + n > size_ * 8)
+                    throw std::runtime_error("Truncated trace.");
+                if (n > 56)
+                {
+                    const auto high = read(n - 32);
+                    return (high << 32) | read(32);
+                }
+                const auto v = (word(pos_ >> 3) << (pos_ & 7)) >> (64 - n);
+                pos_ += n;
+                return v;
+            }
+
+            //! Read a single bit.
+            bool bit() { return read(1) != 0; }
+
+            //! Read an Elias gamma code.
+            uint64_t gamma()
+            {
+                unsigned zeros = 0;
+                while (not bit())
+                    if (++zeros == 64)
+                        throw std::runtime_error("Corrupted trace.");
+                return (uint64_t{1} << zeros) | read(zeros);
+            }
+        };
+
+        //! Encodes consecutive solutions of a given size.
+        class Encoder
+        {
+            size_t n_variables_;
+            Encoding encoding_;
+            size_t size_ = 0;
+            BitWriter out_;
+
+            //! Bits (Real) or values (Integer) of the previous solution.
+            std::vector<uint64_t> previous_;
+            //! Leading zeros of the XOR window of each variable (Real).
+            std::vector<uint8_t> leading_;
+            //! Trailing zeros of the XOR window of each variable (Real), 64 if there is no window yet.
+            std::vector<uint8_t> trailing_;
+            //! Changed variables (Integer).
+            std::vector<size_t> changed_;
+
+            template <typename V>
+            void append_real(const V *x)
+            {
+                for (size_t i = 0; i < n_variables_; ++i)
+                {
+                    const auto xi = static_cast<double>(x[i]);
+                    uint64_t bits;
+                    std::memcpy(&bits, &xi, sizeof bits);
+                    const auto xored = bits ^ previous_[i];
+                    previous_[i] = bits;
+                    if (xored == 0)
+                    {
+                        out_.bit(false);
+                        continue;
+                    }
+                    const auto lead = std::min(leading_zeros(xored), 31u);
+                    const auto trail = trailing_zeros(xored);
+                    if (trailing_[i] < 64 and lead >= leading_[i] and trail >= trailing_[i])
+                    {
+                        out_.write(0b10, 2);
+                        out_.write(xored >> trailing_[i], 64 - leading_[i] - trailing_[i]);
+                    }
+                    else
+                    {
+                        const auto length = 64 - lead - trail;
+                        out_.write(0b11, 2);
+                        out_.write(lead, 5);
+                        out_.write(length - 1, 6);
+                        out_.write(xored >> trail, length);
+                        leading_[i] = static_cast<uint8_t>(lead);
+                        trailing_[i] = static_cast<uint8_t>(trail);
+                    }
+                }
+            }
+
+            template <typename V>
+            void append_integer(const V *x)
+            {
+                changed_.clear();
+                bool flips = true;
+                for (size_t i = 0; i < n_variables_; ++i)
+                {
+                    if constexpr (std::is_floating_point_v<V>)
+                        if (x[i] != std::trunc(x[i]) or std::abs(x[i]) > 9.0e15)
+                            throw std::invalid_argument(fmt::format("Variable {} is not an integer: {}", i, x[i]));
+                    const auto v = static_cast<uint64_t>(static_cast<int64_t>(x[i]));
+                    if (v != previous_[i])
+                    {
+                        changed_.push_back(i);
+                        flips = flips and previous_[i] <= 1 and v == 1 - previous_[i];
+                    }
+                }
+                out_.gamma(changed_.size() + 1);
+                if (changed_.empty())
+                    return;
+                out_.bit(flips);
+                size_t from = 0;
+                for (const auto i : changed_)
+                {
+                    out_.gamma(i - from + 1);
+                    from = i + 1;
+                    const auto v = static_cast<uint64_t>(static_cast<int64_t>(x[i]));
+                    if (not flips)
+                    {
+                        const auto delta = static_cast<int64_t>(v - previous_[i]);
+                        out_.gamma((static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+                    }
+                    previous_[i] = v;
+                }
+            }
+
+        public:
+            //! Encode solutions with the given number of variables.
+            Encoder(const size_t n_variables, const Encoding encoding) :
+                n_variables_(n_variables), encoding_(encoding), previous_(n_variables, 0),
+                leading_(n_variables, 0), trailing_(n_variables, 64)
+            {
+            }
+
+            //! Append a solution, read with the type of its variables.
+            void append(const Variables &x)
+            {
+                if (x.size() != n_variables_)
+                    throw std::invalid_argument(
+                        fmt::format("Expected {} variables, got {}", n_variables_, x.size()));
+                x.visit([this](const auto *data, size_t) {
+                    if (encoding_ == Encoding::Real)
+                        append_real(data);
+                    else
+                        append_integer(data);
+                });
+                ++size_;
+            }
+
+            //! Number of solutions encoded so far.
+            [[nodiscard]] size_t size() const { return size_; }
+
+            //! Number of variables of the solutions.
+            [[nodiscard]] size_t n_variables() const { return n_variables_; }
+
+            //! The encoding.
+            [[nodiscard]] Encoding encoding() const { return encoding_; }
+
+            //! The encoded solutions.
+            [[nodiscard]] std::string bytes() const { return out_.bytes(); }
+
+            //! Start a new trace.
+            void clear()
+            {
+                out_.clear();
+                size_ = 0;
+                std::fill(previous_.begin(), previous_.end(), 0);
+                std::fill(leading_.begin(), leading_.end(), 0);
+                std::fill(trailing_.begin(), trailing_.end(), 64);
+            }
+        };
+
+        //! Decodes the solutions encoded by an Encoder.
+        class Decoder
+        {
+            size_t n_variables_;
+            Encoding encoding_;
+            BitReader in_;
+            std::vector<uint64_t> previous_;
+            std::vector<uint8_t> leading_;
+            std::vector<uint8_t> trailing_;
+
+        public:
+            //! Decode the given bytes.
+            Decoder(const size_t n_variables, const Encoding encoding, const char *data, const size_t size) :
+                n_variables_(n_variables), encoding_(encoding), in_(data, size), previous_(n_variables, 0),
+                leading_(n_variables, 0), trailing_(n_variables, 0)
+            {
+            }
+
+            //! Decode the next solution into x.
+            void next(std::vector<double> &x)
+            {
+                x.resize(n_variables_);
+                if (encoding_ == Encoding::Real)
+                {
+                    for (size_t i = 0; i < n_variables_; ++i)
+                    {
+                        if (in_.bit())
+                        {
+                            if (in_.bit())
+                            {
+                                leading_[i] = static_cast<uint8_t>(in_.read(5));
+                                const auto length = static_cast<unsigned>(in_.read(6)) + 1;
+                                trailing_[i] = static_cast<uint8_t>(64 - leading_[i] - length);
+                            }
+                            const auto length = 64u - leading_[i] - trailing_[i];
+                            previous_[i] ^= in_.read(length) << trailing_[i];
+                        }
+                        std::memcpy(&x[i], &previous_[i], sizeof(double));
+                    }
+                    return;
+                }
+
+                const auto nb_changed = in_.gamma() - 1;
+                if (nb_changed > n_variables_)
+                    throw std::runtime_error("Corrupted trace.");
+                const bool flips = nb_changed != 0 and in_.bit();
+                size_t i = 0;
+                for (uint64_t c = 0; c < nb_changed; ++c, ++i)
+                {
+                    i += in_.gamma() - 1;
+                    if (i >= n_variables_)
+                        throw std::runtime_error("Corrupted trace.");
+                    if (flips)
+                        previous_[i] = 1 - previous_[i];
+                    else
+                    {
+                        const auto z = in_.gamma();
+                        previous_[i] += (z >> 1) ^ (~(z & 1) + 1);
+                    }
+                }
+                for (size_t k = 0; k < n_variables_; ++k)
+                    x[k] = static_cast<double>(static_cast<int64_t>(previous_[k]));
+            }
+        };
+
+        //! Encode a sequence of solutions.
+        inline std::string encode(const std::vector<std::vector<double>> &solutions, const Encoding encoding)
+        {
+            Encoder encoder(solutions.empty() ? 0 : solutions.front().size(), encoding);
+            for (const auto &x : solutions)
+                encoder.append(x);
+            return encoder.bytes();
+        }
+
+        //! Decode a sequence of count solutions.
+        inline std::vector<std::vector<double>> decode(const std::string &bytes, const size_t n_variables,
+                                                       const size_t count, const Encoding encoding)
+        {
+            Decoder decoder(n_variables, encoding, bytes.data(), bytes.size());
+            std::vector<std::vector<double>> solutions(count);
+            for (auto &x : solutions)
+                decoder.next(x);
+            return solutions;
+        }
+
+        //! Magic string at the start of a trace file.
+        inline constexpr char magic[8] = {'I', 'O', 'H', 'T', 'R', 'A', 'C', 'E'};
+
+        //! Version of the trace file format.
+        inline constexpr uint16_t version = 1;
+
+        //! The solutions logged during a run.
+        struct Run
+        {
+            //! Suite name.
+            std::string suite;
+            //! Problem id.
+            int problem_id;
+            //! Instance.
+            int instance;
+            //! Dimension.
+            int n_variables;
+            //! Evaluation number of each solution.
+            std::vector<size_t> evaluations;
+            //! The solutions.
+            std::vector<std::vector<double>> solutions;
+        };
+
+        /** Read a file written by logger::PositionTrace.
+         *
+         * @throws std::runtime_error if the file is not a trace or is corrupted.
+         */
+        inline std::vector<Run> read(const fs::path &file)
+        {
+            const common::file::MappedFile content(file);
+            archive::detail::Cursor in(content.data(), content.data() + content.size());
+            if (content.size() < sizeof(magic) or std::memcmp(in.skip(sizeof(magic)), magic, sizeof(magic)) != 0)
+                throw std::runtime_error(file.string() + " is not a trace.");
+            if (in.get<uint32_t>() != archive::byte_order_mark)
+                throw std::runtime_error(file.string() + " has been written with another byte order.");
+            if (const auto v = in.get<uint16_t>(); v != version)
+                throw std::runtime_error(
+                    fmt::format("{} has format version {}, not {}.", file.string(), v, version));
+
+            std::vector<Run> runs;
+            while (not in.done())
+            {
+                auto &run = runs.emplace_back();
+                run.suite = in.get_string();
+                run.problem_id = in.get<int32_t>();
+                run.instance = in.get<int32_t>();
+                run.n_variables = in.get<int32_t>();
+                const auto encoding = static_cast<Encoding>(in.get<uint8_t>());
+                const auto count = static_cast<size_t>(in.get<uint64_t>());
+
+                const auto evals_size = static_cast<size_t>(in.get<uint64_t>());
+                BitReader evals(in.skip(evals_size), evals_size);
+                size_t e = 0;
+                run.evaluations.resize(count);
+                for (auto &evaluation : run.evaluations)
+                    evaluation = e += evals.gamma() - 1;
+
+                const auto size = static_cast<size_t>(in.get<uint64_t>());
+                Decoder decoder(static_cast<size_t>(run.n_variables), encoding, in.skip(size), size);
+                run.solutions.resize(count);
+                for (auto &x : run.solutions)
+                    decoder.next(x);
+            }
+            return runs;
+        }
+    } // namespace trace
+
+    /** A logger that writes the solutions it is triggered on in a compressed, lossless, binary file.
+     *
+     * With the same triggers, it can be combined with a FlatFile or an Analyzer without stored positions,
+     * whose text files are then much smaller:
+     * @code
+        logger::Analyzer analyzer;
+        logger::PositionTrace positions({trigger::on_improvement}, "positions.iohtrace");
+        logger::Combine both({analyzer, positions});
+     * @endcode
+     * The file holds one block per run, see trace::read.
+     *
+     * @ingroup Logging
+     */
+    class PositionTrace : public Logger
+    {
+    protected:
+        //! Property required by the Logger interface.
+        watch::Evaluations evaluations_{"evaluations"};
+
+        //! The file.
+        std::ofstream out_;
+
+        //! How to encode the solutions.
+        trace::Encoding encoding_;
+
+        //! Current suite name.
+        std::string suite_;
+
+        //! Solutions of the current run.
+        std::optional<trace::Encoder> solutions_;
+
+        //! Evaluation numbers of the current run, as gamma coded differences.
+        trace::BitWriter evaluations_codes_;
+
+        //! Last logged evaluation number.
+        size_t last_evaluation_;
+
+        //! Append a value to the file.
+        template <class T>
+        void put(const T value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            out_.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        //! Append bytes preceded by their size.
+        void put(const std::string &bytes, const bool size64)
+        {
+            if (size64)
+                put(static_cast<uint64_t>(bytes.size()));
+            else
+                put(static_cast<uint32_t>(bytes.size()));
+            out_.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+
+        //! Write the block of the current run, if it has any solution.
+        void finish_run()
+        {
+            if (solutions_ and solutions_->size() > 0 and out_.is_open())
+            {
+                put(suite_, false);
+                put(static_cast<int32_t>(problem_->problem_id));
+                put(static_cast<int32_t>(problem_->instance));
+                put(static_cast<int32_t>(problem_->n_variables));
+                put(encoding_);
+                put(static_cast<uint64_t>(solutions_->size()));
+                put(evaluations_codes_.bytes(), true);
+                put(solutions_->bytes(), true);
+            }
+            if (solutions_)
+                solutions_->clear();
+            evaluations_codes_.clear();
+            last_evaluation_ = 0;
+        }
+
+    public:
+        /** Constructor.
+         *
+         * @param triggers When to log a solution.
+         * @param file The file to write, overwritten if it exists.
+         * @param encoding trace::Encoding::Integer for integer (e.g. PBO) problems,
+         *                 trace::Encoding::Real for any problem.
+         */
+        PositionTrace(const Triggers &triggers, const fs::path &file,
+                      const trace::Encoding encoding = trace::Encoding::Real) :
+            Logger(), out_(file, std::ios::binary), encoding_(encoding), suite_("unknown_suite"), last_evaluation_(0)
+        {
+            if (not out_)
+                throw std::runtime_error("Cannot write the trace " + file.string());
+            // Do not use the Logger's constructor, to avoid passing references to uninitialized members.
+            for (auto &t : triggers)
+                trigger(t);
+            add_property(evaluations_);
+            out_.write(trace::magic, sizeof(trace::magic));
+            put(archive::byte_order_mark);
+            put(trace::version);
+        }
+
+        //! Set the suite name of the next runs.
+        void attach_suite(const std::string &suite_name) override { suite_ = suite_name; }
+
+        //! Write the previous run, and start a new one.
+        void attach_problem(const problem::MetaData &problem) override
+        {
+            finish_run();
+            Logger::attach_problem(problem);
+            if (not solutions_ or solutions_->n_variables() != static_cast<size_t>(problem.n_variables))
+                solutions_.emplace(static_cast<size_t>(problem.n_variables), encoding_);
+        }
+
+        //! Append the current solution.
+        void call(const logger::Info &log_info) override
+        {
+            solutions_->append(log_info.current.x);
+            evaluations_codes_.gamma(log_info.evaluations - last_evaluation_ + 1);
+            last_evaluation_ = log_info.evaluations;
+        }
+
+        //! Write the current run.
+        void reset() override
+        {
+            finish_run();
+            Logger::reset();
+        }
+
+        //! Write the current run and close the file.
+        void close() override
+        {
+            if (out_.is_open())
+            {
+                finish_run();
+                IOH_DBG(debug, "close trace")
+                out_.close();
+            }
+        }
+
+        virtual ~PositionTrace() { close(); }
+    };
+} // namespace ioh::logger
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <set>
+#include <typeinfo>
 
 #include "ioh/common/log.hpp"
 #include "loginfo.hpp"
@@ -40,10 +44,12 @@ namespace ioh
                 }, {ioh::watch::transformed_y_best});
          * @endcode
          *
-         * @warning Convenience instances are global variables provided for their ease of use.
-         *          However, some of them manage a state (like trigger::on_improvement).
-         *          Thus, think twice before using them in several loggers!
-         *          In some rare cases, you may want to have two copies, to avoid side effects.
+         * @note Convenience instances are global variables provided for their ease of use.
+         *       Some of them manage a state (like trigger::on_improvement),
+         *       but loggers own a clone of each stateful trigger they are given (see logger::Trigger::clone),
+         *       so that the convenience instances can safely be passed to several loggers.
+         *       Consequently, runs on different problem instances, each with its own logger,
+         *       can be done concurrently in different threads, without data race.
          *
          * Some triggers need to be instantiated with parameters before being passed to a logger,
          * you can use the related free functions (lower-case name) to do so on the heap.
@@ -79,6 +85,28 @@ namespace ioh
              */
             virtual void reset() {}
 
+            /** Returns the smallest number of evaluations, strictly after the given one, at which a log event may be
+             * triggered without any improvement of the best transformed value.
+             *
+             * This allows the logger (and the problem) to skip the whole logging path for all the evaluations before
+             * that count, as long as the best value does not improve.
+             *
+             * The default is to be conservative and to ask to be called at the very next evaluation.
+             * Triggers that only depend on the number of evaluations (or on improvements) should override it.
+             * Triggers that fire only on an improvement may return `trigger::never`.
+             *
+             * @param evaluations The current number of evaluations.
+             */
+            virtual size_t next(const size_t evaluations) const { return evaluations + 1; }
+
+            /** Returns a copy of this trigger if it manages an internal state, `nullptr` if it can be shared.
+             *
+             * Loggers use the clones of the triggers they are given,
+             * so that a stateful trigger is never shared between two loggers (or two threads).
+             * Stateless triggers, whose `operator()` does not modify them, should keep the default.
+             */
+            [[nodiscard]] virtual std::unique_ptr<Trigger> clone() const { return nullptr; }
+
             virtual ~Trigger() = default;
         };
 
@@ -92,6 +120,11 @@ namespace ioh
     /** Everything related to triggering a logger event. */
     namespace trigger
     {
+        /** Returned by logger::Trigger::next if the trigger cannot fire on the evaluations count alone.
+         *
+         * @ingroup Triggering
+         */
+        constexpr size_t never = std::numeric_limits<size_t>::max();
 
         /** Interface to combine several triggers in a single one.
          *
@@ -108,6 +141,36 @@ namespace ioh
             //! Managed triggers.
             logger::Triggers triggers_;
 
+            //! Clones of stateful triggers, owned by this set.
+            std::vector<std::shared_ptr<logger::Trigger>> owned_;
+
+            /** Returns a set of type S, managing the clones of the stateful triggers and the stateless ones,
+             *  or `nullptr` if all the managed triggers are stateless.
+             */
+            template <class S>
+            [[nodiscard]] std::unique_ptr<logger::Trigger> clone_as() const
+            {
+                // Derived sets which do not override clone cannot be copied as an S.
+                if (typeid(*this) != typeid(S))
+                    return nullptr;
+                auto set = std::make_unique<S>();
+                for (const auto &trigger : triggers_)
+                {
+                    if (auto copy = trigger.get().clone())
+                    {
+                        set->owned_.push_back(std::move(copy));
+                        set->triggers_.push_back(std::ref(*set->owned_.back()));
+                    }
+                    else
+                    {
+                        set->triggers_.push_back(trigger);
+                    }
+                }
+                if (set->owned_.empty())
+                    return nullptr;
+                return set;
+            }
+
         public:
             /** Empty constructor
              *
@@ -183,6 +246,20 @@ namespace ioh
                 IOH_DBG(xdebug, "not any triggered")
                 return false;
             }
+
+            /** A copy managing clones of the stateful triggers, if any. */
+            [[nodiscard]] virtual std::unique_ptr<logger::Trigger> clone() const override { return clone_as<Any>(); }
+
+            /** The earliest of the managed triggers' next evaluations. */
+            virtual size_t next(const size_t evaluations) const override
+            {
+                size_t n = never;
+                for (const auto &trigger : triggers_)
+                {
+                    n = std::min(n, trigger.get().next(evaluations));
+                }
+                return n;
+            }
         };
         /** Do log if ANY of the given triggers is fired.
          *
@@ -228,6 +305,23 @@ namespace ioh
                 IOH_DBG(debug, "all triggered")
                 return true;
             }
+
+            /** A copy managing clones of the stateful triggers, if any. */
+            [[nodiscard]] virtual std::unique_ptr<logger::Trigger> clone() const override { return clone_as<All>(); }
+
+            /** The latest of the managed triggers' next evaluations.
+             *
+             * As all of them should fire at once, none can fire before that.
+             */
+            virtual size_t next(const size_t evaluations) const override
+            {
+                size_t n = 0;
+                for (const auto &trigger : triggers_)
+                {
+                    n = std::max(n, trigger.get().next(evaluations));
+                }
+                return n;
+            }
         };
         /** Do log if ALL the given triggers are fired.
          *
@@ -330,6 +424,15 @@ namespace ioh
 
             //! Forget previous state.
             void reset() override { _has_type = false; }
+
+            //! Only fires on improvement, whatever the number of evaluations.
+            size_t next(const size_t) const override { return never; }
+
+            //! Manages the best value so far, so cannot be shared.
+            [[nodiscard]] std::unique_ptr<logger::Trigger> clone() const override
+            {
+                return std::make_unique<OnImprovement>(*this);
+            }
         };
         /** Do log only if the transformed best objective function value found so far has strictly improved.
          *
@@ -367,7 +470,7 @@ namespace ioh
             //! Main call interface.
             bool operator()(const logger::Info &log_info, const problem::MetaData &) override
             {
-                if ((log_info.evaluations - _starting_at) % _interval == 0)
+                if (log_info.evaluations >= _starting_at and (log_info.evaluations - _starting_at) % _interval == 0)
                 {
                     IOH_DBG(debug, "each triggered " << log_info.evaluations)
                     return true;
@@ -378,6 +481,18 @@ namespace ioh
                     return false;
                 }
             }
+
+            //! Next multiple of the interval after the starting time.
+            size_t next(const size_t evaluations) const override
+            {
+                const size_t n = evaluations + 1;
+                if (n <= _starting_at)
+                {
+                    return _starting_at;
+                }
+                const size_t r = (n - _starting_at) % _interval;
+                return r == 0 ? n : n + _interval - r;
+            }
         };
         /** Do log every given number of function evaluations.
          *
@@ -411,8 +526,16 @@ namespace ioh
              */
             At(const std::set<size_t> time_points) : _time_points(time_points) {}
 
+            //! Accessor for _time_points
             std::set<size_t> time_points() const {return _time_points;}
 
+            //! First time point after the given evaluation.
+            size_t next(const size_t evaluations) const override
+            {
+                const auto it = _time_points.upper_bound(evaluations);
+                return it == std::end(_time_points) ? never : *it;
+            }
+
             //! Main call interface.
             bool operator()(const logger::Info &log_info, const problem::MetaData &) override
             {
@@ -486,6 +609,26 @@ namespace ioh
             //! Accessor for _time_ranges
             std::set<std::pair<size_t, size_t>> time_ranges() const {return _time_ranges;}
 
+            //! First evaluation after the given one that falls in a range.
+            size_t next(const size_t evaluations) const override
+            {
+                const size_t n = evaluations + 1;
+                size_t first = never;
+                // Ranges are sorted by their start, but may overlap.
+                for (const auto &r : _time_ranges)
+                {
+                    if (r.first > first)
+                    {
+                        break;
+                    }
+                    if (n <= r.second)
+                    {
+                        first = std::min(first, std::max(n, r.first));
+                    }
+                }
+                return first;
+            }
+
             //! Main call interface.
             bool operator()(const logger::Info &log_info, const problem::MetaData &) override
             {
@@ -2,6 +2,9 @@
 
 #include "problem/transformation.hpp"
 #include "problem/problem.hpp"
+#include "problem/concurrent.hpp"
+#include "problem/instances.hpp"
+#include "problem/external.hpp"
 #include "problem/bbob.hpp"
 #include "problem/pbo.hpp"
 
@@ -45,5 +45,13 @@ namespace ioh::problem::bbob
             BBOProblem(6, instance, n_variables, "AttractiveSector")
         {
         }
+
+        //! The variables transformation, as applied by transform_variables
+        [[nodiscard]]
+        std::optional<AffineVariables> affine_variables() const override
+        {
+            return AffineVariables{&objective_.x, &transformation_state_.second_transformation_matrix,
+                                   &transformation_state_.transformation_base};
+        }
     };
 }
@@ -2,6 +2,7 @@
 
 #include "ioh/problem/problem.hpp"
 #include "ioh/problem/transformation.hpp"
+#include "ioh/problem/bbob/rotations.hpp"
 
 namespace ioh::problem
 {
@@ -18,6 +19,9 @@ namespace ioh::problem
             //! The seed
             long seed;
 
+            //! The conditioning of the second transformation matrix
+            double condition;
+
             //! A vector with exponents
             std::vector<double> exponents{};
 
@@ -25,22 +29,23 @@ namespace ioh::problem
             std::vector<double> conditions{};
             
             //! Main transformation matrix
-            std::vector<std::vector<double>> transformation_matrix{};
+            bbob::Matrix transformation_matrix{};
             
             //! Main transformation vector
             std::vector<double> transformation_base{};
 
             //! Second transformation matrix
-            std::vector<std::vector<double>> second_transformation_matrix{};
+            bbob::Matrix second_transformation_matrix{};
 
             //! First rotation matrix
-            std::vector<std::vector<double>> first_rotation{};
+            bbob::Matrix first_rotation{};
 
             //! Second rotation matrix
-            std::vector<std::vector<double>> second_rotation{};
+            bbob::Matrix second_rotation{};
 
             /**
-             * @brief Construct a new Transformation State object
+             * @brief Construct a new Transformation State object, viewing its rotations in
+             * bbob::RotationCache if they are cached
              * 
              * @param problem_id the id of the problem
              * @param instance the instance of the problem
@@ -50,23 +55,33 @@ namespace ioh::problem
             TransformationState(const long problem_id, const int instance, const int n_variables,
                                 const double condition = sqrt(10.0)) :
                 seed((problem_id == 4 || problem_id == 18 ? problem_id - 1 : problem_id) + 10000 * instance),
+                condition(condition),
                 exponents(n_variables),
                 conditions(n_variables),
-                transformation_matrix(n_variables, std::vector<double>(n_variables)),
-                transformation_base(n_variables),
-                second_transformation_matrix(n_variables, std::vector<double>(n_variables)),
-                first_rotation(compute_rotation(seed + 1000000, n_variables)),
-                second_rotation(compute_rotation(seed, n_variables))
+                transformation_base(n_variables)
             {
                 for (auto i = 0; i < n_variables; ++i)
                     exponents[i] = static_cast<double>(i) / (static_cast<double>(n_variables) - 1);
 
+                const auto n = static_cast<size_t>(n_variables);
+                if (const auto cached = bbob::RotationCache::instance().find(seed, n_variables, condition))
+                {
+                    first_rotation = bbob::Matrix::view(cached->first.data(), n, n, cached);
+                    second_rotation = bbob::Matrix::view(cached->second.data(), n, n, cached);
+                    second_transformation_matrix = bbob::Matrix::view(cached->product.data(), n, n, cached);
+                    transformation_matrix = first_rotation;
+                    return;
+                }
+
+                first_rotation = compute_rotation(seed + 1000000, n_variables);
+                second_rotation = compute_rotation(seed, n_variables);
                 transformation_matrix = first_rotation;
+                second_transformation_matrix = bbob::Matrix(n, n);
 
                 for (auto i = 0; i < n_variables; ++i)
                     for (auto j = 0; j < n_variables; ++j)
                         for (auto k = 0; k < n_variables; ++k)
-                            second_transformation_matrix[i][j] += first_rotation.at(i).at(k)
+                            second_transformation_matrix(i, j) += first_rotation.at(i).at(k)
                                 * pow(condition, exponents.at(k))
                                 * second_rotation.at(k).at(j);
             }
@@ -76,18 +91,18 @@ namespace ioh::problem
              * 
              * @param rotation_seed the seed of the rotation
              * @param n_variables the dimension of the problem
-             * @return std::vector<std::vector<double>> the rotation
+             * @return bbob::Matrix the rotation
              */
             [[nodiscard]]
-            std::vector<std::vector<double>> compute_rotation(const long rotation_seed, const int n_variables) const
+            bbob::Matrix compute_rotation(const long rotation_seed, const int n_variables) const
             {
                 const auto random_vector = common::random::bbob2009::normal(static_cast<size_t>(n_variables) * n_variables, rotation_seed);
-                auto matrix = std::vector<std::vector<double>>(n_variables, std::vector<double>(n_variables));
+                auto matrix = bbob::Matrix(n_variables, n_variables);
 
                 // reshape
                 for (auto i = 0; i < n_variables; i++)
                     for (auto j = 0; j < n_variables; j++)
-                        matrix[i][j] = random_vector.at(static_cast<size_t>(j) * n_variables + i);
+                        matrix(i, j) = random_vector.at(static_cast<size_t>(j) * n_variables + i);
 
 
                 /*1st coordinate is row, 2nd is column.*/
@@ -100,14 +115,14 @@ namespace ioh::problem
                             prod += matrix[k][i] * matrix[k][j];
 
                         for (auto k = 0; k < n_variables; k++)
-                            matrix[k][i] -= prod * matrix[k][j];
+                            matrix(k, i) -= prod * matrix[k][j];
                     }
                     auto prod = 0.0;
                     for (auto k = 0; k < n_variables; k++)
                         prod += matrix[k][i] * matrix[k][i];
 
                     for (auto k = 0; k < n_variables; k++)
-                        matrix[k][i] /= sqrt(prod);
+                        matrix(k, i) /= sqrt(prod);
                 }
                 return matrix;
             }
@@ -121,7 +136,25 @@ namespace ioh::problem
             return transformation::objective::shift(y, objective_.y);
         }
 
+        //! Add the data of the instance which is not in its transformation state to its cached rotations
+        virtual void cache_instance_data(bbob::Rotations &) const
+        {
+        }
+
     public:
+        //! A variables transformation of the form z = matrix (x - offset) + base
+        struct AffineVariables
+        {
+            //! The offset, or nullptr for none
+            const std::vector<double> *offset;
+
+            //! The matrix, or nullptr for the identity, which has no base either
+            const bbob::Matrix *matrix;
+
+            //! The base
+            const std::vector<double> *base;
+        };
+
         /**
          * @brief Construct a new BBOB object
          * 
@@ -141,6 +174,22 @@ namespace ioh::problem
             log_info_.optimum = objective_;
         }
 
+        //! Hands over the last evaluation with the log info of BBOB, which Problem's destructor would not see.
+        ~BBOB() override { handoff_.release(); }
+
+        /**
+         * @brief The variables transformation of the instance, for the functions which only subtract an offset
+         * and apply an affine map, in the same order as their transform_variables, so that Instances can
+         * transform a point for all the instances of such a function in one pass over their stacked data
+         * 
+         * @return std::optional<AffineVariables> the transformation, or std::nullopt for the other functions
+         */
+        [[nodiscard]]
+        virtual std::optional<AffineVariables> affine_variables() const
+        {
+            return std::nullopt;
+        }
+
         //! Update the log info
         void update_log_info() override
         {
@@ -148,8 +197,38 @@ namespace ioh::problem
             log_info_.raw_y_best = state_.current_best.y - objective_.y;
             log_info_.transformed_y = state_.current.y;
             log_info_.transformed_y_best = state_.current_best.y;
-            log_info_.current = state_.current;
-            log_info_.current.y = log_info_.current.y - objective_.y;
+            log_info_.current.x = state_.current.x;
+            log_info_.current.y = state_.current.y - objective_.y;
+        }
+
+        /**
+         * @brief The rotations of the instance, which are computed and kept in bbob::RotationCache if they are
+         * not cached, so that the problems of the same instance constructed afterwards, in this process or in
+         * the processes loading them, view them instead of computing them again
+         * 
+         * @return std::shared_ptr<const bbob::Rotations> the rotations
+         */
+        [[nodiscard]]
+        std::shared_ptr<const bbob::Rotations> rotations() const
+        {
+            auto &cache = bbob::RotationCache::instance();
+            const auto n = meta_data_.n_variables;
+            if (auto cached = cache.find(transformation_state_.seed, n, transformation_state_.condition))
+                return cached;
+
+            // The transformation state of the problem may have been changed by the function.
+            const TransformationState base(meta_data_.problem_id, meta_data_.instance, n,
+                                           transformation_state_.condition);
+            auto rotations = std::make_shared<bbob::Rotations>();
+            rotations->seed = base.seed;
+            rotations->n_variables = n;
+            rotations->condition = base.condition;
+            rotations->first = base.first_rotation;
+            rotations->second = base.second_rotation;
+            rotations->product = base.second_transformation_matrix;
+            cache_instance_data(*rotations);
+            cache.insert(rotations);
+            return rotations;
         }
 
         //! Calculate the solution to the problem
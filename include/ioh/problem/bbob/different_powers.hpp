@@ -38,5 +38,13 @@ namespace ioh::problem::bbob
             for (auto i = 0; i < meta_data_.n_variables; ++i)
                 transformation_state_.exponents[i] = 2.0 + 4.0 * transformation_state_.exponents.at(i);
         }
+
+        //! The variables transformation, as applied by transform_variables
+        [[nodiscard]]
+        std::optional<AffineVariables> affine_variables() const override
+        {
+            return AffineVariables{&objective_.x, &transformation_state_.transformation_matrix,
+                                   &transformation_state_.transformation_base};
+        }
     };
 }
@@ -74,8 +74,15 @@ namespace ioh::problem::bbob
             }
         };
 
-        std::vector<std::vector<double>> x_transformation_;
-        std::vector<Peak> peaks_;
+        //! Peak centres in the rotated space, one column per peak
+        Matrix x_transformation_;
+
+        //! Peak heights, in a single row
+        Matrix heights_;
+
+        //! Peak scales, one row per peak
+        Matrix scales_;
+
         double factor_;
 
     protected:
@@ -96,26 +103,17 @@ namespace ioh::problem::bbob
                 x_transformed[i] = std::inner_product(x.begin(), x.end(),
                                                       this->transformation_state_.second_rotation.at(i).begin(), 0.0);
             }
-#if defined(__GNUC__)
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wsequence-point"
-#endif
-            auto result = 10. - std::accumulate(
-                peaks_.begin(), peaks_.end(), 0.0,
-                [&, i = 0](const double sum, const Peak &peak) mutable
-                {
-                    const auto z = std::accumulate(
-                        x_transformed.begin(), x_transformed.end(), 0.0,
-                        [&, j = 0](const double lhs, const double rhs) mutable
-                        {
-                            return lhs + peaks_.at(i).scales.at(j) * pow(rhs - x_transformation_.at(j++).at(i), 2.0);
-                        });
-                    i++;
-                    return std::max(sum, peak.value * exp(factor_ * z));
-                });
-#if defined(__GNUC__)
-            #pragma GCC diagnostic pop
-#endif
+
+            auto highest = 0.0;
+            for (size_t i = 0; i < heights_.cols(); ++i)
+            {
+                const auto scales = scales_[i];
+                auto z = 0.0;
+                for (size_t j = 0; j < x_transformed.size(); ++j)
+                    z = z + scales[j] * pow(x_transformed[j] - x_transformation_[j][i], 2.0);
+                highest = std::max(highest, heights_[0][i] * exp(factor_ * z));
+            }
+            auto result = 10. - highest;
 
             if (result > 0)
             {
@@ -148,28 +146,61 @@ namespace ioh::problem::bbob
                   const int number_of_peaks, const double b = 10., const double c = 5.0,
                   double max_condition = sqrt(1000.)) :
             BBOProblem<T>(problem_id, instance, n_variables, name),
-            x_transformation_(n_variables, std::vector<double>(number_of_peaks)),
-            peaks_(Peak::get_peaks(number_of_peaks, n_variables, this->transformation_state_.seed, max_condition)),
             factor_(-0.5 / static_cast<double>(n_variables))
         {
-            const auto random_numbers = common::random::bbob2009::uniform(
-                static_cast<size_t>(this->meta_data_.n_variables) * number_of_peaks, this->transformation_state_.seed);
+            const auto n = static_cast<size_t>(n_variables), p = static_cast<size_t>(number_of_peaks);
+            const auto cached = RotationCache::instance().find(this->transformation_state_.seed, n_variables,
+                                                               this->transformation_state_.condition);
+            const auto hit = cached != nullptr && cached->peaks() == p;
+
+            // The first n numbers are the same for any count, which is all the optimum needs.
+            const auto random_numbers =
+                common::random::bbob2009::uniform(hit ? n : n * p, this->transformation_state_.seed);
+            for (size_t i = 0; i < n; ++i)
+                this->objective_.x[i] = 0.8 * (b * random_numbers[i] - c);
+
+            if (hit)
+            {
+                x_transformation_ = Matrix::view(cached->centres.data(), n, p, cached);
+                heights_ = Matrix::view(cached->heights.data(), 1, p, cached);
+                scales_ = Matrix::view(cached->scales.data(), p, n, cached);
+                return;
+            }
 
+            const auto peaks = Peak::get_peaks(number_of_peaks, n_variables, this->transformation_state_.seed,
+                                               max_condition);
+            heights_ = Matrix(1, p);
+            scales_ = Matrix(p, n);
+            for (size_t i = 0; i < p; ++i)
+            {
+                heights_(0, i) = peaks[i].value;
+                for (size_t j = 0; j < n; ++j)
+                    scales_(i, j) = peaks[i].scales[j];
+            }
 
+            x_transformation_ = Matrix(n, p);
             for (auto i = 0; i < this->meta_data_.n_variables; ++i)
             {
-                this->objective_.x[i] = 0.8 * (b * random_numbers[i] - c);
                 for (auto j = 0; j < number_of_peaks; ++j)
                 {
                     for (auto k = 0; k < this->meta_data_.n_variables; ++k)
-                        x_transformation_[i][j] += this->transformation_state_.second_rotation[i][k] * (
+                        x_transformation_(i, j) += this->transformation_state_.second_rotation[i][k] * (
                             b * random_numbers.at(static_cast<size_t>(j) * this->meta_data_.n_variables + k) - c
                         );
                     if (j == 0)
-                        x_transformation_[i][j] *= 0.8;
+                        x_transformation_(i, j) *= 0.8;
                 }
             }
         }
+
+    protected:
+        //! Cache the peaks with the rotations
+        void cache_instance_data(Rotations &rotations) const override
+        {
+            rotations.heights = heights_;
+            rotations.scales = scales_;
+            rotations.centres = x_transformation_;
+        }
     };
 
     //! Gallaher 101 problem id 21
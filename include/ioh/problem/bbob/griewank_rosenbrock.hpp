@@ -50,7 +50,7 @@ namespace ioh::problem::bbob
                 auto sum = 0.0;
                 for (auto j = 0; j < n_variables; ++j)
                 {
-                    transformation_state_.second_rotation[i][j] *= factor;
+                    transformation_state_.second_rotation(i, j) *= factor;
                     sum += transformation_state_.second_rotation.at(j).at(i);
                 }
                 objective_.x[i] = sum / (2. * factor);
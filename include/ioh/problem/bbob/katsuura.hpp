@@ -63,5 +63,13 @@ namespace ioh::problem::bbob
             for (auto i = 1; i < 33; ++i)
                 transformation_state_.exponents[i] = pow(2., static_cast<double>(i));
         }
+
+        //! The variables transformation, as applied by transform_variables
+        [[nodiscard]]
+        std::optional<AffineVariables> affine_variables() const override
+        {
+            return AffineVariables{&objective_.x, &transformation_state_.second_transformation_matrix,
+                                   &transformation_state_.transformation_base};
+        }
     };
 }
@@ -33,12 +33,20 @@ namespace ioh::problem::bbob
                 auto sum = 0.0;
                 for (auto j = 0; j < n_variables; ++j)
                 {
-                    transformation_state_.second_transformation_matrix[i][j] = factor * transformation_state_.second_rotation.at(i).at(j);
+                    transformation_state_.second_transformation_matrix(i, j) = factor * transformation_state_.second_rotation.at(i).at(j);
                     sum += transformation_state_.second_rotation.at(j).at(i);
                 }
                 transformation_state_.transformation_base[i] = 0.5;
                 objective_.x[i] = sum / (2. * factor);
             }
         }
+
+        //! The variables transformation, as applied by transform_variables
+        [[nodiscard]]
+        std::optional<AffineVariables> affine_variables() const override
+        {
+            return AffineVariables{nullptr, &transformation_state_.second_transformation_matrix,
+                                   &transformation_state_.transformation_base};
+        }
     };
 }
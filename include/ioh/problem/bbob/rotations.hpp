@@ -0,0 +1,564 @@
+#pragma once
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "ioh/common/file.hpp"
+#include "ioh/common/log.hpp"
+
+namespace ioh::problem::bbob
+{
+    /** A row-major matrix, which either holds its values or views values held by another object, such as
+     * cached rotations or the mapping of a shared memory segment, which it keeps alive. Rows are only read
+     * through operator[] and at(), like nested vectors, and written through operator(), which first copies the
+     * values of a view, so that a problem changing its matrices never writes to the shared ones.
+     */
+    class Matrix
+    {
+    public:
+        //! A read-only row.
+        class Row
+        {
+            const double *data_;
+            size_t size_;
+
+        public:
+            //! Row of size values starting at data.
+            Row(const double *data, const size_t size) : data_(data), size_(size) {}
+
+            //! The j-th value.
+            double operator[](const size_t j) const { return data_[j]; }
+
+            //! The j-th value, checking j.
+            [[nodiscard]] double at(const size_t j) const
+            {
+                if (j >= size_)
+                    throw std::out_of_range("Matrix row index " + std::to_string(j));
+                return data_[j];
+            }
+
+            [[nodiscard]] const double *begin() const { return data_; }
+            [[nodiscard]] const double *end() const { return data_ + size_; }
+            [[nodiscard]] size_t size() const { return size_; }
+        };
+
+    private:
+        size_t rows_{};
+        size_t cols_{};
+        std::vector<double> values_;
+        std::shared_ptr<const void> owner_;
+        const double *data_{};
+
+    public:
+        Matrix() = default;
+
+        //! Matrix holding rows x cols copies of value.
+        Matrix(const size_t rows, const size_t cols, const double value = 0.) :
+            rows_(rows), cols_(cols), values_(rows * cols, value), data_(values_.data())
+        {
+        }
+
+        /** View of rows x cols values.
+         *
+         * @param data The values, row-major.
+         * @param rows The number of rows.
+         * @param cols The number of columns.
+         * @param owner The object holding the values, kept alive by the view and its copies.
+         */
+        static Matrix view(const double *data, const size_t rows, const size_t cols,
+                           std::shared_ptr<const void> owner)
+        {
+            Matrix m;
+            m.rows_ = rows;
+            m.cols_ = cols;
+            m.owner_ = std::move(owner);
+            m.data_ = data;
+            return m;
+        }
+
+        Matrix(const Matrix &other) :
+            rows_(other.rows_), cols_(other.cols_), values_(other.values_), owner_(other.owner_),
+            data_(other.is_view() ? other.data_ : values_.data())
+        {
+        }
+
+        Matrix(Matrix &&other) noexcept { swap(other); }
+
+        Matrix &operator=(Matrix other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        //! Swap two matrices.
+        void swap(Matrix &other) noexcept
+        {
+            std::swap(rows_, other.rows_);
+            std::swap(cols_, other.cols_);
+            values_.swap(other.values_);
+            owner_.swap(other.owner_);
+            std::swap(data_, other.data_);
+        }
+
+        //! The i-th row.
+        Row operator[](const size_t i) const { return {data_ + i * cols_, cols_}; }
+
+        //! The i-th row, checking i.
+        [[nodiscard]] Row at(const size_t i) const
+        {
+            if (i >= rows_)
+                throw std::out_of_range("Matrix index " + std::to_string(i));
+            return (*this)[i];
+        }
+
+        //! The value of row i and column j, for writing, which makes a view hold a copy of its values.
+        double &operator()(const size_t i, const size_t j)
+        {
+            if (is_view())
+            {
+                values_.assign(data_, data_ + rows_ * cols_);
+                owner_.reset();
+                data_ = values_.data();
+            }
+            return values_[i * cols_ + j];
+        }
+
+        //! The values, row-major.
+        [[nodiscard]] const double *data() const { return data_; }
+
+        //! Number of rows.
+        [[nodiscard]] size_t size() const { return rows_; }
+
+        //! Number of columns.
+        [[nodiscard]] size_t cols() const { return cols_; }
+
+        //! Whether the values are held by another object.
+        [[nodiscard]] bool is_view() const { return data_ != values_.data(); }
+    };
+
+    /** The rotations of a BBOB instance, and their product scaled by the conditioning, the part of its
+     * construction which takes O(n^3), e.g. 2 ms at n = 40 against a few microseconds for the rest of most
+     * functions, and for the Gallagher functions, their peaks, which take O(p n^2) for p peaks. They are kept
+     * row-major, and serialized as a fixed header followed by the 3 n^2 values of the matrices and the
+     * p (2 n + 1) values of the peaks, in the byte order of the machine, to be shared with other processes.
+     */
+    struct Rotations
+    {
+        //! Serialized header.
+        struct Header
+        {
+            char magic[8];
+            uint32_t byte_order_mark;
+            uint32_t version;
+            int64_t seed;
+            int32_t n_variables;
+            uint32_t peaks;
+            double condition;
+        };
+
+        //! Magic of the serialized rotations.
+        static constexpr char magic[8] = "IOHROTS";
+
+        //! Version of the layout.
+        static constexpr uint32_t version = 2;
+
+        //! Byte order mark, to reject data written on a machine of another byte order.
+        static constexpr uint32_t byte_order_mark = 0x01020304;
+
+        //! Seed of the transformation state.
+        long seed;
+
+        //! Dimension.
+        int n_variables;
+
+        //! Conditioning of the product.
+        double condition;
+
+        //! First rotation matrix.
+        Matrix first;
+
+        //! Second rotation matrix.
+        Matrix second;
+
+        //! first diag(condition^(i / (n - 1))) second.
+        Matrix product;
+
+        //! Heights of the Gallagher peaks, 1 x p, empty for the other functions.
+        Matrix heights;
+
+        //! Scales of the Gallagher peaks, p x n.
+        Matrix scales;
+
+        //! Centres of the Gallagher peaks in the rotated space, n x p.
+        Matrix centres;
+
+        //! Number of Gallagher peaks.
+        [[nodiscard]] size_t peaks() const { return heights.cols(); }
+
+        //! Size of the serialized rotations, in bytes.
+        [[nodiscard]] size_t serialized_size() const
+        {
+            const auto n = static_cast<size_t>(n_variables);
+            return sizeof(Header) + (3 * n * n + peaks() * (2 * n + 1)) * sizeof(double);
+        }
+
+        //! Serialize the rotations.
+        [[nodiscard]] std::string serialize() const
+        {
+            std::string data(serialized_size(), '\0');
+            Header header{};
+            std::memcpy(header.magic, magic, sizeof(magic));
+            header.byte_order_mark = byte_order_mark;
+            header.version = version;
+            header.seed = seed;
+            header.n_variables = n_variables;
+            header.peaks = static_cast<uint32_t>(peaks());
+            header.condition = condition;
+            auto *p = data.data();
+            std::memcpy(p, &header, sizeof(Header));
+            p += sizeof(Header);
+            for (const auto *m : {&first, &second, &product, &heights, &scales, &centres})
+            {
+                std::memcpy(p, m->data(), m->size() * m->cols() * sizeof(double));
+                p += m->size() * m->cols() * sizeof(double);
+            }
+            return data;
+        }
+
+        /** Deserialize rotations.
+         *
+         * @param data Start of the serialized rotations.
+         * @param size Size of the data, which may hold more after the rotations.
+         * @param used If given, receives the size of the rotations.
+         * @param owner If given, the object holding the data, which the matrices then view instead of copying
+         * them. The data must be aligned for doubles.
+         * @throws std::invalid_argument if the data are not serialized rotations of this layout and byte order.
+         */
+        static std::shared_ptr<const Rotations> deserialize(const char *data, const size_t size, size_t *used = nullptr,
+                                                            const std::shared_ptr<const void> &owner = nullptr)
+        {
+            Header header{};
+            if (size >= sizeof(Header))
+                std::memcpy(&header, data, sizeof(Header));
+            if (size < sizeof(Header) or std::memcmp(header.magic, magic, sizeof(magic)) != 0 or
+                header.byte_order_mark != byte_order_mark or header.version != version or header.n_variables <= 0 or
+                header.n_variables > 1 << 15 or header.peaks > 1 << 15)
+                throw std::invalid_argument("Not BBOB rotations of version " + std::to_string(version) + ".");
+            const auto n = static_cast<size_t>(header.n_variables), peaks = static_cast<size_t>(header.peaks);
+            if (size < sizeof(Header) + (3 * n * n + peaks * (2 * n + 1)) * sizeof(double))
+                throw std::invalid_argument("Truncated BBOB rotations.");
+
+            auto rotations = std::make_shared<Rotations>();
+            rotations->seed = static_cast<long>(header.seed);
+            rotations->n_variables = header.n_variables;
+            rotations->condition = header.condition;
+            const auto *p = data + sizeof(Header);
+            const auto read = [&](Matrix &m, const size_t rows, const size_t cols) {
+                if (owner != nullptr)
+                    m = Matrix::view(reinterpret_cast<const double *>(p), rows, cols, owner);
+                else
+                {
+                    m = Matrix(rows, cols);
+                    if (rows * cols != 0)
+                        std::memcpy(&m(0, 0), p, rows * cols * sizeof(double));
+                }
+                p += rows * cols * sizeof(double);
+            };
+            read(rotations->first, n, n);
+            read(rotations->second, n, n);
+            read(rotations->product, n, n);
+            if (peaks != 0)
+            {
+                read(rotations->heights, 1, peaks);
+                read(rotations->scales, peaks, n);
+                read(rotations->centres, n, peaks);
+            }
+            if (used != nullptr)
+                *used = rotations->serialized_size();
+            return rotations;
+        }
+    };
+
+    namespace detail
+    {
+        //! Name of a POSIX shared memory segment.
+        inline std::string shared_name(const std::string &name)
+        {
+            if (name.empty() or name.size() > 250 or name.find('/', 1) != std::string::npos)
+                throw std::invalid_argument("Invalid shared memory name: " + name);
+            return name.front() == '/' ? name : "/" + name;
+        }
+
+        //! Header of a segment of serialized rotations.
+        struct SegmentHeader
+        {
+            char magic[8];
+            uint32_t byte_order_mark;
+            uint32_t version;
+            uint64_t count;
+            uint64_t size;
+        };
+
+        //! Magic of the segments.
+        inline constexpr char segment_magic[8] = "IOHSHRD";
+    } // namespace detail
+
+    /** Process-wide cache of rotations, which the BBOB problems view instead of computing them when their
+     * instance, dimension and conditioning are found. It is only filled explicitly, by BBOB::rotations(),
+     * load() and attach(), so that constructing problems does not grow it.
+     */
+    class RotationCache
+    {
+        using Key = std::tuple<long, int, double>;
+
+        //! A cached entry, and the shared memory segment holding it, if any.
+        struct Entry
+        {
+            std::shared_ptr<const Rotations> rotations;
+            std::string segment;
+        };
+
+        mutable std::mutex mutex_;
+        std::map<Key, Entry> entries_;
+        std::set<std::string> attached_;
+
+        RotationCache() = default;
+
+    public:
+        RotationCache(const RotationCache &) = delete;
+        RotationCache &operator=(const RotationCache &) = delete;
+
+        //! The cache of the process.
+        static RotationCache &instance()
+        {
+            static RotationCache cache;
+            return cache;
+        }
+
+        //! The cached rotations of an instance, or nullptr.
+        [[nodiscard]] std::shared_ptr<const Rotations> find(const long seed, const int n_variables,
+                                                            const double condition) const
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            const auto it = entries_.find({seed, n_variables, condition});
+            return it == entries_.end() ? nullptr : it->second.rotations;
+        }
+
+        //! The shared memory segment holding the rotations of an instance, or an empty string.
+        [[nodiscard]] std::string segment(const long seed, const int n_variables, const double condition) const
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            const auto it = entries_.find({seed, n_variables, condition});
+            return it == entries_.end() ? std::string() : it->second.segment;
+        }
+
+        //! Cache rotations, keeping the ones already cached, and record their segment, if given.
+        void insert(const std::shared_ptr<const Rotations> &rotations, const std::string &segment = "")
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            auto &entry = entries_[{rotations->seed, rotations->n_variables, rotations->condition}];
+            if (entry.rotations == nullptr)
+                entry.rotations = rotations;
+            if (not segment.empty())
+                entry.segment = segment;
+        }
+
+        /** Cache consecutive serialized rotations.
+         *
+         * @param data Start of the data.
+         * @param size Size of the data.
+         * @param segment Shared memory segment holding them, if any.
+         * @param owner If given, the object holding the data, which the rotations then view instead of copying.
+         * @return The number of rotations.
+         */
+        size_t load(const char *data, const size_t size, const std::string &segment = "",
+                    const std::shared_ptr<const void> &owner = nullptr)
+        {
+            size_t count = 0;
+            for (size_t offset = 0, used = 0; offset < size; offset += used, ++count)
+                insert(Rotations::deserialize(data + offset, size - offset, &used, owner), segment);
+            return count;
+        }
+
+        //! Cache serialized rotations.
+        size_t load(const std::string &data) { return load(data.data(), data.size()); }
+
+        /** Cache the rotations of a shared memory segment written by SharedRotations, once per process. The
+         * segment stays mapped while its rotations are cached or used by problems, which read them in place.
+         *
+         * @param name Name of the segment.
+         * @throws std::runtime_error if it does not exist or is not a segment of rotations.
+         */
+        void attach(const std::string &name)
+        {
+            const auto shm = detail::shared_name(name);
+            {
+                const std::lock_guard<std::mutex> lock(mutex_);
+                if (attached_.count(shm) != 0)
+                    return;
+            }
+#ifdef IOH_HAS_MMAP
+            const int fd = ::shm_open(shm.c_str(), O_RDONLY, 0);
+            if (fd < 0)
+                throw std::runtime_error("Cannot open the shared memory segment " + shm);
+            struct stat st
+            {
+            };
+            void *addr = MAP_FAILED;
+            if (::fstat(fd, &st) == 0 and static_cast<size_t>(st.st_size) >= sizeof(detail::SegmentHeader))
+                addr = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (addr == MAP_FAILED)
+                throw std::runtime_error("Cannot map the shared memory segment " + shm);
+            const auto size = static_cast<size_t>(st.st_size);
+            const std::shared_ptr<const void> mapping(addr, [size](const void *p) {
+                ::munmap(const_cast<void *>(p), size);
+            });
+            const auto *data = static_cast<const char *>(addr);
+            detail::SegmentHeader header{};
+            std::memcpy(&header, data, sizeof(header));
+            try
+            {
+                if (std::memcmp(header.magic, detail::segment_magic, sizeof(header.magic)) != 0 or
+                    header.byte_order_mark != Rotations::byte_order_mark or header.version != Rotations::version or
+                    header.size > size - sizeof(header) or
+                    load(data + sizeof(header), static_cast<size_t>(header.size), shm, mapping) != header.count)
+                    throw std::invalid_argument("");
+            }
+            catch (const std::invalid_argument &)
+            {
+                throw std::runtime_error("Not a segment of BBOB rotations: " + shm);
+            }
+            const std::lock_guard<std::mutex> lock(mutex_);
+            attached_.insert(shm);
+            IOH_DBG(debug, "attached " << header.count << " BBOB rotations from " << shm)
+#else
+            throw std::runtime_error("Shared memory segments are only supported on POSIX systems.");
+#endif
+        }
+
+        //! Forget a segment, keeping its rotations, and its mapping while they are used.
+        void detach(const std::string &name)
+        {
+            const auto shm = detail::shared_name(name);
+            const std::lock_guard<std::mutex> lock(mutex_);
+            attached_.erase(shm);
+            for (auto &[key, entry] : entries_)
+                if (entry.segment == shm)
+                    entry.segment.clear();
+        }
+
+        //! Number of cached rotations.
+        [[nodiscard]] size_t size() const
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            return entries_.size();
+        }
+
+        //! Empty the cache.
+        void clear()
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            entries_.clear();
+            attached_.clear();
+        }
+    };
+
+    /** A POSIX shared memory segment holding serialized rotations, which other processes cache with
+     * RotationCache::attach, e.g. on unpickling a problem, so that the workers of a pool all read the instances
+     * of a benchmark from one read-only segment, instead of computing them or receiving them with each task. The rotations are cached in this process too, tagged with the segment. The segment is removed
+     * on destruction.
+     *
+     * @code
+     * // Parent
+     * bbob::SharedRotations shared("ioh-bbob", {problem.rotations(), other.rotations()});
+     * // Workers
+     * bbob::RotationCache::instance().attach("ioh-bbob");
+     * auto problem = ProblemRegistry<BBOB>::instance().create(24, 1, 40); // Without computing the rotations.
+     * @endcode
+     */
+    class SharedRotations
+    {
+        std::string name_;
+        size_t count_;
+
+    public:
+        /** Create a segment.
+         *
+         * @param name Name of the segment, replaced if it exists.
+         * @param rotations The rotations.
+         * @throws std::runtime_error if the segment cannot be created.
+         */
+        SharedRotations(const std::string &name, const std::vector<std::shared_ptr<const Rotations>> &rotations) :
+            name_(detail::shared_name(name)), count_(rotations.size())
+        {
+#ifdef IOH_HAS_MMAP
+            detail::SegmentHeader header{};
+            std::memcpy(header.magic, detail::segment_magic, sizeof(header.magic));
+            header.byte_order_mark = Rotations::byte_order_mark;
+            header.version = Rotations::version;
+            header.count = count_;
+            for (const auto &r : rotations)
+                header.size += r->serialized_size();
+            const auto size = sizeof(header) + static_cast<size_t>(header.size);
+
+            const int fd = ::shm_open(name_.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+            if (fd < 0)
+                throw std::runtime_error("Cannot create the shared memory segment " + name_);
+            void *addr = MAP_FAILED;
+            if (::ftruncate(fd, static_cast<off_t>(size)) == 0)
+                addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (addr == MAP_FAILED)
+            {
+                ::shm_unlink(name_.c_str());
+                throw std::runtime_error("Cannot map the shared memory segment " + name_);
+            }
+            auto *p = static_cast<char *>(addr);
+            std::memcpy(p, &header, sizeof(header));
+            p += sizeof(header);
+            for (const auto &r : rotations)
+            {
+                const auto data = r->serialize();
+                std::memcpy(p, data.data(), data.size());
+                p += data.size();
+            }
+            ::munmap(addr, size);
+            for (const auto &r : rotations)
+                RotationCache::instance().insert(r, name_);
+            IOH_DBG(debug, "shared " << count_ << " BBOB rotations in " << name_)
+#else
+            throw std::runtime_error("Shared memory segments are only supported on POSIX systems.");
+#endif
+        }
+
+        SharedRotations(const SharedRotations &) = delete;
+        SharedRotations &operator=(const SharedRotations &) = delete;
+
+        ~SharedRotations() { close(); }
+
+        //! Remove the segment. The processes which attached it keep their mappings while they use them.
+        void close()
+        {
+            if (name_.empty())
+                return;
+            RotationCache::instance().detach(name_);
+#ifdef IOH_HAS_MMAP
+            ::shm_unlink(name_.c_str());
+#endif
+            name_.clear();
+        }
+
+        //! Name of the segment, empty once closed.
+        [[nodiscard]] const std::string &name() const { return name_; }
+
+        //! Number of rotations.
+        [[nodiscard]] size_t size() const { return count_; }
+    };
+} // namespace ioh::problem::bbob
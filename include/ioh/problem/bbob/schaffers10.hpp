@@ -65,7 +65,7 @@ namespace ioh::problem::bbob
         {
             for (auto i = 0; i < n_variables; ++i)
                 for (auto j = 0; j < n_variables; ++j)
-                    this->transformation_state_.second_transformation_matrix[i][j] =
+                    this->transformation_state_.second_transformation_matrix(i, j) =
                         this->transformation_state_.second_rotation.at(i).at(j)
                         * pow(sqrt(condition), this->transformation_state_.exponents.at(i));
         }
@@ -47,5 +47,13 @@ namespace ioh::problem::bbob
             ceil(meta_data_.n_variables <= 40 ? 1 : meta_data_.n_variables / 40.0)))
         {
         }
+
+        //! The variables transformation, as applied by transform_variables
+        [[nodiscard]]
+        std::optional<AffineVariables> affine_variables() const override
+        {
+            return AffineVariables{&objective_.x, &transformation_state_.second_transformation_matrix,
+                                   &transformation_state_.transformation_base};
+        }
     };
 }
@@ -33,5 +33,12 @@ namespace ioh::problem::bbob
             BBOProblem(1, instance, n_variables, "Sphere")
         {
         }
+
+        //! The variables transformation, as applied by transform_variables
+        [[nodiscard]]
+        std::optional<AffineVariables> affine_variables() const override
+        {
+            return AffineVariables{&objective_.x, nullptr, nullptr};
+        }
     };
 }
\ No newline at end of file
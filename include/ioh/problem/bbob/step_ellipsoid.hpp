@@ -8,24 +8,24 @@ namespace ioh::problem::bbob
     class StepEllipsoid final : public BBOProblem<StepEllipsoid>
     {
     protected:
-        //! compute project of x
-        double compute_projection(const std::vector<double>& x)
+        //! compute project of x, in projection
+        double compute_projection(const std::vector<double>& x, std::vector<double> &projection) const
         {
             static const auto alpha = 10.0;
             auto x0 = 0.0;
             for (auto i = 0; i < meta_data_.n_variables; ++i)
             {
-                transformation_state_.transformation_base[i] = 0.0;
+                projection[i] = 0.0;
                 for (auto j = 0; j < meta_data_.n_variables; ++j)
-                    transformation_state_.transformation_base[i] += transformation_state_.conditions.at(i)
+                    projection[i] += transformation_state_.conditions.at(i)
                     * transformation_state_.second_rotation.at(i).at(j)
                     * (x.at(j) - objective_.x.at(j));
 
-                x0 = transformation_state_.transformation_base.at(0);
+                x0 = projection.at(0);
 
-                transformation_state_.transformation_base[i] = fabs(transformation_state_.transformation_base.at(i)) > .5
-                    ? floor(transformation_state_.transformation_base.at(i) + .5)
-                    : floor(alpha * transformation_state_.transformation_base.at(i) + .5) / alpha;
+                projection[i] = fabs(projection.at(i)) > .5
+                    ? floor(projection.at(i) + .5)
+                    : floor(alpha * projection.at(i) + .5) / alpha;
             }
             return x0;
         }
@@ -35,7 +35,10 @@ namespace ioh::problem::bbob
         {
             auto result = 0.0;
             auto penalty = 0.0;
-            const auto x0 = compute_projection(x);
+            // Per thread, so that the problem can be evaluated concurrently.
+            thread_local std::vector<double> projection;
+            projection.resize(meta_data_.n_variables);
+            const auto x0 = compute_projection(x, projection);
 
             for (auto i = 0; i < meta_data_.n_variables; ++i)
             {
@@ -45,7 +48,7 @@ namespace ioh::problem::bbob
 
                 auto projection_sum = 0.0;
                 for (auto j = 0; j < meta_data_.n_variables; ++j)
-                    projection_sum += transformation_state_.first_rotation[i][j] * transformation_state_.transformation_base[j];
+                    projection_sum += transformation_state_.first_rotation[i][j] * projection[j];
 
                 result += pow(100., transformation_state_.exponents.at(i))
                     * projection_sum * projection_sum;
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "ioh/problem/problem.hpp"
+
+namespace ioh::problem
+{
+    /** Evaluates a single problem from many threads at once, e.g. in asynchronous parallel algorithms.
+     *
+     * Each call takes a global evaluation id from an atomic counter, and the best-so-far is updated
+     * with a lock-free compare-and-swap on the pair (y, evaluation id), so that ties resolve to the
+     * earliest evaluation, as in a sequential run. The variables are transformed in per-thread buffers.
+     *
+     * If a logger is attached to the problem, the evaluations go through a multiple producers single
+     * consumer queue, and are replayed in the order of their ids, in the state of the problem and its
+     * logger, by whichever thread finds the queue free. The logger thus sees the sequence of events of a
+     * sequential run, and needs no synchronization. Without logger, the state of the problem is only
+     * updated by flush.
+     *
+     * While threads evaluate through this object, the problem must not be called, reset,
+     * nor attached to a logger. Its evaluation and transformations must be thread-safe,
+     * which they are for the problems of the library.
+     *
+     * @tparam T type of the problem
+     */
+    template <typename T>
+    class Concurrent
+    {
+        //! An evaluation waiting to be replayed.
+        struct Event
+        {
+            //! Its evaluation id.
+            size_t id;
+            //! The solution, with transformations.
+            Solution<T> current;
+            //! The solution, without transformations.
+            Solution<T> internal;
+
+            //! Order of the min-heap of the pending events.
+            bool operator<(const Event &other) const { return id > other.id; }
+        };
+
+        //! A node of the queue.
+        struct Node
+        {
+            std::atomic<Node *> next{nullptr};
+            Event event;
+        };
+
+        //! A best-so-far, kept until reset, since other threads may still read it.
+        struct Best
+        {
+            Solution<T> current;
+            Solution<T> internal;
+            size_t id;
+            Best *previous;
+        };
+
+        Problem<T> &problem_;
+
+        //! Number of evaluations started, the last evaluation id.
+        std::atomic<size_t> evaluations_;
+
+        std::atomic<Best *> best_;
+
+        //! Last node of the queue, where the producers append.
+        std::atomic<Node *> head_;
+
+        //! Number of nodes linked in the queue and not popped yet, transiently negative.
+        std::atomic<long long> queued_;
+
+        //! Whether a thread is replaying the events.
+        std::atomic<bool> draining_;
+
+        //! First node of the queue, already popped: owned by the consumer.
+        Node *tail_;
+
+        //! Events popped before some of their predecessors, as a min-heap: owned by the consumer.
+        std::vector<Event> pending_;
+
+        //! Id of the next event to replay: owned by the consumer.
+        size_t next_;
+
+        //! Whether (y, id) is better than the best-so-far.
+        [[nodiscard]] bool better(const double y, const size_t id, const Best &best) const
+        {
+            const auto &type = problem_.meta_data_.optimization_type;
+            return type(y, best.current.y) or (y == best.current.y and id < best.id);
+        }
+
+        void update_best(const size_t id, const std::vector<T> &x, const double y, const std::vector<T> &internal_x,
+                         const double internal_y)
+        {
+            auto *expected = best_.load(std::memory_order_acquire);
+            if (not better(y, id, *expected))
+                return;
+            auto *best = new Best{{x, y}, {internal_x, internal_y}, id, expected};
+            while (not best_.compare_exchange_weak(expected, best, std::memory_order_acq_rel,
+                                                   std::memory_order_acquire))
+            {
+                if (not better(y, id, *expected))
+                {
+                    delete best;
+                    return;
+                }
+                best->previous = expected;
+            }
+        }
+
+        void push(Event &&event)
+        {
+            auto *node = new Node{{nullptr}, std::move(event)};
+            head_.exchange(node, std::memory_order_acq_rel)->next.store(node, std::memory_order_release);
+            queued_.fetch_add(1);
+        }
+
+        /** Replay the events that are next in order.
+         *
+         * @param wait Whether to wait for the thread replaying, else leave the events to it.
+         */
+        void drain(const bool wait)
+        {
+            while (true)
+            {
+                if (draining_.exchange(true))
+                {
+                    if (not wait)
+                        return;
+                    std::this_thread::yield();
+                    continue;
+                }
+                while (auto *next = tail_->next.load(std::memory_order_acquire))
+                {
+                    pending_.push_back(std::move(next->event));
+                    std::push_heap(pending_.begin(), pending_.end());
+                    delete tail_;
+                    tail_ = next;
+                    queued_.fetch_sub(1);
+                }
+                while (not pending_.empty() and pending_.front().id == next_)
+                {
+                    std::pop_heap(pending_.begin(), pending_.end());
+                    auto &event = pending_.back();
+                    problem_.state_.current = std::move(event.current);
+                    problem_.state_.current_internal = std::move(event.internal);
+                    problem_.update_state_and_log();
+                    pending_.pop_back();
+                    ++next_;
+                }
+                draining_.store(false);
+                // A producer may have found the queue taken after the last pop.
+                if (queued_.load() <= 0)
+                    return;
+            }
+        }
+
+        //! Start from the state of the problem.
+        void init()
+        {
+            const auto &state = problem_.state_;
+            evaluations_.store(static_cast<size_t>(state.evaluations));
+            best_.store(new Best{state.current_best, state.current_best_internal, 0, nullptr});
+            next_ = static_cast<size_t>(state.evaluations) + 1;
+        }
+
+        void free_best()
+        {
+            for (auto *best = best_.load(); best != nullptr;)
+                delete std::exchange(best, best->previous);
+        }
+
+    public:
+        /** Evaluate a problem concurrently.
+         *
+         * @param problem The problem, with its logger attached if any.
+         */
+        explicit Concurrent(Problem<T> &problem) :
+            problem_(problem), queued_(0), draining_(false), tail_(new Node{}), next_(0)
+        {
+            head_.store(tail_);
+            init();
+        }
+
+        Concurrent(const Concurrent &) = delete;
+        Concurrent &operator=(const Concurrent &) = delete;
+
+        ~Concurrent()
+        {
+            flush();
+            free_best();
+            delete tail_;
+        }
+
+        //! Thread-safe call interface
+        double operator()(const std::vector<T> &x)
+        {
+            if (not problem_.check_input(x))
+                return std::numeric_limits<double>::signaling_NaN();
+
+            // Reused by the calls of the thread, unless the evaluation is queued.
+            thread_local std::vector<T> scratch;
+            scratch.assign(x.begin(), x.end());
+            auto internal_x = problem_.transform_variables(std::move(scratch));
+            const auto internal_y = problem_.evaluate(internal_x);
+            const auto y = problem_.transform_objectives(internal_y);
+
+            const auto id = evaluations_.fetch_add(1, std::memory_order_relaxed) + 1;
+            update_best(id, x, y, internal_x, internal_y);
+            if (problem_.logger_ != nullptr)
+            {
+                push({id, {x, y}, {std::move(internal_x), internal_y}});
+                drain(false);
+            }
+            else
+                scratch = std::move(internal_x);
+            return y;
+        }
+
+        /** Replay the remaining events, and update the state of the problem.
+         *
+         * Not to be called while threads evaluate.
+         */
+        void flush()
+        {
+            drain(true);
+            if (problem_.logger_ != nullptr)
+                return;
+            const auto *best = best_.load();
+            auto &state = problem_.state_;
+            state.evaluations = static_cast<int>(evaluations_.load());
+            state.current_best = best->current;
+            state.current_best_internal = best->internal;
+            state.optimum_found = best->current.y == problem_.objective_.y;
+        }
+
+        //! Flush, then reset the problem. Not to be called while threads evaluate.
+        void reset()
+        {
+            flush();
+            problem_.reset();
+            free_best();
+            init();
+        }
+
+        //! Number of evaluations started so far.
+        [[nodiscard]] size_t evaluations() const { return evaluations_.load(std::memory_order_relaxed); }
+
+        //! Best solution so far, with transformations.
+        [[nodiscard]] Solution<T> current_best() const { return best_.load(std::memory_order_acquire)->current; }
+
+        //! Whether the optimum has been found.
+        [[nodiscard]] bool optimum_found() const
+        {
+            return best_.load(std::memory_order_acquire)->current.y == problem_.objective_.y;
+        }
+
+        //! The problem.
+        [[nodiscard]] Problem<T> &problem() { return problem_; }
+    };
+} // namespace ioh::problem
@@ -0,0 +1,749 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ioh/common/file.hpp"
+#include "ioh/common/log.hpp"
+#include "ioh/problem/problem.hpp"
+
+#ifdef IOH_HAS_MMAP
+#include <csignal>
+#include <spawn.h>
+#include <sys/wait.h>
+extern char **environ;
+#endif
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace ioh::problem
+{
+    /** Evaluation of problems in worker processes, e.g. simulators, through shared memory.
+     *
+     * Each worker has a POSIX shared memory segment, created by the parent, whose name it receives in the
+     * IOH_EXTERNAL_SEGMENT environment variable. The worker writes the meta data and bounds of its problem in
+     * the header of the segment (the handshake), then evaluates the candidates the parent writes in a ring of
+     * slots, each holding the variables and the value of a candidate. The parent and the worker publish the
+     * number of candidates requested and completed in two counters, and sleep on them with futexes on Linux,
+     * or poll them on the other POSIX systems, so that a batch costs two wake-ups and no copy nor system call
+     * per candidate.
+     */
+    namespace external
+    {
+        //! Environment variable giving its segment to a worker.
+        inline constexpr const char *segment_variable = "IOH_EXTERNAL_SEGMENT";
+
+        //! Magic of the segments.
+        inline constexpr char magic[8] = "IOHEXTN";
+
+        //! Version of the layout.
+        inline constexpr uint32_t version = 1;
+
+        //! Byte order mark.
+        inline constexpr uint32_t byte_order_mark = 0x01020304;
+
+        //! Header of a segment, followed by the bounds, and the ring.
+        struct Header
+        {
+            char magic[8];
+            uint32_t byte_order_mark;
+            uint32_t version;
+            //! Capacity of the bounds.
+            uint32_t max_variables;
+            //! Process id of the parent.
+            int32_t parent;
+            //! Size of the ring, in bytes.
+            uint64_t ring_size;
+
+            //! Set by the worker once it has written the fields below and the bounds.
+            std::atomic<uint32_t> ready;
+            int32_t problem_id;
+            int32_t instance;
+            int32_t n_variables;
+            int32_t maximization;
+            int32_t integer;
+            char name[128];
+
+            //! Number of candidates written by the parent, modulo 2^32.
+            alignas(64) std::atomic<uint32_t> requested;
+            //! Number of candidates evaluated by the worker, modulo 2^32.
+            alignas(64) std::atomic<uint32_t> completed;
+            //! Set by the parent to stop the worker.
+            alignas(64) std::atomic<uint32_t> closed;
+        };
+
+        //! Offset of the bounds, lower then upper, in a segment.
+        inline constexpr size_t bounds_offset = (sizeof(Header) + 63) / 64 * 64;
+
+        //! Offset of the ring in a segment.
+        [[nodiscard]] inline size_t ring_offset(const size_t max_variables)
+        {
+            return bounds_offset + 2 * max_variables * sizeof(double);
+        }
+
+        //! Number of slots of a ring, a power of two so that the counters can wrap.
+        [[nodiscard]] inline size_t nb_slots(const size_t ring_size, const size_t n_variables)
+        {
+            size_t slots = 1;
+            while (2 * slots * (n_variables + 1) * sizeof(double) <= ring_size)
+                slots *= 2;
+            return slots;
+        }
+
+        namespace detail
+        {
+            [[noreturn]] inline void unsupported()
+            {
+                throw std::runtime_error("External problems are only supported on POSIX systems.");
+            }
+
+            //! Sleep while word holds value, for at most timeout.
+            inline void wait(std::atomic<uint32_t> &word, const uint32_t value, const std::chrono::milliseconds timeout)
+            {
+                for (auto i = 0; i < 64; ++i)
+                    if (word.load(std::memory_order_acquire) != value)
+                        return;
+#if defined(__linux__)
+                timespec ts{static_cast<time_t>(timeout.count() / 1000),
+                            static_cast<long>(timeout.count() % 1000) * 1000000};
+                ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, value, &ts, nullptr, 0);
+#else
+                const auto end = std::chrono::steady_clock::now() + timeout;
+                while (word.load(std::memory_order_acquire) == value and std::chrono::steady_clock::now() < end)
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+#endif
+            }
+
+            //! Wake the processes sleeping on word.
+            inline void wake(std::atomic<uint32_t> &word)
+            {
+#if defined(__linux__)
+                ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+                (void)word;
+#endif
+            }
+
+            //! A mapped shared memory segment, removed on destruction by its creator.
+            class Segment
+            {
+                std::string name_;
+                char *data_ = nullptr;
+                size_t size_ = 0;
+                bool owner_ = false;
+
+            public:
+                /** Create or open a segment.
+                 *
+                 * @param name Name of the segment.
+                 * @param size Size to create, 0 to open an existing segment.
+                 */
+                Segment(std::string name, const size_t size) : name_(std::move(name)), owner_(size != 0)
+                {
+#ifdef IOH_HAS_MMAP
+                    const int fd = owner_ ? ::shm_open(name_.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600)
+                                          : ::shm_open(name_.c_str(), O_RDWR, 0);
+                    if (fd < 0)
+                        throw std::runtime_error("Cannot open the shared memory segment " + name_);
+                    struct stat st
+                    {
+                    };
+                    void *addr = MAP_FAILED;
+                    if (owner_ ? ::ftruncate(fd, static_cast<off_t>(size)) == 0
+                               : ::fstat(fd, &st) == 0 and static_cast<size_t>(st.st_size) >= sizeof(Header))
+                    {
+                        size_ = owner_ ? size : static_cast<size_t>(st.st_size);
+                        addr = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                    }
+                    ::close(fd);
+                    if (addr == MAP_FAILED)
+                    {
+                        if (owner_)
+                            ::shm_unlink(name_.c_str());
+                        throw std::runtime_error("Cannot map the shared memory segment " + name_);
+                    }
+                    data_ = static_cast<char *>(addr);
+#else
+                    unsupported();
+#endif
+                }
+
+                Segment(const Segment &) = delete;
+                Segment &operator=(const Segment &) = delete;
+
+                ~Segment()
+                {
+#ifdef IOH_HAS_MMAP
+                    if (data_ != nullptr)
+                        ::munmap(data_, size_);
+                    if (owner_)
+                        ::shm_unlink(name_.c_str());
+#endif
+                }
+
+                [[nodiscard]] const std::string &name() const { return name_; }
+                [[nodiscard]] char *data() const { return data_; }
+                [[nodiscard]] size_t size() const { return size_; }
+                [[nodiscard]] Header &header() const { return *reinterpret_cast<Header *>(data_); }
+                [[nodiscard]] double *bounds() const { return reinterpret_cast<double *>(data_ + bounds_offset); }
+                [[nodiscard]] double *ring() const
+                {
+                    return reinterpret_cast<double *>(data_ + ring_offset(header().max_variables));
+                }
+            };
+        } // namespace detail
+
+        //! Options of the parent.
+        struct Options
+        {
+            //! Size of the ring of each worker, in bytes.
+            size_t ring_size = size_t{1} << 20;
+
+            //! Maximal dimension of the problems.
+            size_t max_variables = 4096;
+
+            //! Time given to the workers to complete the handshake, or to exit when closed.
+            std::chrono::milliseconds timeout{10000};
+
+            //! Number of restarts of a failed worker in a row, without completing a candidate, before giving up.
+            size_t max_restarts = 3;
+
+            /** Time given to a worker to evaluate a candidate, zero for no limit.
+             *
+             * A worker which does not complete a candidate in time is killed and restarted, as if it had crashed.
+             */
+            std::chrono::milliseconds evaluation_timeout{0};
+        };
+
+        /** The worker side: answers the requests of the parent which spawned the process.
+         *
+         * @code
+         * int main()
+         * {
+         *     external::Worker<double> worker(MetaData(1, 1, "Simulator", 10), Constraint<double>(10, -5, 5));
+         *     worker.run([](const std::vector<double> &x) { return simulate(x); });
+         * }
+         * @endcode
+         *
+         * @tparam T type of the variables
+         */
+        template <typename T>
+        class Worker
+        {
+            detail::Segment segment_;
+            size_t n_variables_;
+
+        public:
+            /** Connect to the segment and complete the handshake.
+             *
+             * @param meta_data Meta data of the problem.
+             * @param constraint Its bounds.
+             * @param segment Name of the segment, by default the one given by the parent.
+             * @throws std::runtime_error if the segment cannot be opened, or the problem does not fit it.
+             */
+            Worker(const MetaData &meta_data, const Constraint<T> &constraint,
+                   const std::string &segment = std::getenv(segment_variable) != nullptr
+                       ? std::getenv(segment_variable)
+                       : "") :
+                segment_(segment, 0), n_variables_(static_cast<size_t>(meta_data.n_variables))
+            {
+                auto &h = segment_.header();
+                if (std::memcmp(h.magic, magic, sizeof(magic)) != 0 or h.byte_order_mark != byte_order_mark or
+                    h.version != version or segment_.size() < ring_offset(h.max_variables) + h.ring_size)
+                    throw std::runtime_error("Not an external problem segment of version " + std::to_string(version) +
+                                             ": " + segment);
+                if (n_variables_ == 0 or n_variables_ > h.max_variables or
+                    nb_slots(h.ring_size, n_variables_) * (n_variables_ + 1) * sizeof(double) > h.ring_size or
+                    constraint.lb.size() != n_variables_ or constraint.ub.size() != n_variables_)
+                    throw std::runtime_error("The problem does not fit the segment " + segment);
+
+                h.problem_id = meta_data.problem_id;
+                h.instance = meta_data.instance;
+                h.n_variables = meta_data.n_variables;
+                h.maximization = meta_data.optimization_type == common::OptimizationType::Maximization;
+                h.integer = std::is_integral_v<T>;
+                std::memset(h.name, 0, sizeof(h.name));
+                std::memcpy(h.name, meta_data.name.data(), std::min(meta_data.name.size(), sizeof(h.name) - 1));
+                auto *bounds = segment_.bounds();
+                for (size_t i = 0; i < n_variables_; ++i)
+                {
+                    bounds[i] = static_cast<double>(constraint.lb[i]);
+                    bounds[h.max_variables + i] = static_cast<double>(constraint.ub[i]);
+                }
+                h.ready.store(1, std::memory_order_release);
+                detail::wake(h.ready);
+            }
+
+            /** Evaluate the candidates until the parent closes the segment or exits.
+             *
+             * @param f The objective function.
+             */
+            template <typename F>
+            void run(F &&f)
+            {
+                auto &h = segment_.header();
+                auto *ring = segment_.ring();
+                const auto slots = nb_slots(h.ring_size, n_variables_);
+                const auto slot_size = n_variables_ + 1;
+                std::vector<T> x(n_variables_);
+                auto done = h.completed.load(std::memory_order_acquire);
+                while (true)
+                {
+                    const auto requested = h.requested.load(std::memory_order_acquire);
+                    if (requested == done)
+                    {
+                        if (h.closed.load(std::memory_order_acquire) != 0)
+                            return;
+#ifdef IOH_HAS_MMAP
+                        if (::kill(h.parent, 0) != 0 and errno == ESRCH)
+                            return;
+#endif
+                        detail::wait(h.requested, done, std::chrono::milliseconds(100));
+                        continue;
+                    }
+                    for (; done != requested; h.completed.store(++done, std::memory_order_release))
+                    {
+                        auto *slot = ring + (done % slots) * slot_size;
+                        for (size_t i = 0; i < n_variables_; ++i)
+                            x[i] = static_cast<T>(slot[i]);
+                        slot[n_variables_] = static_cast<double>(f(x));
+                    }
+                    detail::wake(h.completed);
+                }
+            }
+        };
+
+        /** The parent side of a worker: spawns it, and evaluates batches on it, restarting it if it crashes.
+         */
+        class Process
+        {
+            std::vector<std::string> command_;
+            Options options_;
+            detail::Segment segment_;
+#ifdef IOH_HAS_MMAP
+            pid_t pid_ = -1;
+#endif
+            size_t restarts_ = 0;
+            size_t failures_ = 0;
+            //! When the worker last completed a candidate, or was given the current batch.
+            std::chrono::steady_clock::time_point progress_;
+
+            // The current batch: candidates first_ + k are at the ring sequences base_ + k.
+            const double *xs_ = nullptr;
+            double *ys_ = nullptr;
+            size_t count_ = 0, sent_ = 0, received_ = 0, first_ = 0;
+            uint32_t base_ = 0;
+
+            static std::string unique_name()
+            {
+                static std::atomic<size_t> counter{0};
+#ifdef IOH_HAS_MMAP
+                const auto pid = static_cast<long>(::getpid());
+#else
+                const long pid = 0;
+#endif
+                return "/ioh-external-" + std::to_string(pid) + "-" + std::to_string(counter++);
+            }
+
+            [[nodiscard]] Header &header() const { return segment_.header(); }
+
+            [[nodiscard]] size_t n_variables() const { return static_cast<size_t>(header().n_variables); }
+
+            //! Start the worker, and wait for its handshake.
+            void spawn()
+            {
+#ifdef IOH_HAS_MMAP
+                auto &h = header();
+                h.ready.store(0);
+                h.requested.store(0);
+                h.completed.store(0);
+                h.closed.store(0);
+
+                std::vector<std::string> environment;
+                for (auto **e = environ; *e != nullptr; ++e)
+                    if (std::strncmp(*e, segment_variable, std::strlen(segment_variable)) != 0 or
+                        (*e)[std::strlen(segment_variable)] != '=')
+                        environment.emplace_back(*e);
+                environment.push_back(std::string(segment_variable) + "=" + segment_.name());
+                const auto pointers = [](std::vector<std::string> &strings) {
+                    std::vector<char *> result;
+                    for (auto &s : strings)
+                        result.push_back(s.data());
+                    result.push_back(nullptr);
+                    return result;
+                };
+                auto argv = pointers(command_);
+                auto envp = pointers(environment);
+                if (::posix_spawnp(&pid_, argv[0], nullptr, nullptr, argv.data(), envp.data()) != 0)
+                {
+                    pid_ = -1;
+                    throw std::runtime_error("Cannot start the worker " + command_.front());
+                }
+
+                const auto end = std::chrono::steady_clock::now() + options_.timeout;
+                while (h.ready.load(std::memory_order_acquire) == 0)
+                {
+                    if (not alive())
+                        throw std::runtime_error("The worker " + command_.front() + " exited during the handshake.");
+                    if (std::chrono::steady_clock::now() > end)
+                    {
+                        stop();
+                        throw std::runtime_error("The worker " + command_.front() + " did not complete the handshake.");
+                    }
+                    detail::wait(h.ready, 0, std::chrono::milliseconds(20));
+                }
+                if (h.n_variables <= 0 or static_cast<size_t>(h.n_variables) > h.max_variables)
+                {
+                    stop();
+                    throw std::runtime_error("Invalid dimension in the handshake of " + command_.front());
+                }
+                IOH_DBG(debug, "started worker " << pid_ << " on " << segment_.name())
+#else
+                detail::unsupported();
+#endif
+            }
+
+            //! Ask the worker to exit, and kill it if it does not in time.
+            void stop()
+            {
+#ifdef IOH_HAS_MMAP
+                if (pid_ <= 0)
+                    return;
+                header().closed.store(1, std::memory_order_release);
+                detail::wake(header().requested);
+                const auto end = std::chrono::steady_clock::now() + options_.timeout;
+                while (alive() and std::chrono::steady_clock::now() < end)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                kill();
+#endif
+            }
+
+            //! Kill the worker (if it runs).
+            void kill()
+            {
+#ifdef IOH_HAS_MMAP
+                if (pid_ > 0)
+                {
+                    ::kill(pid_, SIGKILL);
+                    ::waitpid(pid_, nullptr, 0);
+                    pid_ = -1;
+                }
+#endif
+            }
+
+            /** Restart the failed worker, and resend the candidates it had not completed.
+             *
+             * @param failure What happened to the worker, for the messages.
+             */
+            void restart(const std::string &failure)
+            {
+                if (++failures_ > options_.max_restarts)
+                    throw std::runtime_error("The worker " + command_.front() + " " + failure + " " +
+                                             std::to_string(failures_) + " times in a row.");
+                IOH_DBG(warning, "restarting the worker " << command_.front() << ", which " << failure)
+                const auto handshake = std::make_tuple(header().problem_id, header().instance, header().n_variables,
+                                                       header().maximization, header().integer);
+                spawn();
+                ++restarts_;
+                if (handshake != std::make_tuple(header().problem_id, header().instance, header().n_variables,
+                                                 header().maximization, header().integer))
+                    throw std::runtime_error("The restarted worker " + command_.front() + " has another problem.");
+                first_ = received_;
+                sent_ = received_;
+                base_ = 0;
+                progress_ = std::chrono::steady_clock::now();
+            }
+
+        public:
+            /** Start a worker.
+             *
+             * @param command The executable, searched in the PATH, and its arguments.
+             * @param options The options.
+             * @throws std::runtime_error if it cannot be started, or does not complete the handshake.
+             */
+            Process(std::vector<std::string> command, const Options &options = {}) :
+                command_(std::move(command)), options_(options),
+                segment_(unique_name(), ring_offset(options.max_variables) + options.ring_size)
+            {
+                if (command_.empty())
+                    throw std::invalid_argument("Empty worker command.");
+                auto &h = header();
+                std::memcpy(h.magic, magic, sizeof(magic));
+                h.byte_order_mark = byte_order_mark;
+                h.version = version;
+                h.max_variables = static_cast<uint32_t>(options.max_variables);
+                h.ring_size = options.ring_size;
+#ifdef IOH_HAS_MMAP
+                h.parent = static_cast<int32_t>(::getpid());
+#endif
+                spawn();
+            }
+
+            Process(const Process &) = delete;
+            Process &operator=(const Process &) = delete;
+
+            ~Process() { stop(); }
+
+            //! Whether the worker runs, reaping it if it exited.
+            [[nodiscard]] bool alive()
+            {
+#ifdef IOH_HAS_MMAP
+                if (pid_ > 0 and ::waitpid(pid_, nullptr, WNOHANG) == pid_)
+                    pid_ = -1;
+                return pid_ > 0;
+#else
+                return false;
+#endif
+            }
+
+            //! The meta data given by the worker.
+            [[nodiscard]] MetaData meta_data() const
+            {
+                const auto &h = header();
+                return MetaData(h.problem_id, h.instance, std::string(h.name, strnlen(h.name, sizeof(h.name))),
+                                h.n_variables,
+                                h.maximization != 0 ? common::OptimizationType::Maximization
+                                                    : common::OptimizationType::Minimization);
+            }
+
+            //! The bounds given by the worker.
+            template <typename T>
+            [[nodiscard]] Constraint<T> constraint() const
+            {
+                if (header().integer != static_cast<int32_t>(std::is_integral_v<T>))
+                    throw std::runtime_error("The worker " + command_.front() + " has variables of another type.");
+                const auto *bounds = segment_.bounds();
+                const auto n = n_variables();
+                std::vector<T> lb(n), ub(n);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    lb[i] = static_cast<T>(bounds[i]);
+                    ub[i] = static_cast<T>(bounds[header().max_variables + i]);
+                }
+                return {lb, ub};
+            }
+
+            //! Number of restarts of the worker.
+            [[nodiscard]] size_t restarts() const { return restarts_; }
+
+            /** Start evaluating a batch, until pump returns true.
+             *
+             * @param xs The candidates, n_variables values each.
+             * @param ys Receives their values.
+             * @param count Number of candidates.
+             */
+            void start(const double *xs, double *ys, const size_t count)
+            {
+                xs_ = xs;
+                ys_ = ys;
+                count_ = count;
+                sent_ = received_ = first_ = 0;
+                base_ = header().requested.load(std::memory_order_relaxed);
+                progress_ = std::chrono::steady_clock::now();
+            }
+
+            //! Collect the completed values, and send as many candidates as fit the ring. True once the batch is done.
+            bool pump()
+            {
+                auto &h = header();
+                auto *ring = segment_.ring();
+                const auto n = n_variables();
+                const auto slots = nb_slots(h.ring_size, n);
+                const auto completed = h.completed.load(std::memory_order_acquire);
+                if (received_ < first_ + static_cast<uint32_t>(completed - base_))
+                {
+                    failures_ = 0;
+                    progress_ = std::chrono::steady_clock::now();
+                }
+                for (; received_ < first_ + static_cast<uint32_t>(completed - base_); ++received_)
+                    ys_[received_] = ring[(static_cast<uint32_t>(base_ + (received_ - first_)) % slots) * (n + 1) + n];
+
+                const auto sent = sent_;
+                for (; sent_ < count_ and static_cast<uint32_t>(base_ + (sent_ - first_) - completed) < slots; ++sent_)
+                    std::memcpy(ring + (static_cast<uint32_t>(base_ + (sent_ - first_)) % slots) * (n + 1),
+                                xs_ + sent_ * n, n * sizeof(double));
+                if (sent_ != sent)
+                {
+                    h.requested.store(static_cast<uint32_t>(base_ + (sent_ - first_)), std::memory_order_release);
+                    detail::wake(h.requested);
+                }
+                return received_ == count_;
+            }
+
+            /** Sleep until the worker completes a candidate, for at most timeout.
+             *
+             * Restart the worker if it crashed, or if it exceeded the evaluation timeout (see Options).
+             *
+             * @throws std::runtime_error if the worker failed too many times in a row.
+             */
+            void wait(const std::chrono::milliseconds timeout)
+            {
+                auto &h = header();
+                const auto completed = h.completed.load(std::memory_order_acquire);
+                if (received_ < first_ + static_cast<uint32_t>(completed - base_))
+                    return;
+                detail::wait(h.completed, completed, timeout);
+                if (h.completed.load(std::memory_order_acquire) != completed)
+                    return;
+                if (not alive())
+                    restart("crashed");
+                else if (options_.evaluation_timeout.count() > 0 and
+                         std::chrono::steady_clock::now() - progress_ > options_.evaluation_timeout)
+                {
+                    kill();
+                    restart("timed out");
+                }
+            }
+        };
+    } // namespace external
+
+    /** A problem evaluated by worker processes, e.g. simulators, which give its meta data and bounds.
+     *
+     * Batches of candidates are split between the workers and evaluated in parallel, then recorded in the
+     * state of the problem and its logger in their order, as if evaluated one by one. Single candidates are
+     * sent to the workers in turn. A worker which crashes, or exceeds the evaluation timeout of the options,
+     * is restarted, and its pending candidates resent.
+     * The workers are defined with external::Worker, and only supported on POSIX systems.
+     *
+     * @code
+     * ExternalProblem<double> problem({"./simulator", "--fidelity", "2"}, 4);
+     * const auto ys = problem(candidates);
+     * @endcode
+     *
+     * @tparam T type of the problem
+     */
+    template <typename T>
+    class ExternalProblem final : public Problem<T>
+    {
+        std::vector<std::unique_ptr<external::Process>> workers_;
+        size_t next_ = 0;
+        std::vector<double> xs_, ys_;
+
+        static std::vector<std::unique_ptr<external::Process>>
+        start(const std::vector<std::string> &command, const size_t nb_workers, const external::Options &options)
+        {
+            std::vector<std::unique_ptr<external::Process>> workers;
+            for (size_t w = 0; w < std::max<size_t>(1, nb_workers); ++w)
+            {
+                workers.push_back(std::make_unique<external::Process>(command, options));
+                if (not(workers.back()->meta_data() == workers.front()->meta_data()))
+                    throw std::runtime_error("The workers " + command.front() + " give different problems.");
+            }
+            return workers;
+        }
+
+        ExternalProblem(std::vector<std::unique_ptr<external::Process>> workers) :
+            Problem<T>(workers.front()->meta_data(), workers.front()->template constraint<T>()),
+            workers_(std::move(workers))
+        {
+        }
+
+        //! Evaluate the candidates in xs_ into ys_, split between the workers.
+        void evaluate_all(const size_t count)
+        {
+            const auto n = static_cast<size_t>(this->meta_data_.n_variables);
+            const auto nb_workers = std::min(workers_.size(), count);
+            ys_.resize(count);
+            for (size_t w = 0; w < nb_workers; ++w)
+            {
+                const auto begin = count * w / nb_workers, end = count * (w + 1) / nb_workers;
+                workers_[(next_ + w) % workers_.size()]->start(xs_.data() + begin * n, ys_.data() + begin,
+                                                               end - begin);
+            }
+            while (true)
+            {
+                external::Process *pending = nullptr;
+                for (size_t w = 0; w < nb_workers; ++w)
+                    if (auto &worker = workers_[(next_ + w) % workers_.size()]; not worker->pump() and pending == nullptr)
+                        pending = worker.get();
+                if (pending == nullptr)
+                    break;
+                pending->wait(std::chrono::milliseconds(50));
+            }
+            next_ = (next_ + nb_workers) % workers_.size();
+        }
+
+    protected:
+        //! Evaluate a candidate on the next worker.
+        double evaluate(const std::vector<T> &x) override
+        {
+            xs_.assign(x.begin(), x.end());
+            evaluate_all(1);
+            return ys_.front();
+        }
+
+    public:
+        /** Start the workers.
+         *
+         * @param command The executable of the workers, searched in the PATH, and its arguments.
+         * @param nb_workers The number of workers.
+         * @param options The options.
+         * @throws std::runtime_error if a worker cannot be started, does not complete the handshake, or gives
+         * another problem than the first.
+         */
+        explicit ExternalProblem(const std::vector<std::string> &command, const size_t nb_workers = 1,
+                                 const external::Options &options = {}) :
+            ExternalProblem(start(command, nb_workers, options))
+        {
+        }
+
+        using Problem<T>::operator();
+
+        /** Evaluate a batch of candidates on the workers.
+         *
+         * @param xs The candidates.
+         * @return Their values, NaN for the invalid candidates.
+         */
+        std::vector<double> operator()(const std::vector<std::vector<T>> &xs)
+        {
+            std::vector<double> result(xs.size(), std::numeric_limits<double>::signaling_NaN());
+            std::vector<size_t> valid;
+            std::vector<std::vector<T>> internal;
+            xs_.clear();
+            for (size_t k = 0; k < xs.size(); ++k)
+                if (this->check_input(xs[k]))
+                {
+                    valid.push_back(k);
+                    internal.push_back(this->transform_variables(xs[k]));
+                    xs_.insert(xs_.end(), internal.back().begin(), internal.back().end());
+                }
+            if (valid.empty())
+                return result;
+            evaluate_all(valid.size());
+            for (size_t v = 0; v < valid.size(); ++v)
+            {
+                auto &state = this->state_;
+                state.current.x = xs[valid[v]];
+                state.current_internal.x = std::move(internal[v]);
+                state.current_internal.y = ys_[v];
+                state.current.y = this->transform_objectives(ys_[v]);
+                this->update_state_and_log();
+                result[valid[v]] = state.current.y;
+            }
+            return result;
+        }
+
+        //! Number of workers.
+        [[nodiscard]] size_t nb_workers() const { return workers_.size(); }
+
+        //! Number of restarts of crashed workers.
+        [[nodiscard]] size_t restarts() const
+        {
+            size_t restarts = 0;
+            for (const auto &w : workers_)
+                restarts += w->restarts();
+            return restarts;
+        }
+    };
+} // namespace ioh::problem
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <algorithm>
+
+#include "ioh/common/kernels.hpp"
+#include "ioh/problem/problem.hpp"
+#include "ioh/problem/bbob/bbob_problem.hpp"
+
+namespace ioh::problem
+{
+    /** Evaluates points on many instances of a problem at once, e.g. all the instances of a BBOB function,
+     * for landscape and instance similarity studies.
+     *
+     * The instances are created once, and their data is stacked: optima() holds the optimal points, one row per
+     * instance, and optimum_values() the optimal values. For the BBOB functions whose variables transformation
+     * is affine (BBOB::affine_variables), the offsets, matrices and bases of all the instances are stacked too,
+     * and a point is transformed for all of them in one pass (common::kernels::accumulate_columns), accumulating
+     * column by column over the instances, which vectorizes while adding the terms of each coordinate in the
+     * same order as the problems. The other
+     * functions go through the transformations of each instance, in a buffer per instance. The evaluations
+     * skip the logger and the state of the problems, except the current point which some objective
+     * transformations penalize, and give the same values as calling each problem.
+     *
+     * @tparam T type of the problem
+     */
+    template <typename T>
+    class Instances
+    {
+        std::vector<std::shared_ptr<Problem<T>>> problems_;
+
+        std::vector<int> instances_;
+
+        int n_variables_;
+
+        //! Optimal points of the instances, instance-major.
+        std::vector<T> optima_;
+
+        std::vector<double> optimum_values_;
+
+        //! Buffer of the transformations, per instance.
+        std::vector<std::vector<T>> scratch_;
+
+        //! Whether the variables transformations are stacked.
+        bool stacked_{};
+
+        //! Stacked offsets, instance-major, zero for the functions without offset.
+        std::vector<double> offsets_;
+
+        //! Stacked matrices, column-major: column j of row i of instance k is at (j * size() + k) * n + i.
+        //! Empty for the identity.
+        std::vector<double> columns_;
+
+        //! Stacked bases, instance-major.
+        std::vector<double> bases_;
+
+        //! Stacked differences between the point and the offsets, instance-major.
+        std::vector<double> differences_;
+
+        //! Stacked transformed variables, instance-major.
+        std::vector<double> z_;
+
+    public:
+        /** Use the given instances of a problem.
+         *
+         * @param problems The problems, e.g. the instances of a function, with the same id and dimension.
+         * @throws std::invalid_argument if there are none, or their ids or dimensions differ.
+         */
+        explicit Instances(std::vector<std::shared_ptr<Problem<T>>> problems) :
+            problems_(std::move(problems)), n_variables_(0), scratch_(problems_.size())
+        {
+            if (problems_.empty())
+                throw std::invalid_argument("Instances need at least one problem.");
+            const auto first = problems_.front()->meta_data();
+            n_variables_ = first.n_variables;
+            for (const auto &problem : problems_)
+            {
+                const auto meta_data = problem->meta_data();
+                if (meta_data.problem_id != first.problem_id or meta_data.n_variables != n_variables_)
+                    throw std::invalid_argument("The problems of Instances must have the same id and dimension.");
+                const auto objective = problem->objective();
+                instances_.push_back(meta_data.instance);
+                optima_.insert(optima_.end(), objective.x.begin(), objective.x.end());
+                optimum_values_.push_back(objective.y);
+            }
+            if constexpr (std::is_same_v<T, double>)
+                stack();
+        }
+
+        /** Create instances of a registered problem.
+         *
+         * @param problem_id The id of the problem, e.g. of a BBOB function.
+         * @param instances The ids of the instances.
+         * @param n_variables The dimension.
+         */
+        Instances(const int problem_id, const std::vector<int> &instances, const int n_variables) :
+            Instances(create(ProblemRegistry<Problem<T>>::instance().map().at(problem_id), instances, n_variables))
+        {
+        }
+
+        /** Create instances of a registered problem.
+         *
+         * @param problem_name The name of the problem, e.g. of a BBOB function.
+         * @param instances The ids of the instances.
+         * @param n_variables The dimension.
+         */
+        Instances(const std::string &problem_name, const std::vector<int> &instances, const int n_variables) :
+            Instances(create(problem_name, instances, n_variables))
+        {
+        }
+
+        /** Evaluate a point on all the instances.
+         *
+         * @param x The point.
+         * @param y The values, one per instance, NaN if the point is not valid.
+         */
+        void operator()(const std::vector<T> &x, double *y)
+        {
+            Problem<T> &first = *problems_.front();
+            if (not first.check_input(x))
+            {
+                std::fill_n(y, problems_.size(), std::numeric_limits<double>::signaling_NaN());
+                return;
+            }
+            if constexpr (std::is_same_v<T, double>)
+                if (stacked_)
+                    transform_stacked(x);
+            for (size_t k = 0; k < problems_.size(); ++k)
+            {
+                Problem<T> &problem = *problems_[k];
+                problem.state_.current.x.assign(x.begin(), x.end());
+                if (stacked_)
+                    scratch_[k].assign(z_.begin() + k * n_variables_, z_.begin() + (k + 1) * n_variables_);
+                else
+                {
+                    scratch_[k].assign(x.begin(), x.end());
+                    scratch_[k] = problem.transform_variables(std::move(scratch_[k]));
+                }
+                y[k] = problem.transform_objectives(problem.evaluate(scratch_[k]));
+            }
+        }
+
+        //! Evaluate a point on all the instances, one value per instance.
+        [[nodiscard]] std::vector<double> operator()(const std::vector<T> &x)
+        {
+            std::vector<double> y(problems_.size());
+            (*this)(x, y.data());
+            return y;
+        }
+
+        //! Evaluate points on all the instances, point-major: the value of point p on instance k is at p * size() + k.
+        [[nodiscard]] std::vector<double> operator()(const std::vector<std::vector<T>> &xs)
+        {
+            std::vector<double> y(xs.size() * problems_.size());
+            for (size_t p = 0; p < xs.size(); ++p)
+                (*this)(xs[p], y.data() + p * problems_.size());
+            return y;
+        }
+
+        //! Number of instances.
+        [[nodiscard]] size_t size() const { return problems_.size(); }
+
+        //! Ids of the instances.
+        [[nodiscard]] const std::vector<int> &instances() const { return instances_; }
+
+        //! Dimension of the problems.
+        [[nodiscard]] int n_variables() const { return n_variables_; }
+
+        //! Optimal points of the instances: the coordinate i of instance k is at k * n_variables() + i.
+        [[nodiscard]] const std::vector<T> &optima() const { return optima_; }
+
+        //! Optimal values of the instances.
+        [[nodiscard]] const std::vector<double> &optimum_values() const { return optimum_values_; }
+
+        //! The problem of the k-th instance.
+        [[nodiscard]] Problem<T> &problem(const size_t k) { return *problems_.at(k); }
+
+        //! Whether the variables transformations of the instances are stacked.
+        [[nodiscard]] bool stacked() const { return stacked_; }
+
+    private:
+        //! Stack the variables transformations, if they are all affine and of the same form.
+        void stack()
+        {
+            const auto same_form = [](const BBOB::AffineVariables &a, const BBOB::AffineVariables &b) {
+                return (a.offset == nullptr) == (b.offset == nullptr) and (a.matrix == nullptr) == (b.matrix == nullptr);
+            };
+            std::vector<BBOB::AffineVariables> transformations;
+            for (const auto &problem : problems_)
+            {
+                const auto *bbob = dynamic_cast<const BBOB *>(problem.get());
+                const auto transformation = bbob == nullptr ? std::nullopt : bbob->affine_variables();
+                if (not transformation or
+                    (not transformations.empty() and not same_form(*transformation, transformations.front())))
+                    return;
+                transformations.push_back(*transformation);
+            }
+
+            const auto n = static_cast<size_t>(n_variables_), size = problems_.size();
+            offsets_.assign(size * n, 0.0);
+            bases_.assign(size * n, 0.0);
+            differences_.assign(size * n, 0.0);
+            z_.assign(size * n, 0.0);
+            if (transformations.front().matrix != nullptr)
+                columns_.assign(n * size * n, 0.0);
+            for (size_t k = 0; k < size; ++k)
+            {
+                const auto &t = transformations[k];
+                if (t.offset != nullptr)
+                    std::copy(t.offset->begin(), t.offset->end(), offsets_.begin() + k * n);
+                if (t.matrix == nullptr)
+                    continue;
+                std::copy(t.base->begin(), t.base->end(), bases_.begin() + k * n);
+                for (size_t i = 0; i < n; ++i)
+                    for (size_t j = 0; j < n; ++j)
+                        columns_[(j * size + k) * n + i] = (*t.matrix)[i][j];
+            }
+            stacked_ = true;
+        }
+
+        /** Transform a point for all the instances into z_, as subtract and affine do for each one:
+         * z = base + (x_0 - offset_0) m_0 + (x_1 - offset_1) m_1 + ..., in this order.
+         */
+        void transform_stacked(const std::vector<double> &x)
+        {
+            const auto n = static_cast<size_t>(n_variables_), size = problems_.size();
+            auto &d = columns_.empty() ? z_ : differences_;
+            for (size_t k = 0; k < size; ++k)
+                for (size_t i = 0; i < n; ++i)
+                    d[k * n + i] = x[i] - offsets_[k * n + i];
+            if (columns_.empty())
+                return;
+            std::copy(bases_.begin(), bases_.end(), z_.begin());
+            common::kernels::accumulate_columns(columns_.data(), differences_.data(), z_.data(), n, size);
+        }
+
+        static std::vector<std::shared_ptr<Problem<T>>> create(const std::string &problem_name,
+                                                               const std::vector<int> &instances,
+                                                               const int n_variables)
+        {
+            const auto &factory = ProblemRegistry<Problem<T>>::instance();
+            const auto names = factory.names();
+            if (std::find(names.begin(), names.end(), problem_name) == names.end())
+                throw std::invalid_argument("Unknown problem: " + problem_name);
+            std::vector<std::shared_ptr<Problem<T>>> problems;
+            for (const auto instance : instances)
+                problems.push_back(factory.create(problem_name, instance, n_variables));
+            return problems;
+        }
+    };
+} // namespace ioh::problem
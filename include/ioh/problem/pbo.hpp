@@ -1,8 +1,10 @@
 #pragma once
 
 #include "pbo/pbo_problem.hpp"
+#include "pbo/graph.hpp"
 #include "pbo/concatenated_trap.hpp"
 #include "pbo/ising_ring.hpp"
+#include "pbo/ising_spin_glass.hpp"
 #include "pbo/ising_torus.hpp"
 #include "pbo/ising_triangular.hpp"
 #include "pbo/labs.hpp"
@@ -15,6 +17,8 @@
 #include "pbo/leading_ones_ruggedness2.hpp"
 #include "pbo/leading_ones_ruggedness3.hpp"
 #include "pbo/linear.hpp"
+#include "pbo/max_cut.hpp"
+#include "pbo/max_independent_set.hpp"
 #include "pbo/mis.hpp"
 #include "pbo/nk_landscapes.hpp"
 #include "pbo/n_queens.hpp"
@@ -26,3 +30,4 @@
 #include "pbo/one_max_ruggedness1.hpp"
 #include "pbo/one_max_ruggedness2.hpp"
 #include "pbo/one_max_ruggedness3.hpp"
+#include "pbo/vertex_cover.hpp"
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <charconv>
+#include <cstring>
+#include <numeric>
+#include <sstream>
+
+#include "ioh/common/file.hpp"
+#include "pbo_problem.hpp"
+
+namespace ioh
+{
+    namespace problem
+    {
+        namespace pbo
+        {
+            /**
+             * \brief An undirected weighted graph, for the graph-based PBO problems.
+             *
+             * The graph is kept twice: as an edge list, with each edge once, which the evaluations traverse in
+             * O(|E|) with a branch-free loop, and in compressed sparse row (CSR) form, with the neighbors of
+             * each vertex contiguous, which the single-flip evaluations traverse in O(degree). Self-loops are
+             * dropped, and the weights of the parallel edges are summed.
+             */
+            class Graph
+            {
+                size_t n_vertices_;
+
+                //! Edges, with sources_[e] < targets_[e], sorted
+                std::vector<uint32_t> sources_, targets_;
+                std::vector<double> weights_;
+
+                //! The neighbors of v are at offsets_[v] to offsets_[v + 1] in neighbors_ and neighbor_weights_
+                std::vector<size_t> offsets_;
+                std::vector<uint32_t> neighbors_;
+                std::vector<double> neighbor_weights_;
+
+                //! Parse a number of a line of an edge list
+                template <typename T>
+                static const char *parse(const char *first, const char *last, T &value)
+                {
+                    while (first != last and (*first == ' ' or *first == '\t' or *first == ','))
+                        ++first;
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+                    const auto [end, err] = std::from_chars(first, last, value);
+                    if (err != std::errc() or end == first)
+                        throw std::runtime_error("Invalid edge list: " + std::string(first, last));
+                    return end;
+#else
+                    const std::string token(first, std::find_if(first, last, [](const char c) {
+                                                return c == ' ' or c == '\t' or c == ',';
+                                            }));
+                    std::istringstream stream(token);
+                    if (not(stream >> value))
+                        throw std::runtime_error("Invalid edge list: " + std::string(first, last));
+                    return first + token.size();
+#endif
+                }
+
+            public:
+                //! An edge
+                struct Edge
+                {
+                    uint32_t source;
+                    uint32_t target;
+                    double weight = 1.0;
+                };
+
+                /**
+                 * \brief Construct a graph from its edges
+                 *
+                 * \param n_vertices The number of vertices, numbered from 0
+                 * \param edges The edges, in any order and direction
+                 */
+                Graph(const size_t n_vertices, std::vector<Edge> edges) : n_vertices_(n_vertices)
+                {
+                    if (n_vertices > std::numeric_limits<uint32_t>::max())
+                        throw std::invalid_argument("Too many vertices.");
+                    for (auto &e : edges)
+                    {
+                        if (e.source >= n_vertices or e.target >= n_vertices)
+                            throw std::invalid_argument("The edge (" + std::to_string(e.source) + ", " +
+                                                        std::to_string(e.target) + ") has an unknown vertex.");
+                        if (e.source > e.target)
+                            std::swap(e.source, e.target);
+                    }
+                    std::sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b) {
+                        return a.source < b.source or (a.source == b.source and a.target < b.target);
+                    });
+
+                    offsets_.assign(n_vertices + 1, 0);
+                    for (const auto &e : edges)
+                    {
+                        if (e.source == e.target)
+                            continue;
+                        if (not sources_.empty() and sources_.back() == e.source and targets_.back() == e.target)
+                        {
+                            weights_.back() += e.weight;
+                            continue;
+                        }
+                        sources_.push_back(e.source);
+                        targets_.push_back(e.target);
+                        weights_.push_back(e.weight);
+                        ++offsets_[e.source + 1];
+                        ++offsets_[e.target + 1];
+                    }
+                    std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+
+                    neighbors_.resize(2 * sources_.size());
+                    neighbor_weights_.resize(2 * sources_.size());
+                    auto next = offsets_;
+                    for (size_t e = 0; e < sources_.size(); ++e)
+                    {
+                        neighbors_[next[sources_[e]]] = targets_[e];
+                        neighbor_weights_[next[sources_[e]]++] = weights_[e];
+                        neighbors_[next[targets_[e]]] = sources_[e];
+                        neighbor_weights_[next[targets_[e]]++] = weights_[e];
+                    }
+                }
+
+                /**
+                 * \brief Load a graph from an edge list, e.g. of the SNAP or Network Repository collections
+                 *
+                 * Each line holds an edge, as two vertices numbered from 0 and an optional weight (1 by default),
+                 * separated by spaces, tabs or commas. Empty lines, and lines starting with # or % are skipped.
+                 *
+                 * \param path The path of the file
+                 * \param n_vertices The number of vertices, 0 for the largest vertex in the file plus one
+                 */
+                static Graph from_file(const fs::path &path, size_t n_vertices = 0)
+                {
+                    const common::file::MappedFile file(path);
+                    std::vector<Edge> edges;
+                    size_t largest = 0;
+                    for (const char *line = file.data(), *end = file.data() + file.size(); line < end;)
+                    {
+                        auto *eol = static_cast<const char *>(std::memchr(line, '\n', static_cast<size_t>(end - line)));
+                        if (eol == nullptr)
+                            eol = end;
+                        auto *last = eol;
+                        while (last != line and (last[-1] == '\r' or last[-1] == ' ' or last[-1] == '\t'))
+                            --last;
+                        auto *first = line;
+                        while (first != last and (*first == ' ' or *first == '\t'))
+                            ++first;
+                        line = eol + 1;
+                        if (first == last or *first == '#' or *first == '%')
+                            continue;
+                        Edge edge{};
+                        first = parse(parse(first, last, edge.source), last, edge.target);
+                        if (first != last)
+                            parse(first, last, edge.weight);
+                        largest = std::max<size_t>(largest, std::max(edge.source, edge.target));
+                        edges.push_back(edge);
+                    }
+                    return {n_vertices != 0 ? n_vertices : (edges.empty() ? 0 : largest + 1), std::move(edges)};
+                }
+
+                /**
+                 * \brief Generate a random graph, in which each vertex is linked to degree / 2 random other vertices,
+                 * giving an average degree of about degree
+                 *
+                 * \param n_vertices The number of vertices
+                 * \param degree The average degree
+                 * \param seed The seed of the graph
+                 * \param random_signs Whether the weights are -1 or 1 at random, as in spin glasses, else 1
+                 */
+                static Graph random(const size_t n_vertices, const size_t degree, const int seed,
+                                    const bool random_signs = false)
+                {
+                    std::vector<Edge> edges;
+                    if (n_vertices < 2)
+                        return {n_vertices, edges};
+                    const auto per_vertex = std::max<size_t>(1, degree / 2);
+                    const auto rx = common::random::pbo::uniform(2 * n_vertices * per_vertex, seed);
+                    edges.reserve(n_vertices * per_vertex);
+                    for (size_t v = 0, r = 0; v < n_vertices; ++v)
+                        for (size_t k = 0; k < per_vertex; ++k, r += 2)
+                        {
+                            const auto offset = 1 + static_cast<size_t>(rx[r] * static_cast<double>(n_vertices - 1));
+                            const auto sign = random_signs and rx[r + 1] < 0.5 ? -1.0 : 1.0;
+                            edges.push_back({static_cast<uint32_t>(v),
+                                             static_cast<uint32_t>((v + std::min(offset, n_vertices - 1)) % n_vertices),
+                                             sign});
+                        }
+                    return {n_vertices, std::move(edges)};
+                }
+
+                //! Number of vertices
+                [[nodiscard]] size_t size() const { return n_vertices_; }
+
+                //! Number of edges
+                [[nodiscard]] size_t n_edges() const { return sources_.size(); }
+
+                //! Degree of a vertex
+                [[nodiscard]] size_t degree(const size_t v) const { return offsets_[v + 1] - offsets_[v]; }
+
+                //! Smaller vertices of the edges
+                [[nodiscard]] const std::vector<uint32_t> &sources() const { return sources_; }
+
+                //! Larger vertices of the edges
+                [[nodiscard]] const std::vector<uint32_t> &targets() const { return targets_; }
+
+                //! Weights of the edges
+                [[nodiscard]] const std::vector<double> &weights() const { return weights_; }
+
+                //! Start of the neighbors of each vertex in neighbors(), and their number in the last element
+                [[nodiscard]] const std::vector<size_t> &offsets() const { return offsets_; }
+
+                //! Neighbors of the vertices, contiguous per vertex
+                [[nodiscard]] const std::vector<uint32_t> &neighbors() const { return neighbors_; }
+
+                //! Weights of the edges to the neighbors
+                [[nodiscard]] const std::vector<double> &neighbor_weights() const { return neighbor_weights_; }
+            };
+
+            /**
+             * \brief CRTP class of the problems defined on a graph, with one variable per vertex
+             *
+             * The graph is shared between copies. Without graph, the problems generate one with
+             * Graph::random, of average degree 4, seeded by the problem id and the number of variables, so
+             * that all the instances of a dimension share their graph, as the instances of the other PBO
+             * problems share their function.
+             *
+             * \tparam ProblemType The graph problem
+             */
+            template <typename ProblemType>
+            class GraphProblem : public PBOProblem<ProblemType>
+            {
+            protected:
+                //! The graph
+                std::shared_ptr<const Graph> graph_;
+
+            public:
+                /**
+                 * \brief Construct a problem on a graph
+                 *
+                 * \param problem_id The id of the problem
+                 * \param instance The instance of the problem
+                 * \param graph The graph
+                 * \param name The name of the problem
+                 */
+                GraphProblem(const int problem_id, const int instance, std::shared_ptr<const Graph> graph,
+                             const std::string &name) :
+                    PBOProblem<ProblemType>(problem_id, instance, static_cast<int>(graph->size()), name),
+                    graph_(std::move(graph))
+                {
+                }
+
+                /**
+                 * \brief Construct a problem on a random graph
+                 *
+                 * \param problem_id The id of the problem
+                 * \param instance The instance of the problem
+                 * \param n_variables The number of vertices
+                 * \param name The name of the problem
+                 * \param random_signs Whether the weights are -1 or 1 at random, else 1
+                 */
+                GraphProblem(const int problem_id, const int instance, const int n_variables, const std::string &name,
+                             const bool random_signs = false) :
+                    GraphProblem(problem_id, instance,
+                                 std::make_shared<const Graph>(Graph::random(static_cast<size_t>(n_variables), 4,
+                                                                             problem_id * 10007 + n_variables,
+                                                                             random_signs)),
+                                 name)
+                {
+                }
+
+                //! The graph
+                [[nodiscard]] const Graph &graph() const { return *graph_; }
+            };
+        } // namespace pbo
+    } // namespace problem
+} // namespace ioh
@@ -25,6 +25,17 @@ namespace ioh
                     return result;
                 }
 
+                //! Single-flip evaluation in O(1): only the terms of the edges to i - 1 and i + 1 change
+                double evaluate_flip(const std::vector<int> &x, const double y, const int i) override
+                {
+                    auto result = y;
+                    for (const auto j : {modulo_ising_ring(i - 1, meta_data_.n_variables),
+                                         modulo_ising_ring(i + 1, meta_data_.n_variables)})
+                        if (j != i)
+                            result += x[i] == x[j] ? -1.0 : 1.0;
+                    return result;
+                }
+
             public:
                 /**
                  * \brief Construct a new Ising_Ring object. Definition refers to
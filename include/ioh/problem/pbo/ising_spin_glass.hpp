@@ -0,0 +1,65 @@
+#pragma once
+
+#include "graph.hpp"
+
+namespace ioh
+{
+    namespace problem
+    {
+        namespace pbo
+        {
+            //! IsingSpinGlass problem id 26
+            class IsingSpinGlass final : public GraphProblem<IsingSpinGlass>
+            {
+            protected:
+                //! Evaluation method, in O(|E|)
+                double evaluate(const std::vector<int> &x) override
+                {
+                    const auto &sources = graph_->sources();
+                    const auto &targets = graph_->targets();
+                    const auto &weights = graph_->weights();
+                    auto result = 0.0;
+                    for (size_t e = 0; e < sources.size(); ++e)
+                        result += weights[e] * (1 - 2 * (x[sources[e]] ^ x[targets[e]]));
+                    return result;
+                }
+
+                //! Single-flip evaluation, in O(degree)
+                double evaluate_flip(const std::vector<int> &x, const double y, const int i) override
+                {
+                    const auto &neighbors = graph_->neighbors();
+                    const auto &weights = graph_->neighbor_weights();
+                    auto delta = 0.0;
+                    for (auto k = graph_->offsets()[i]; k < graph_->offsets()[i + 1]; ++k)
+                        delta += weights[k] * (1 - 2 * (x[i] ^ x[neighbors[k]]));
+                    return y - 2 * delta;
+                }
+
+            public:
+                /**
+                 * \brief Construct a new IsingSpinGlass object, an Ising spin glass maximizing sum_(u,v) w_uv s_u s_v, with spins s = 2 x - 1 and the weights of the edges (-1 or 1 at random on the generated graphs)
+                 *
+                 * \param instance The instance number of a problem, which controls the transformation
+                 * performed on the original problem.
+                 * \param n_variables The number of vertices of the random graph, see GraphProblem.
+                 **/
+                IsingSpinGlass(const int instance, const int n_variables) :
+                    GraphProblem(26, instance, n_variables, "IsingSpinGlass", true)
+                {
+                }
+
+                /**
+                 * \brief Construct a new IsingSpinGlass object on a given graph, e.g. loaded with Graph::from_file
+                 *
+                 * \param instance The instance number of a problem, which controls the transformation
+                 * performed on the original problem.
+                 * \param graph The graph, whose vertices are the variables.
+                 **/
+                IsingSpinGlass(const int instance, std::shared_ptr<const Graph> graph) :
+                    GraphProblem(26, instance, std::move(graph), "IsingSpinGlass")
+                {
+                }
+            };
+        } // namespace pbo
+    } // namespace problem
+} // namespace ioh
@@ -44,6 +44,25 @@ namespace ioh
                     return result;
                 }
 
+                //! Single-flip evaluation in O(1): only the terms of the edges to the 4 neighbors change
+                double evaluate_flip(const std::vector<int> &x, const double y, const int k) override
+                {
+                    auto result = y;
+                    const auto lattice_size = static_cast<size_t>(sqrt(static_cast<double>(meta_data_.n_variables)));
+                    if (static_cast<size_t>(k) >= lattice_size * lattice_size)
+                        return result;
+                    const auto i = static_cast<size_t>(k) / lattice_size, j = static_cast<size_t>(k) % lattice_size;
+                    const size_t neighbors[] = {
+                        modulo_ising_torus(i + 1, lattice_size) * lattice_size + j,
+                        modulo_ising_torus(i + lattice_size - 1, lattice_size) * lattice_size + j,
+                        i * lattice_size + modulo_ising_torus(j + 1, lattice_size),
+                        i * lattice_size + modulo_ising_torus(j + lattice_size - 1, lattice_size)};
+                    for (const auto neighbor : neighbors)
+                        if (neighbor != static_cast<size_t>(k))
+                            result += x[k] == x[neighbor] ? -1.0 : 1.0;
+                    return result;
+                }
+
             public:
                 /**
                  * \brief Construct a new Ising_Torus object. Definition refers to
@@ -39,6 +39,27 @@ namespace ioh
                     return static_cast<double>(result);
                 }
 
+                //! Single-flip evaluation in O(1): only the terms of the edges to the 6 neighbors change
+                double evaluate_flip(const std::vector<int> &x, const double y, const int k) override
+                {
+                    auto result = y;
+                    const auto lattice_size = static_cast<size_t>(sqrt(static_cast<double>(meta_data_.n_variables)));
+                    if (static_cast<size_t>(k) >= lattice_size * lattice_size)
+                        return result;
+                    const auto i = static_cast<size_t>(k) / lattice_size, j = static_cast<size_t>(k) % lattice_size;
+                    const auto next_i = modulo_ising_triangular(i + 1, lattice_size),
+                               previous_i = modulo_ising_triangular(i + lattice_size - 1, lattice_size),
+                               next_j = modulo_ising_triangular(j + 1, lattice_size),
+                               previous_j = modulo_ising_triangular(j + lattice_size - 1, lattice_size);
+                    const size_t neighbors[] = {next_i * lattice_size + j,         previous_i * lattice_size + j,
+                                                i * lattice_size + next_j,         i * lattice_size + previous_j,
+                                                next_i * lattice_size + next_j, previous_i * lattice_size + previous_j};
+                    for (const auto neighbor : neighbors)
+                        if (neighbor != static_cast<size_t>(k))
+                            result += x[k] == x[neighbor] ? -1.0 : 1.0;
+                    return result;
+                }
+
             public:
                 /**
                  * \brief Construct a new Ising_Triangular object. Definition refers to
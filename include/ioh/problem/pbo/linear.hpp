@@ -22,6 +22,12 @@ namespace ioh
                     return result;
                 }
 
+                //! Single-flip evaluation in O(1)
+                double evaluate_flip(const std::vector<int> &x, const double y, const int i) override
+                {
+                    return y + (1.0 - 2.0 * x[i]) * (static_cast<double>(i) + 1.0);
+                }
+
             public:
                 /**
                  * \brief Construct a new Linear object. Definition refers to https://doi.org/10.1016/j.asoc.2019.106027
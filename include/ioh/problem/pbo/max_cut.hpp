@@ -0,0 +1,65 @@
+#pragma once
+
+#include "graph.hpp"
+
+namespace ioh
+{
+    namespace problem
+    {
+        namespace pbo
+        {
+            //! MaxCut problem id 27
+            class MaxCut final : public GraphProblem<MaxCut>
+            {
+            protected:
+                //! Evaluation method, in O(|E|)
+                double evaluate(const std::vector<int> &x) override
+                {
+                    const auto &sources = graph_->sources();
+                    const auto &targets = graph_->targets();
+                    const auto &weights = graph_->weights();
+                    auto result = 0.0;
+                    for (size_t e = 0; e < sources.size(); ++e)
+                        result += weights[e] * (x[sources[e]] ^ x[targets[e]]);
+                    return result;
+                }
+
+                //! Single-flip evaluation, in O(degree)
+                double evaluate_flip(const std::vector<int> &x, const double y, const int i) override
+                {
+                    const auto &neighbors = graph_->neighbors();
+                    const auto &weights = graph_->neighbor_weights();
+                    auto delta = 0.0;
+                    for (auto k = graph_->offsets()[i]; k < graph_->offsets()[i + 1]; ++k)
+                        delta += weights[k] * (1 - 2 * (x[i] ^ x[neighbors[k]]));
+                    return y + delta;
+                }
+
+            public:
+                /**
+                 * \brief Construct a new MaxCut object, maximizing the weight of the edges between the vertices with x_v = 0 and those with x_v = 1
+                 *
+                 * \param instance The instance number of a problem, which controls the transformation
+                 * performed on the original problem.
+                 * \param n_variables The number of vertices of the random graph, see GraphProblem.
+                 **/
+                MaxCut(const int instance, const int n_variables) :
+                    GraphProblem(27, instance, n_variables, "MaxCut")
+                {
+                }
+
+                /**
+                 * \brief Construct a new MaxCut object on a given graph, e.g. loaded with Graph::from_file
+                 *
+                 * \param instance The instance number of a problem, which controls the transformation
+                 * performed on the original problem.
+                 * \param graph The graph, whose vertices are the variables.
+                 **/
+                MaxCut(const int instance, std::shared_ptr<const Graph> graph) :
+                    GraphProblem(27, instance, std::move(graph), "MaxCut")
+                {
+                }
+            };
+        } // namespace pbo
+    } // namespace problem
+} // namespace ioh
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "graph.hpp"
+
+namespace ioh
+{
+    namespace problem
+    {
+        namespace pbo
+        {
+            //! MaxIndependentSet problem id 28
+            class MaxIndependentSet final : public GraphProblem<MaxIndependentSet>
+            {
+            protected:
+                //! Evaluation method, in O(|E|)
+                double evaluate(const std::vector<int> &x) override
+                {
+                    const auto &sources = graph_->sources();
+                    const auto &targets = graph_->targets();
+                    auto edges = 0;
+                    for (size_t e = 0; e < sources.size(); ++e)
+                        edges += x[sources[e]] & x[targets[e]];
+                    return std::accumulate(x.begin(), x.end(), 0.0) - static_cast<double>(meta_data_.n_variables) * edges;
+                }
+
+                //! Single-flip evaluation, in O(degree)
+                double evaluate_flip(const std::vector<int> &x, const double y, const int i) override
+                {
+                    const auto &neighbors = graph_->neighbors();
+                    auto in_set = 0;
+                    for (auto k = graph_->offsets()[i]; k < graph_->offsets()[i + 1]; ++k)
+                        in_set += x[neighbors[k]];
+                    return y + (1.0 - 2 * x[i]) * (1.0 - static_cast<double>(meta_data_.n_variables) * in_set);
+                }
+
+            public:
+                /**
+                 * \brief Construct a new MaxIndependentSet object, maximizing the size of the set of the vertices with x_v = 1, minus n per edge inside the set (the weights are ignored)
+                 *
+                 * \param instance The instance number of a problem, which controls the transformation
+                 * performed on the original problem.
+                 * \param n_variables The number of vertices of the random graph, see GraphProblem.
+                 **/
+                MaxIndependentSet(const int instance, const int n_variables) :
+                    GraphProblem(28, instance, n_variables, "MaxIndependentSet")
+                {
+                }
+
+                /**
+                 * \brief Construct a new MaxIndependentSet object on a given graph, e.g. loaded with Graph::from_file
+                 *
+                 * \param instance The instance number of a problem, which controls the transformation
+                 * performed on the original problem.
+                 * \param graph The graph, whose vertices are the variables.
+                 **/
+                MaxIndependentSet(const int instance, std::shared_ptr<const Graph> graph) :
+                    GraphProblem(28, instance, std::move(graph), "MaxIndependentSet")
+                {
+                }
+            };
+        } // namespace pbo
+    } // namespace problem
+} // namespace ioh
@@ -18,6 +18,12 @@ namespace ioh
                     return std::accumulate(x.begin(), x.end(), 0.0);
                 }
 
+                //! Single-flip evaluation in O(1)
+                double evaluate_flip(const std::vector<int> &x, const double y, const int i) override
+                {
+                    return y + 1.0 - 2.0 * x[i];
+                }
+
             public:
                 /**
                  * \brief Construct a new OneMax object. Definition refers to https://doi.org/10.1016/j.asoc.2019.106027
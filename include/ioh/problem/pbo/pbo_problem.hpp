@@ -8,6 +8,9 @@ namespace ioh::problem
     //! PBO base class
     class PBO : public Integer
     {
+        //! Factor and offset of the objectives transformation, drawn once for the instance
+        double objective_scale_, objective_shift_;
+
     protected:
         //! Variables transformation method
         std::vector<int> transform_variables(std::vector<int> x) override
@@ -23,7 +26,7 @@ namespace ioh::problem
         {
             using namespace transformation::objective;
             if (meta_data_.instance > 1)
-                return uniform(shift, uniform(scale, y, meta_data_.instance, 0.2, 5.0), meta_data_.instance, -1e3, 1e3);
+                return shift(scale(y, objective_scale_), objective_shift_);
             return y;
         }
 
@@ -37,6 +40,28 @@ namespace ioh::problem
             return x;
         }
 
+        /**
+         * @brief Single-flip evaluation, which problems may override with a delta evaluation, by default a full
+         * evaluation of a copy of x
+         *
+         * @param x A solution, after the transformation of the variables
+         * @param y Its objective value, before the transformation of the objectives
+         * @param i The variable to flip
+         * @return The objective value of x with the variable i flipped, before the transformation of the objectives
+         */
+        [[nodiscard]] virtual double evaluate_flip(const std::vector<int> &x, const double y, const int i)
+        {
+            (void)y;
+            thread_local std::vector<int> flipped;
+            flipped.assign(x.begin(), x.end());
+            flipped[i] = 1 - flipped[i];
+            return evaluate(flipped);
+        }
+
+        //! Enumerates all the solutions of small problems.
+        template <typename>
+        friend class landscape::Enumeration;
+
     public:
         /**
          * @brief Construct a new PBO object
@@ -48,7 +73,9 @@ namespace ioh::problem
          */
         PBO(const int problem_id, const int instance, const int n_variables, const std::string &name) :
             Integer(MetaData(problem_id, instance, name, n_variables,
-                             common::OptimizationType::Maximization),Constraint<int>(n_variables, 0, 1))
+                             common::OptimizationType::Maximization),Constraint<int>(n_variables, 0, 1)),
+            objective_scale_(common::random::pbo::uniform(1, instance, 0.2, 5.0).at(0)),
+            objective_shift_(common::random::pbo::uniform(1, instance, -1e3, 1e3).at(0))
         {
         }
     };
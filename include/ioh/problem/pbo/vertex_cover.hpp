@@ -0,0 +1,63 @@
+#pragma once
+
+#include "graph.hpp"
+
+namespace ioh
+{
+    namespace problem
+    {
+        namespace pbo
+        {
+            //! VertexCover problem id 29
+            class VertexCover final : public GraphProblem<VertexCover>
+            {
+            protected:
+                //! Evaluation method, in O(|E|)
+                double evaluate(const std::vector<int> &x) override
+                {
+                    const auto &sources = graph_->sources();
+                    const auto &targets = graph_->targets();
+                    auto uncovered = 0;
+                    for (size_t e = 0; e < sources.size(); ++e)
+                        uncovered += 1 ^ (x[sources[e]] | x[targets[e]]);
+                    return -std::accumulate(x.begin(), x.end(), 0.0) - static_cast<double>(meta_data_.n_variables) * uncovered;
+                }
+
+                //! Single-flip evaluation, in O(degree)
+                double evaluate_flip(const std::vector<int> &x, const double y, const int i) override
+                {
+                    const auto &neighbors = graph_->neighbors();
+                    auto uncovered = 0;
+                    for (auto k = graph_->offsets()[i]; k < graph_->offsets()[i + 1]; ++k)
+                        uncovered += 1 - x[neighbors[k]];
+                    return y - (1.0 - 2 * x[i]) * (1.0 - static_cast<double>(meta_data_.n_variables) * uncovered);
+                }
+
+            public:
+                /**
+                 * \brief Construct a new VertexCover object, maximizing minus the size of the set of the vertices with x_v = 1, minus n per edge without vertex in the set (the weights are ignored)
+                 *
+                 * \param instance The instance number of a problem, which controls the transformation
+                 * performed on the original problem.
+                 * \param n_variables The number of vertices of the random graph, see GraphProblem.
+                 **/
+                VertexCover(const int instance, const int n_variables) :
+                    GraphProblem(29, instance, n_variables, "VertexCover")
+                {
+                }
+
+                /**
+                 * \brief Construct a new VertexCover object on a given graph, e.g. loaded with Graph::from_file
+                 *
+                 * \param instance The instance number of a problem, which controls the transformation
+                 * performed on the original problem.
+                 * \param graph The graph, whose vertices are the variables.
+                 **/
+                VertexCover(const int instance, std::shared_ptr<const Graph> graph) :
+                    GraphProblem(29, instance, std::move(graph), "VertexCover")
+                {
+                }
+            };
+        } // namespace pbo
+    } // namespace problem
+} // namespace ioh
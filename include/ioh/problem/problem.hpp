@@ -8,6 +8,12 @@
 
 namespace ioh
 {
+    namespace landscape
+    {
+        template <typename>
+        class Enumeration;
+    }
+
     //! Problem namespace
     namespace problem
     {
@@ -35,9 +41,15 @@ namespace ioh
             //! A pointer to the attached logger
             Logger *logger_{};
 
+            //! Hands over the last evaluation of each run to the logger
+            logger::Handoff handoff_;
+
             //! The current log info
             logger::Info log_info_;
 
+            //! Whether transform_variables is the identity, which operator() then skips
+            bool identity_variables_ = false;
+
             /**
              * @brief Method for checking the input given to the problem has the correct dimension
              *
@@ -114,6 +126,30 @@ namespace ioh
             //! Objectives transformation function
             [[nodiscard]] virtual double transform_objectives(const double y) { return y; }
 
+            //! Update the state with `state_.current`, and log it if a trigger fires.
+            void update_state_and_log()
+            {
+                const bool improved = state_.update(meta_data_, objective_);
+                // Skip the whole logging path if no trigger can fire at this evaluation.
+                if (logger_ != nullptr and logger_->is_due(static_cast<size_t>(state_.evaluations), improved))
+                {
+                    update_log_info();
+                    logger_->log(log_info());
+                }
+            }
+
+            //! Evaluates the problem from many threads at once.
+            template <typename>
+            friend class Concurrent;
+
+            //! Evaluates points on many instances at once.
+            template <typename>
+            friend class Instances;
+
+            //! Enumerates all the solutions of small problems.
+            template <typename>
+            friend class landscape::Enumeration;
+
         public:
             /**
              * @brief Construct a new Problem object
@@ -131,7 +167,7 @@ namespace ioh
                 constraint_.check_size(meta_data_.n_variables);
 
                 log_info_.optimum = objective_.as_double();
-                log_info_.current = state_.current.as_double();
+                log_info_.current = {state_.current.x, state_.current.y};
             }
 
             /**
@@ -145,18 +181,21 @@ namespace ioh
             {
             }
 
-            //! destructor
-            virtual ~Problem() = default;
+            //! destructor, the logger may still have to write the last evaluation
+            virtual ~Problem() { handoff_.release(); }
 
             //! Reset method, resets problem state and logger if attached
             virtual void reset()
             {
-                state_.reset();
+                // Loggers may skip evaluations, they read the last one of the run before it is lost.
                 if (logger_ != nullptr)
                 {
+                    update_log_info();
                     logger_->reset();
-                    logger_->attach_problem(meta_data_);
                 }
+                state_.reset();
+                if (logger_ != nullptr)
+                    logger_->attach_problem(meta_data_);
             }
 
             //! Update the current log info
@@ -166,17 +205,28 @@ namespace ioh
                 log_info_.raw_y_best = state_.current_best_internal.y;
                 log_info_.transformed_y = state_.current.y;
                 log_info_.transformed_y_best = state_.current_best.y;
-                log_info_.current = state_.current.as_double();
+                // The loggers which store the variables convert them, the problem only points to them.
+                log_info_.current.x = state_.current.x;
+                log_info_.current.y = state_.current.y;
             }
 
             //! Accessor for current log info
-            [[nodiscard]] logger::Info &log_info() { return log_info_; }
+            [[nodiscard]] logger::Info &log_info()
+            {
+                // A copied problem still views the variables of the original one until it logs.
+                log_info_.current.x = state_.current.x;
+                return log_info_;
+            }
 
             //! Attach a logger
             void attach_logger(Logger &logger)
             {
                 logger_ = &logger;
                 logger_->attach_problem(meta_data_);
+                logger_->hand_over(handoff_.open([this](logger::StoredInfo &info) {
+                    update_log_info();
+                    info = log_info();
+                }));
             }
 
             //! Dettach a logger
@@ -184,6 +234,7 @@ namespace ioh
             {
                 if (logger_ != nullptr)
                     logger_->reset();
+                handoff_.close();
                 logger_ = nullptr;
             }
 
@@ -194,15 +245,13 @@ namespace ioh
                     return std::numeric_limits<double>::signaling_NaN();
 
                 state_.current.x = x;
-                state_.current_internal.x = transform_variables(x);
+                if (identity_variables_)
+                    state_.current_internal.x = x;
+                else
+                    state_.current_internal.x = transform_variables(x);
                 state_.current_internal.y = evaluate(state_.current_internal.x);
                 state_.current.y = transform_objectives(state_.current_internal.y);
-                state_.update(meta_data_, objective_);
-                if (logger_ != nullptr)
-                {
-                    update_log_info();
-                    logger_->log(log_info());
-                }
+                update_state_and_log();
                 return state_.current.y;
             }
 
@@ -296,22 +345,42 @@ namespace ioh
         using ProblemRegistry = ProblemRegistryType<Parent>;
 
         /**
-         * @brief
+         * @brief A problem wrapping functions.
+         *
+         * By default, the functions are type-erased in std::function objects. With the types of the callables
+         * as template arguments, e.g. through the overload of \ref wrap_function taking callables, they are
+         * stored and called directly, and can be inlined; a transformation given as utils::Identity is not called
+         * at all, and the variables are then evaluated without being copied to a transformed vector.
          *
-         * @tparam T
+         * @tparam T type of the problem
+         * @tparam F type of the objective function
+         * @tparam VariablesTransformation type of the variables transformation function, or utils::Identity
+         * @tparam ObjectiveTransformation type of the objective transformation function, or utils::Identity
          */
-        template <typename T>
+        template <typename T, typename F = ObjectiveFunction<T>,
+                  typename VariablesTransformation = VariablesTransformationFunction<T>,
+                  typename ObjectiveTransformation = ObjectiveTransformationFunction>
         class WrappedProblem final : public Problem<T>
         {
         protected:
             //! Wrapped objective function
-            ObjectiveFunction<T> function_;
+            F function_;
 
             //! Wrapped variables transformation function
-            VariablesTransformationFunction<T> transform_variables_function_;
+            VariablesTransformation transform_variables_function_;
 
             //! Wrapped objective transformation function
-            ObjectiveTransformationFunction transform_objectives_function_;
+            ObjectiveTransformation transform_objectives_function_;
+
+            //! The identity function for the default arguments of a function type
+            template <typename Function, typename Identity>
+            static Function identity_or(Identity identity)
+            {
+                if constexpr (std::is_constructible_v<Function, Identity>)
+                    return Function(identity);
+                else
+                    return Function{};
+            }
 
         protected:
             //! Pass call to wrapped function
@@ -320,13 +389,19 @@ namespace ioh
             //! Variables transformation function
             std::vector<T> transform_variables(std::vector<T> x) override
             {
-                return transform_variables_function_(x, this->meta_data_.instance);
+                if constexpr (std::is_same_v<VariablesTransformation, utils::Identity>)
+                    return x;
+                else
+                    return transform_variables_function_(x, this->meta_data_.instance);
             }
 
             //! Objectives transformation function
             double transform_objectives(const double y) override
             {
-                return transform_objectives_function_(y, this->meta_data_.instance);
+                if constexpr (std::is_same_v<ObjectiveTransformation, utils::Identity>)
+                    return y;
+                else
+                    return transform_objectives_function_(y, this->meta_data_.instance);
             }
 
         public:
@@ -346,18 +421,21 @@ namespace ioh
              *
              */
             WrappedProblem(
-                ObjectiveFunction<T> f, const std::string &name, const int n_variables, const int problem_id = 0,
+                F f, const std::string &name, const int n_variables, const int problem_id = 0,
                 const int instance_id = 0,
                 const common::OptimizationType optimization_type = common::OptimizationType::Minimization,
                 Constraint<T> constraint = Constraint<T>(),
-                VariablesTransformationFunction<T> transform_variables_function = utils::identity<std::vector<T>, int>,
-                ObjectiveTransformationFunction transform_objectives_function = utils::identity<double, int>,
+                VariablesTransformation transform_variables_function =
+                    identity_or<VariablesTransformation>(utils::identity<std::vector<T>, int>),
+                ObjectiveTransformation transform_objectives_function =
+                    identity_or<ObjectiveTransformation>(utils::identity<double, int>),
                 std::optional<Solution<T>> objective = std::nullopt) :
                 Problem<T>(MetaData(problem_id, instance_id, name, n_variables, optimization_type), constraint,
                            objective.value_or(Solution<T>(n_variables, optimization_type))),
-                function_(f), transform_variables_function_(transform_variables_function),
-                transform_objectives_function_(transform_objectives_function)
+                function_(std::move(f)), transform_variables_function_(std::move(transform_variables_function)),
+                transform_objectives_function_(std::move(transform_objectives_function))
             {
+                this->identity_variables_ = std::is_same_v<VariablesTransformation, utils::Identity>;
             }
         };
 
@@ -407,6 +485,62 @@ namespace ioh
                             });
         }
 
+        /**
+         * @brief Shorthand for wrapping callables in a problem, without type erasure: the problems of the factory
+         * store and call them directly, and skip the transformations left to utils::Identity.
+         *
+         * @tparam T type of the problem
+         * @tparam F type of the objective function, e.g. a lambda, a function object or a function pointer
+         * @tparam VariablesTransformation type of the variables transformation function
+         * @tparam ObjectiveTransformation type of the objective transformation function
+         * @param f a function to be wrapped
+         * @param name the name for the new function in the registry
+         * @param optimization_type the type of optimization
+         * @param lb lower bound for the constraint of the problem
+         * @param ub upper bound for the constraint of the problem
+         * @param transform_variables_function function which transforms the variables of the search problem
+         * prior to calling f, with the instance.
+         * @param transform_objectives_function a function which transforms the objective value of the search
+         * problem after calling f, with the instance.
+         * @param calculate_objective a function which returns the optimum based on a given problem
+         * dimension and instance.
+         */
+        template <typename T, typename F, typename VariablesTransformation = utils::Identity,
+                  typename ObjectiveTransformation = utils::Identity,
+                  typename = std::enable_if_t<
+                      std::is_invocable_r_v<double, F &, const std::vector<T> &> and
+                      not std::is_same_v<F, ObjectiveFunction<T>> and
+                      (std::is_same_v<VariablesTransformation, utils::Identity> or
+                       std::is_invocable_r_v<std::vector<T>, VariablesTransformation &, std::vector<T>, int>) and
+                      (std::is_same_v<ObjectiveTransformation, utils::Identity> or
+                       std::is_invocable_r_v<double, ObjectiveTransformation &, double, int>)>>
+        void wrap_function(F f, const std::string &name,
+                           const common::OptimizationType optimization_type = common::OptimizationType::Minimization,
+                           const std::optional<T> lb = std::nullopt, const std::optional<T> ub = std::nullopt,
+                           VariablesTransformation transform_variables_function = {},
+                           ObjectiveTransformation transform_objectives_function = {},
+                           std::optional<CalculateObjectiveFunction<T>> calculate_objective = std::nullopt)
+        {
+            using Wrapped = WrappedProblem<T, F, VariablesTransformation, ObjectiveTransformation>;
+            auto &factory = ProblemFactoryType<Problem<T>>::instance();
+
+            int id = factory.check_or_get_next_available(1, name);
+
+            auto constraint = Constraint<T>(1, lb.value_or(std::numeric_limits<T>::lowest()),
+                                            ub.value_or(std::numeric_limits<T>::max()));
+
+            factory.include(name, id,
+                            [f, name, id, optimization_type, constraint, transform_variables_function,
+                             transform_objectives_function, calculate_objective](const int iid, const int dim) {
+                                auto objective = calculate_objective ? calculate_objective.value()(iid, dim)
+                                                                     : Solution<T>(dim, optimization_type);
+
+                                return std::make_unique<Wrapped>(f, name, dim, id, iid, optimization_type, constraint,
+                                                                 transform_variables_function,
+                                                                 transform_objectives_function, objective);
+                            });
+        }
+
         //! Type def for Real problems
         using Real = Problem<double>;
 
@@ -239,8 +239,8 @@ namespace ioh
                 optimum_found = false;
             }
 
-            //! Update the state
-            void update(const MetaData &meta_data, const Solution<T> &objective)
+            //! Update the state, returns true if the current best has strictly improved.
+            bool update(const MetaData &meta_data, const Solution<T> &objective)
             {
                 ++evaluations;
                 if (meta_data.optimization_type(current.y, current_best.y))
@@ -250,7 +250,9 @@ namespace ioh
 
                     if (objective.y == current.y)
                         optimum_found = true;
+                    return true;
                 }
+                return false;
             }
 
             std::string repr() const override
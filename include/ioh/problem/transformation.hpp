@@ -180,11 +180,11 @@ namespace ioh::problem::transformation
         /**
          * \brief Affine transformation for x using matrix M and vector B
          * \param x raw variables
-         * \param m transformation matrix
+         * \param m transformation matrix, indexed by m[i][j], such as nested vectors or a bbob::Matrix
          * \param b transformation vector
          */
-        inline void affine(std::vector<double> &x, const std::vector<std::vector<double>> &m,
-                           const std::vector<double> &b)
+        template <typename Matrix>
+        void affine(std::vector<double> &x, const Matrix &m, const std::vector<double> &b)
         {
             auto temp_x = x;
             for (size_t i = 0; i < x.size(); ++i)
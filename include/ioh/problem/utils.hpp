@@ -357,6 +357,17 @@ namespace ioh
             template<typename T, typename... Args>
             T identity(T p, Args &&...) {return p;}
 
+            //! The identity, as a type, which problem::WrappedProblem does not call
+            struct Identity
+            {
+                //! Forwards its first argument
+                template <typename T, typename... Args>
+                T operator()(T p, Args &&...) const
+                {
+                    return p;
+                }
+            };
+
         } // namespace utils
     } // namespace problem
 } // namespace ioh
@@ -18,6 +18,7 @@ try:
         problem,
         suite,
         logger,
+        landscape,
         OptimizationType,
         RealSolution,
         IntegerSolution,
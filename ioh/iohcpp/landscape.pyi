@@ -0,0 +1,91 @@
+from typing import List, overload
+
+import ioh.iohcpp.problem
+
+class Features:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @property
+    def dispersion(self) -> float: ...
+    @property
+    def fdc(self) -> float: ...
+    @property
+    def nb_fitness_correlation(self) -> float: ...
+    @property
+    def nb_nn_correlation(self) -> float: ...
+    @property
+    def nb_nn_mean_ratio(self) -> float: ...
+    @property
+    def nb_nn_std_ratio(self) -> float: ...
+    @property
+    def samples(self) -> int: ...
+    @property
+    def y(self) -> Moments: ...
+
+class IntegerAnalysis:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @property
+    def features(self) -> Features: ...
+    @property
+    def nearest_better(self) -> List[int]: ...
+    @property
+    def nearest_better_distance(self) -> List[float]: ...
+    @property
+    def nearest_distance(self) -> List[float]: ...
+    @property
+    def points(self) -> List[List[int]]: ...
+    @property
+    def y(self) -> List[float]: ...
+
+class LatinHypercube(Sampler):
+    def __init__(self, dimension: int, size: int, seed: int = ...) -> None: ...
+    @property
+    def size(self) -> int: ...
+
+class Moments:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @property
+    def kurtosis(self) -> float: ...
+    @property
+    def max(self) -> float: ...
+    @property
+    def mean(self) -> float: ...
+    @property
+    def min(self) -> float: ...
+    @property
+    def n(self) -> int: ...
+    @property
+    def skewness(self) -> float: ...
+    @property
+    def variance(self) -> float: ...
+
+class RealAnalysis:
+    def __init__(self, *args, **kwargs) -> None: ...
+    @property
+    def features(self) -> Features: ...
+    @property
+    def nearest_better(self) -> List[int]: ...
+    @property
+    def nearest_better_distance(self) -> List[float]: ...
+    @property
+    def nearest_distance(self) -> List[float]: ...
+    @property
+    def points(self) -> List[List[float]]: ...
+    @property
+    def y(self) -> List[float]: ...
+
+class Sampler:
+    def __init__(self, *args, **kwargs) -> None: ...
+    def __call__(self, index: int) -> List[float]: ...
+    @property
+    def dimension(self) -> int: ...
+
+class Sobol(Sampler):
+    def __init__(self, dimension: int, seed: int = ...) -> None: ...
+
+class Uniform(Sampler):
+    def __init__(self, dimension: int, seed: int = ...) -> None: ...
+
+@overload
+def analyze(problem: ioh.iohcpp.problem.Real, sampler: Sampler, n: int, nb_threads: int = ..., subsample: int = ..., best_fraction: float = ..., seed: int = ...) -> RealAnalysis: ...
+@overload
+def analyze(problem: ioh.iohcpp.problem.Integer, sampler: Sampler, n: int, nb_threads: int = ..., subsample: int = ..., best_fraction: float = ..., seed: int = ...) -> IntegerAnalysis: ...
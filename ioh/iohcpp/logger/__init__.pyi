@@ -10,6 +10,7 @@ class AbstractWatcher(Logger):
 class Analyzer(AbstractWatcher):
     def __init__(self, triggers: List[trigger.Trigger] = ..., additional_properties: List[property.AbstractProperty] = ..., root: Path = ..., folder_name: str = ..., algorithm_name: str = ..., algorithm_info: str = ..., store_positions: bool = ...) -> None: ...
     def add_experiment_attribute(self, arg0: str, arg1: str) -> None: ...
+    def compress(self, level: int = ...) -> None: ...
     @overload
     def add_run_attributes(self, arg0: str, arg1: float) -> None: ...
     @overload
@@ -26,8 +27,34 @@ class Analyzer(AbstractWatcher):
     @overload
     def watch(self, arg0: object, arg1: List[str]) -> None: ...
     @property
+    def compression(self) -> int: ...
+    @property
     def output_directory(self) -> Path: ...
 
+class AnalyzerReader:
+    def __init__(self, root: Path) -> None: ...
+    def replay(self, logger: Logger, nb_threads: int = ...) -> None: ...
+    def table(self, index: int) -> AnalyzerTable: ...
+    def tables(self, nb_threads: int = ...) -> List[AnalyzerTable]: ...
+    @property
+    def data_files(self) -> List[Path]: ...
+    @property
+    def experiments(self) -> List[dict]: ...
+    @property
+    def root(self) -> Path: ...
+
+class AnalyzerTable:
+    def column(self, name: str) -> List[float]: ...
+    def __len__(self) -> int: ...
+    @property
+    def columns(self) -> List[List[float]]: ...
+    @property
+    def names(self) -> List[str]: ...
+    @property
+    def nb_runs(self) -> int: ...
+    @property
+    def run_starts(self) -> List[int]: ...
+
 class Combine(Logger):
     @overload
     def __init__(self, loggers: List[Logger]) -> None: ...
@@ -41,6 +68,21 @@ class EAF(Logger):
     @property
     def data(self) -> Dict[str,Dict[int,Dict[int,Dict[int,Dict[int,List[eaf.RunPoint]]]]]]: ...
 
+class Summary(Logger):
+    @overload
+    def __init__(self, targets: List[float], budgets: List[int], filename: str = ..., output_directory: Path = ..., no_value: str = ...) -> None: ...
+    @overload
+    def __init__(self, target_scale: eah.RealScale, budget_scale: eah.IntegerScale, filename: str = ..., output_directory: Path = ..., no_value: str = ...) -> None: ...
+    def close(self) -> None: ...
+    @property
+    def targets(self) -> List[float]: ...
+    @property
+    def budgets(self) -> List[int]: ...
+    @property
+    def filename(self) -> str: ...
+    @property
+    def output_directory(self) -> str: ...
+
 class EAH(Logger):
     @overload
     def __init__(self, error_min: float, error_max: float, error_buckets: int, evals_min: int, evals_max: int, evals_buckets: int) -> None: ...
@@ -62,6 +104,7 @@ class EAH(Logger):
 
 class FlatFile(AbstractWatcher):
     def __init__(self, triggers: List[trigger.Trigger], properties: List[property.AbstractProperty], filename: str = ..., output_directory: Path = ..., separator: str = ..., comment: str = ..., no_value: str = ..., end_of_line: str = ..., repeat_header: bool = ..., store_positions: bool = ..., common_header_titles: List[str] = ...) -> None: ...
+    def compress(self, level: int = ...) -> None: ...
     @overload
     def watch(self, arg0: property.AbstractProperty) -> None: ...
     @overload
@@ -69,10 +112,18 @@ class FlatFile(AbstractWatcher):
     @overload
     def watch(self, arg0: object, arg1: List[str]) -> None: ...
     @property
+    def compression(self) -> int: ...
+    @property
     def filename(self) -> str: ...
     @property
     def output_directory(self) -> str: ...
 
+class Live(Logger):
+    def __init__(self, name: str, nb_slots: int = ..., trajectory_capacity: int = ..., unlink: bool = ...) -> None: ...
+    def close(self) -> None: ...
+    @property
+    def name(self) -> str: ...
+
 class Logger:
     def __init__(self, *args, **kwargs) -> None: ...
     def add_trigger(self, arg0: trigger.Trigger) -> None: ...
@@ -87,10 +138,35 @@ class Logger:
 class Path:
     def __init__(self, arg0: str) -> None: ...
 
+class PositionTrace(Logger):
+    def __init__(self, triggers: List[trigger.Trigger], file: Path, encoding: trace.Encoding = ...) -> None: ...
+    def close(self) -> None: ...
+
+class Recorder(Logger):
+    def __init__(self, file: Path, store_positions: bool = ...) -> None: ...
+    def close(self) -> None: ...
+    def flush(self) -> None: ...
+    @property
+    def store_positions(self) -> bool: ...
+
+class Replayer:
+    def __init__(self, file: Path) -> None: ...
+    def replay(self, logger: Logger) -> None: ...
+    @property
+    def store_positions(self) -> bool: ...
+
 class Store(AbstractWatcher):
-    def __init__(self, arg0: List[trigger.Trigger], arg1: List[property.AbstractProperty]) -> None: ...
+    def __init__(self, triggers: List[trigger.Trigger], properties: List[property.AbstractProperty], memory_budget: int = ..., spill_directory: str = ...) -> None: ...
     def at(self, arg0: str, arg1: int, arg2: int, arg3: int, arg4: int, arg5: int) -> Dict[str,Optional[float]]: ...
     def data(self) -> Dict[str,Dict[int,Dict[int,Dict[int,Dict[int,Dict[int,Dict[str,Optional[float]]]]]]]]: ...
+    @property
+    def memory_budget(self) -> int: ...
+    @property
+    def memory_usage(self) -> int: ...
+    @property
+    def nb_spilled(self) -> int: ...
+    @property
+    def spilled_size(self) -> int: ...
     @overload
     def watch(self, arg0: property.AbstractProperty) -> None: ...
     @overload
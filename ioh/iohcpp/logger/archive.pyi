@@ -0,0 +1,15 @@
+from typing import overload
+import ioh.iohcpp
+
+@overload
+def load(file: Path, logger: EAF) -> None: ...
+@overload
+def load(file: Path, logger: EAH) -> None: ...
+@overload
+def load(file: Path, logger: Store) -> None: ...
+@overload
+def save(file: Path, logger: EAF) -> None: ...
+@overload
+def save(file: Path, logger: EAH) -> None: ...
+@overload
+def save(file: Path, logger: Store) -> None: ...
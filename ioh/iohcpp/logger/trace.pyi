@@ -0,0 +1,23 @@
+from typing import Any, ClassVar, Dict, List
+
+import ioh.iohcpp
+
+Integer: Encoding
+Real: Encoding
+
+class Encoding:
+    __members__: ClassVar[dict] = ...  # read-only
+    Integer: ClassVar[Encoding] = ...
+    Real: ClassVar[Encoding] = ...
+    def __init__(self, value: int) -> None: ...
+    def __eq__(self, other: object) -> bool: ...
+    def __hash__(self) -> int: ...
+    def __int__(self) -> int: ...
+    @property
+    def name(self) -> str: ...
+    @property
+    def value(self) -> int: ...
+
+def decode(data: bytes, n_variables: int, count: int, encoding: Encoding = ...) -> List[List[float]]: ...
+def encode(solutions: List[List[float]], encoding: Encoding = ...) -> bytes: ...
+def read(file: Path) -> List[Dict[str, Any]]: ...
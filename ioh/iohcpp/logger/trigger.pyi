@@ -40,4 +40,5 @@ class OnImprovement(Trigger):
 class Trigger:
     def __init__(self, *args, **kwargs) -> None: ...
     def reset(self) -> None: ...
+    def next(self, arg0: int) -> int: ...
     def __call__(self, arg0: ioh.iohcpp.LogInfo, arg1: ioh.iohcpp.MetaData) -> bool: ...
@@ -1,4 +1,4 @@
-from typing import Any, ClassVar, List, Optional
+from typing import Any, ClassVar, List, Optional, Tuple, Union, overload
 
 import ioh.iohcpp
 
@@ -8,39 +8,78 @@ class AbstractWModel(Integer):
 
 class AttractiveSector(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class BBOB(Real):
     def __init__(self, *args, **kwargs) -> None: ...
 
 class BentCigar(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class BuecheRastrigin(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class ConcatenatedTrap(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class DifferentPowers(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Discus(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Ellipsoid(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class EllipsoidRotated(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Gallagher101(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Gallagher21(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
+
+class Graph:
+    def __init__(self, n_vertices: int, edges: List[Tuple[int, int, float]]) -> None: ...
+    def degree(self, vertex: int) -> int: ...
+    @staticmethod
+    def from_file(path: str, n_vertices: int = ...) -> Graph: ...
+    @staticmethod
+    def random(n_vertices: int, degree: int, seed: int, random_signs: bool = ...) -> Graph: ...
+    def __len__(self) -> int: ...
+    @property
+    def n_edges(self) -> int: ...
+    @property
+    def sources(self) -> List[int]: ...
+    @property
+    def targets(self) -> List[int]: ...
+    @property
+    def weights(self) -> List[float]: ...
 
 class GriewankRosenBrock(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Integer:
     problems: ClassVar[Any] = ...  # read-only
@@ -61,95 +100,199 @@ class Integer:
     @property
     def state(self) -> Any: ...
 
+class IntegerInstances:
+    def __init__(self, problem: Union[int, str], instances: List[int], n_variables: int) -> None: ...
+    @overload
+    def __call__(self, x: List[int]) -> List[float]: ...
+    @overload
+    def __call__(self, xs: List[List[int]]) -> List[List[float]]: ...
+    def __len__(self) -> int: ...
+    @property
+    def instances(self) -> List[int]: ...
+    @property
+    def n_variables(self) -> int: ...
+    @property
+    def optima(self) -> List[List[int]]: ...
+    @property
+    def optimum_values(self) -> List[float]: ...
+    @property
+    def stacked(self) -> bool: ...
+
 class IntegerWrappedProblem(Integer):
     def __init__(self, *args, **kwargs) -> None: ...
 
 class IsingRing(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
+
+class IsingSpinGlass(Integer):
+    @overload
+    def __init__(self, instance: int, n_variables: int) -> None: ...
+    @overload
+    def __init__(self, instance: int, graph: Graph) -> None: ...
+    @property
+    def graph(self) -> Graph: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class IsingTorus(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class IsingTriangular(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Katsuura(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LABS(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LeadingOnes(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LeadingOnesDummy1(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LeadingOnesDummy2(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LeadingOnesEpistasis(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LeadingOnesNeutrality(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LeadingOnesRuggedness1(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LeadingOnesRuggedness2(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LeadingOnesRuggedness3(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Linear(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LinearSlope(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class LunacekBiRastrigin(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class MIS(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
+
+class MaxCut(Integer):
+    @overload
+    def __init__(self, instance: int, n_variables: int) -> None: ...
+    @overload
+    def __init__(self, instance: int, graph: Graph) -> None: ...
+    @property
+    def graph(self) -> Graph: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
+
+class MaxIndependentSet(Integer):
+    @overload
+    def __init__(self, instance: int, n_variables: int) -> None: ...
+    @overload
+    def __init__(self, instance: int, graph: Graph) -> None: ...
+    @property
+    def graph(self) -> Graph: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class NQueens(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class OneMax(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class OneMaxDummy1(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class OneMaxDummy2(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class OneMaxEpistasis(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class OneMaxNeutrality(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class OneMaxRuggedness1(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class OneMaxRuggedness2(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class OneMaxRuggedness3(Integer):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class PBO(Integer):
     def __init__(self, *args, **kwargs) -> None: ...
 
 class Rastrigin(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class RastriginRotated(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Real:
     problems: ClassVar[Any] = ...  # read-only
@@ -170,32 +313,87 @@ class Real:
     @property
     def state(self) -> Any: ...
 
+class RealInstances:
+    def __init__(self, problem: Union[int, str], instances: List[int], n_variables: int) -> None: ...
+    @overload
+    def __call__(self, x: List[float]) -> List[float]: ...
+    @overload
+    def __call__(self, xs: List[List[float]]) -> List[List[float]]: ...
+    def __len__(self) -> int: ...
+    @property
+    def instances(self) -> List[int]: ...
+    @property
+    def n_variables(self) -> int: ...
+    @property
+    def optima(self) -> List[List[float]]: ...
+    @property
+    def optimum_values(self) -> List[float]: ...
+    @property
+    def stacked(self) -> bool: ...
+
 class RealWrappedProblem(Real):
     def __init__(self, *args, **kwargs) -> None: ...
 
 class Rosenbrock(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class RosenbrockRotated(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Schaffers10(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Schaffers1000(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Schwefel(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
+
+class SharedRotations:
+    def __init__(self, name: str, problems: List[BBOB]) -> None: ...
+    @staticmethod
+    def attach(name: str) -> None: ...
+    def close(self) -> None: ...
+    def __enter__(self) -> SharedRotations: ...
+    def __exit__(self, *args) -> None: ...
+    def __len__(self) -> int: ...
+    @property
+    def name(self) -> str: ...
 
 class SharpRidge(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class Sphere(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class StepEllipsoid(Real):
     def __init__(self, arg0: int, arg1: int) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
+
+class VertexCover(Integer):
+    @overload
+    def __init__(self, instance: int, n_variables: int) -> None: ...
+    @overload
+    def __init__(self, instance: int, graph: Graph) -> None: ...
+    @property
+    def graph(self) -> Graph: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
 
 class WModelLeadingOnes(AbstractWModel):
     def __init__(self, instance: int, n_variables: int, dummy_select_rate: float = ..., epistasis_block_size: int = ..., neutrality_mu: int = ..., ruggedness_gamma: int = ...) -> None: ...
@@ -208,3 +406,5 @@ class Weierstrass(Real):
 
 def wrap_integer_problem(f: handle, name: str, optimization_type: ioh.iohcpp.OptimizationType = ..., lb: Optional[float] = ..., ub: Optional[float] = ..., transform_variables: Optional[handle] = ..., transform_objectives: Optional[handle] = ..., calculate_objective: Optional[handle] = ...) -> None: ...
 def wrap_real_problem(f: handle, name: str, optimization_type: ioh.iohcpp.OptimizationType = ..., lb: Optional[float] = ..., ub: Optional[float] = ..., transform_variables: Optional[handle] = ..., transform_objectives: Optional[handle] = ..., calculate_objective: Optional[handle] = ...) -> None: ...
+    def __getstate__(self) -> tuple: ...
+    def __setstate__(self, arg0: tuple) -> None: ...
@@ -0,0 +1,199 @@
+"""Read the live results published by ioh.logger.Live, from any process.
+
+The logger publishes the best-so-far trajectory and a summary of each run in a POSIX shared
+memory segment, which this module maps read-only. Runs are copied with a seqlock protocol,
+so that snapshots are consistent without slowing down the experiment.
+
+Example
+-------
+>>> from ioh import live
+>>> with live.Reader("my-campaign") as reader:
+...     for run in reader.snapshot():
+...         print(run.problem_id, run.best_y, run.evaluations)
+"""
+
+import dataclasses
+import mmap
+import os
+import struct
+import time
+import typing
+
+MAGIC = b"IOHLIVE\0"
+VERSION = 1
+BYTE_ORDER_MARK = 0x01020304
+
+#: magic, byte order mark, version, header size, slot size, number of slots, trajectory capacity, reserved,
+#: number of runs, writer's pid, closed flag, reserved
+HEADER = struct.Struct("=8sIHHIIIIQQQQ")
+
+#: sequence, run, suite, problem, problem id, instance, dimension, optimization type, state, reserved,
+#: evaluations, best-so-far, evaluation of the best, number of improvements
+RECORD = struct.Struct("=QQ32s32siiiBBHQdQQ")
+
+#: evaluations, best-so-far
+POINT = struct.Struct("=Qd")
+
+_U64 = struct.Struct("=Q")
+_NB_RUNS = 32
+_CLOSED = 48
+
+
+@dataclasses.dataclass
+class Run:
+    """A consistent copy of a run."""
+
+    run: int
+    suite: str
+    problem: str
+    problem_id: int
+    instance: int
+    n_variables: int
+    maximization: bool
+    finished: bool
+    evaluations: int
+    best_y: float
+    best_evaluation: int
+    nb_points: int
+    trajectory: typing.List[typing.Tuple[int, float]]
+
+
+def _map(name: str) -> mmap.mmap:
+    """Map a shared memory segment read-only."""
+    name = name if name.startswith("/") else "/" + name
+    try:
+        import _posixshmem
+
+        fd = _posixshmem.shm_open(name, os.O_RDONLY, mode=0)
+    except ImportError:
+        fd = os.open("/dev/shm" + name, os.O_RDONLY)
+    try:
+        return mmap.mmap(fd, 0, flags=mmap.MAP_SHARED, prot=mmap.PROT_READ)
+    finally:
+        os.close(fd)
+
+
+class Reader:
+    """Maps a segment written by ioh.logger.Live, read-only.
+
+    Parameters
+    ----------
+    name: str
+        Name of the segment, as given to the logger.
+    """
+
+    def __init__(self, name: str):
+        self._map = _map(name)
+        if len(self._map) < HEADER.size:
+            self.close()
+            raise ValueError(f"Not a live results segment: {name}")
+        (
+            magic,
+            byte_order_mark,
+            version,
+            self._header_size,
+            self._slot_size,
+            self._nb_slots,
+            self._capacity,
+            *_,
+        ) = HEADER.unpack_from(self._map, 0)
+        if (
+            magic != MAGIC
+            or byte_order_mark != BYTE_ORDER_MARK
+            or version != VERSION
+            or self._header_size != HEADER.size
+            or self._nb_slots == 0
+            or self._slot_size != RECORD.size + self._capacity * POINT.size
+            or len(self._map) < self._header_size + self._nb_slots * self._slot_size
+        ):
+            self.close()
+            raise ValueError(f"Not a live results segment of version {VERSION}: {name}")
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def close(self):
+        """Unmap the segment."""
+        self._map.close()
+
+    @property
+    def nb_runs(self) -> int:
+        """Number of runs started so far."""
+        return _U64.unpack_from(self._map, _NB_RUNS)[0]
+
+    @property
+    def nb_slots(self) -> int:
+        """Number of runs kept in the ring."""
+        return self._nb_slots
+
+    @property
+    def trajectory_capacity(self) -> int:
+        """Maximum number of points of the trajectories."""
+        return self._capacity
+
+    @property
+    def closed(self) -> bool:
+        """Whether the writer is closed."""
+        return _U64.unpack_from(self._map, _CLOSED)[0] != 0
+
+    @property
+    def pid(self) -> int:
+        """Process id of the writer."""
+        return HEADER.unpack_from(self._map, 0)[9]
+
+    def run(self, run: int) -> typing.Optional[Run]:
+        """A consistent copy of a run, None if it has not started or has been overwritten by a later one."""
+        if run >= self.nb_runs:
+            return None
+        offset = self._header_size + (run % self._nb_slots) * self._slot_size
+        while True:
+            before = _U64.unpack_from(self._map, offset)[0]
+            if before % 2 == 0:
+                data = self._map[offset : offset + self._slot_size]
+                if _U64.unpack_from(self._map, offset)[0] == before:
+                    break
+            time.sleep(0)
+
+        (
+            _,
+            number,
+            suite,
+            problem,
+            problem_id,
+            instance,
+            n_variables,
+            optimization_type,
+            state,
+            _,
+            evaluations,
+            best_y,
+            best_evaluation,
+            nb_points,
+        ) = RECORD.unpack_from(data, 0)
+        if number != run:
+            return None
+        n = min(nb_points, self._capacity)
+        return Run(
+            number,
+            suite.rstrip(b"\0").decode(errors="replace"),
+            problem.rstrip(b"\0").decode(errors="replace"),
+            problem_id,
+            instance,
+            n_variables,
+            optimization_type == 2,
+            state == 2,
+            evaluations,
+            best_y,
+            best_evaluation,
+            nb_points,
+            [POINT.unpack_from(data, RECORD.size + i * POINT.size) for i in range(n)],
+        )
+
+    def snapshot(self) -> typing.List[Run]:
+        """Consistent copies of the runs still in the ring, in order."""
+        n = self.nb_runs
+        runs = (self.run(r) for r in range(max(0, n - self._nb_slots), n))
+        return [r for r in runs if r is not None]
@@ -7,6 +7,7 @@ void define_helper_classes(py::module& m);
 void define_problem(py::module& m);
 void define_suite(py::module& m);
 void define_logger(py::module& m);
+void define_landscape(py::module& m);
 
 PYBIND11_MODULE(iohcpp, m) {
     m.doc() = R"pbdoc(
@@ -47,11 +48,13 @@ PYBIND11_MODULE(iohcpp, m) {
     auto m_problem = m.def_submodule("problem", "IOHExperimenter problems");
     auto m_suite = m.def_submodule("suite", "IOHExperimenter suites");
     auto m_logger = m.def_submodule("logger", "IOHExperimenter logger");
+    auto m_landscape = m.def_submodule("landscape", "IOHExperimenter landscape analysis");
     
     define_helper_classes(m);
     define_logger(m_logger);
     define_problem(m_problem);
     define_suite(m_suite);
+    define_landscape(m_landscape);
 
     m.attr("__version__") = "dev";
 }
@@ -0,0 +1,92 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "ioh.hpp"
+
+namespace py = pybind11;
+using namespace ioh::landscape;
+
+template <typename T>
+void define_analysis(py::module &m, const std::string &name)
+{
+    using Class = Analysis<T>;
+    py::class_<Class>(m, name.c_str(), "The features of a sample, and its subsample with its nearest-better data.")
+        .def_readonly("features", &Class::features)
+        .def_readonly("points", &Class::points, "The points of the subsample.")
+        .def_readonly("y", &Class::y, "The values of the points of the subsample.")
+        .def_readonly("nearest_distance", &Class::nearest_distance, "The distances to the nearest neighbor.")
+        .def_readonly("nearest_better_distance", &Class::nearest_better_distance,
+                      "The distances to the nearest better point, infinite for the best point.")
+        .def_readonly("nearest_better", &Class::nearest_better,
+                      "The indices of the nearest better point, -1 for the best point.");
+
+    m.def(
+        "analyze",
+        [](ioh::problem::Problem<T> &problem, const sampler::Sampler &sampler, const size_t n,
+           const size_t nb_threads, const size_t subsample, const double best_fraction, const uint64_t seed) {
+            // A single thread evaluates with the GIL, and can call problems implemented in Python.
+            if (nb_threads == 1)
+                return analyze(problem, sampler, n, {nb_threads, subsample, best_fraction, seed});
+            py::gil_scoped_release release;
+            return analyze(problem, sampler, n, {nb_threads, subsample, best_fraction, seed});
+        },
+        py::arg("problem"), py::arg("sampler"), py::arg("n"), py::arg("nb_threads") = 0, py::arg("subsample") = 1000,
+        py::arg("best_fraction") = 0.1, py::arg("seed") = 1,
+        R"pbdoc(
+            Sample a problem with several threads, and compute its landscape features.
+
+            Parameters
+            ----------
+                problem: the problem, with finite bounds, evaluated by a single thread if implemented in Python
+                sampler: the sampler of the unit hypercube, scaled to the bounds
+                n: the number of samples, the points 0 to n - 1 of the sampler
+                nb_threads: the number of threads, 0 for the number of hardware threads
+                subsample: the size of the subsample of the dispersion and nearest-better features
+                best_fraction: the fraction of the best points whose dispersion is measured
+                seed: the seed of the subsample
+        )pbdoc");
+}
+
+void define_landscape(py::module &m)
+{
+    py::class_<sampler::Sampler, std::shared_ptr<sampler::Sampler>>(m, "Sampler",
+                                                                     "Sampler of the unit hypercube [0, 1)^d.")
+        .def("__call__", py::overload_cast<size_t>(&sampler::Sampler::operator(), py::const_), py::arg("index"),
+             "The point of the given index.")
+        .def_property_readonly("dimension", &sampler::Sampler::dimension);
+
+    py::class_<sampler::Uniform, sampler::Sampler, std::shared_ptr<sampler::Uniform>>(m, "Uniform",
+                                                                                      "Independent uniform points.")
+        .def(py::init<size_t, uint64_t>(), py::arg("dimension"), py::arg("seed") = 1);
+
+    py::class_<sampler::LatinHypercube, sampler::Sampler, std::shared_ptr<sampler::LatinHypercube>>(
+        m, "LatinHypercube", "Latin hypercube sample of a given size.")
+        .def(py::init<size_t, size_t, uint64_t>(), py::arg("dimension"), py::arg("size"), py::arg("seed") = 1)
+        .def_property_readonly("size", &sampler::LatinHypercube::size);
+
+    py::class_<sampler::Sobol, sampler::Sampler, std::shared_ptr<sampler::Sobol>>(
+        m, "Sobol", "The Sobol sequence, for up to 1024 dimensions, with a random digital shift if seed is not 0.")
+        .def(py::init<size_t, uint64_t>(), py::arg("dimension"), py::arg("seed") = 0);
+
+    py::class_<Moments>(m, "Moments", "Moments of a sequence of values.")
+        .def_readonly("n", &Moments::n)
+        .def_readonly("mean", &Moments::mean)
+        .def_readonly("min", &Moments::min)
+        .def_readonly("max", &Moments::max)
+        .def_property_readonly("variance", &Moments::variance)
+        .def_property_readonly("skewness", &Moments::skewness)
+        .def_property_readonly("kurtosis", &Moments::kurtosis);
+
+    py::class_<Features>(m, "Features", "Landscape features of a sample.")
+        .def_readonly("samples", &Features::samples)
+        .def_readonly("y", &Features::y)
+        .def_readonly("fdc", &Features::fdc)
+        .def_readonly("dispersion", &Features::dispersion)
+        .def_readonly("nb_nn_mean_ratio", &Features::nb_nn_mean_ratio)
+        .def_readonly("nb_nn_std_ratio", &Features::nb_nn_std_ratio)
+        .def_readonly("nb_nn_correlation", &Features::nb_nn_correlation)
+        .def_readonly("nb_fitness_correlation", &Features::nb_fitness_correlation)
+        .def("__repr__", &Features::repr);
+
+    define_analysis<double>(m, "RealAnalysis");
+    define_analysis<int>(m, "IntegerAnalysis");
+}
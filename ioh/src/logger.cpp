@@ -82,7 +82,11 @@ public:
             watch(container, attr);
     }
 
-    void log(const logger::Info &log_info) override { PYBIND11_OVERRIDE(void, WatcherType, log, log_info); }
+    void log(const logger::Info &log_info) override
+    {
+        if (not call_override("log", log_info))
+            WatcherType::log(log_info);
+    }
 
     void attach_problem(const problem::MetaData &problem) override
     {
@@ -94,7 +98,23 @@ public:
         PYBIND11_OVERRIDE(void, WatcherType, attach_suite, suite_name);
     }
 
-    void call(const logger::Info &log_info) override { PYBIND11_OVERRIDE(void, WatcherType, call, log_info); }
+    void call(const logger::Info &log_info) override
+    {
+        if (not call_override("call", log_info))
+            WatcherType::call(log_info);
+    }
+
+private:
+    //! Call a Python override with a copy of the log info owning its variables, which Python may keep.
+    bool call_override(const char *name, const logger::Info &log_info)
+    {
+        py::gil_scoped_acquire gil;
+        const auto override = py::get_override(static_cast<const WatcherType *>(this), name);
+        if (not override)
+            return false;
+        override(std::shared_ptr<logger::Info>(std::make_shared<logger::StoredInfo>(log_info)));
+        return true;
+    }
 };
 
 class PyAnalyzer : public PyWatcher<logger::Analyzer>
@@ -171,7 +191,8 @@ void define_triggers(py::module &m)
 
     py::class_<logger::Trigger, std::shared_ptr<logger::Trigger>>(t, "Trigger")
         .def("__call__", &logger::Trigger::operator())
-        .def("reset", &logger::Trigger::reset);
+        .def("reset", &logger::Trigger::reset)
+        .def("next", &logger::Trigger::next);
 
     py::class_<trigger::Always, logger::Trigger, std::shared_ptr<trigger::Always>>(t, "Always")
         .def(py::init<>())
@@ -304,6 +325,9 @@ void define_flatfile(py::module &m)
         .def_property_readonly(
             "output_directory",
             [](PyWatcher<FlatFile> &f) { return fs::absolute(f.output_directory()).generic_string(); })
+        .def("compress", &FlatFile::compress, py::arg("level") = 1,
+             "Write gzip files, compressed on a background thread, with a gzip member per run.")
+        .def_property_readonly("compression", &FlatFile::compression)
         .def("watch", py::overload_cast<Property &>(&PyWatcher<FlatFile>::watch))
         .def("watch", py::overload_cast<const py::object &, const std::string &>(&PyWatcher<FlatFile>::watch))
         .def("watch",
@@ -319,18 +343,29 @@ void define_store(py::module &m)
 
     using PyStore = PyWatcher<Store>;
     py::class_<PyStore, Watcher, std::shared_ptr<PyStore>>(m, "Store")
-        .def(py::init<Triggers, Properties>())
+        .def(py::init<Triggers, Properties, size_t, fs::path>(), py::arg("triggers"), py::arg("properties"),
+             py::arg("memory_budget") = 0, py::arg("spill_directory") = "",
+             "A memory_budget (in bytes) above which the logged rows are spilled to a temporary file can be "
+             "given, 0 meaning no limit.")
         .def("data", py::overload_cast<>(&PyStore::data))
         .def("at",
              [](PyStore &f, std::string suite_name, int pb, int dim, int inst, size_t run, size_t evaluation) {
                  const auto cursor = Store::Cursor(suite_name, pb, dim, inst, run, evaluation);
                  return f.data(cursor);
              })
+        .def_property_readonly("memory_usage", &PyStore::memory_usage,
+                               "Estimated size of the data held in memory, in bytes.")
+        .def_property_readonly("memory_budget", &PyStore::memory_budget)
+        .def_property_readonly("spilled_size", &PyStore::spilled_size, "Size of the runs spilled to disk, in bytes.")
+        .def_property_readonly("nb_spilled", &PyStore::nb_spilled)
         .def("watch", py::overload_cast<Property &>(&PyStore::watch))
         .def("watch", py::overload_cast<const py::object &, const std::string &>(&PyStore::watch))
         .def("watch", py::overload_cast<const py::object &, const std::vector<std::string> &>(&PyStore::watch))
         .def("__repr__", [](PyStore &f) {
-            return fmt::format("<Store (suites: ({}),)>", fmt::join(ioh::common::keys(f.data()), ","));
+            std::set<std::string> suites;
+            for (const auto &cursor : f.runs())
+                suites.insert(cursor.suite);
+            return fmt::format("<Store (suites: ({}),)>", fmt::join(suites, ","));
         });
 }
 
@@ -357,6 +392,9 @@ void define_analyzer(py::module &m)
         .def("set_run_attributes", &PyAnalyzer::set_run_attributes_python)
         .def("set_run_attribute", &PyAnalyzer::set_run_attribute_python)
         .def_property_readonly("output_directory", &PyAnalyzer::output_directory)
+        .def("compress", &PyAnalyzer::compress, py::arg("level") = 1,
+             "Write .dat.gz files, compressed on a background thread, with a gzip member per run.")
+        .def_property_readonly("compression", &PyAnalyzer::compression)
         .def("watch", py::overload_cast<Property &>(&PyAnalyzer::watch))
         .def("watch", py::overload_cast<const py::object &, const std::string &>(&PyAnalyzer::watch))
         .def("watch", py::overload_cast<const py::object &, const std::vector<std::string> &>(&PyAnalyzer::watch))
@@ -375,7 +413,10 @@ void define_eah_scale(py::module &m, const std::string &name)
         .def_property_readonly("size", &Scale<T>::size)
         .def_property_readonly("length", &Scale<T>::length)
         .def("index", &Scale<T>::index)
+        .def("indices", py::overload_cast<const std::vector<double> &>(&Scale<T>::indices, py::const_),
+             py::arg("values"), "Indices of several values at once.")
         .def("bounds", &Scale<T>::bounds)
+        .def_property_readonly("thresholds", &Scale<T>::thresholds)
         .def("__repr__", [name](const Scale<T> &s) {
             return fmt::format("<{} (({}, {}), {})>", name, s.min(), s.max(), s.size());
         });
@@ -437,6 +478,191 @@ void define_eaf(py::module &m)
 }
 
 
+void define_summary(py::module &m)
+{
+    using namespace logger;
+    py::class_<Summary, Logger, std::shared_ptr<Summary>>(m, "Summary")
+        .def(py::init<std::vector<double>, std::vector<size_t>, std::string, fs::path, std::string>(),
+             py::arg("targets"), py::arg("budgets"), py::arg("filename") = "IOH-summary.dat",
+             py::arg("output_directory") = "./", py::arg("no_value") = "None")
+        .def(py::init<const eah::Scale<double> &, const eah::Scale<size_t> &, std::string, fs::path, std::string>(),
+             py::arg("target_scale"), py::arg("budget_scale"), py::arg("filename") = "IOH-summary.dat",
+             py::arg("output_directory") = "./", py::arg("no_value") = "None")
+        .def("close", &Summary::close)
+        .def_property_readonly("targets", &Summary::targets)
+        .def_property_readonly("budgets", &Summary::budgets)
+        .def_property_readonly("filename", &Summary::filename)
+        .def_property_readonly("output_directory",
+                               [](const Summary &f) { return fs::absolute(f.output_directory()).generic_string(); })
+        .def("__repr__", [](const Summary &f) {
+            return fmt::format("<Summary {}>", (f.output_directory() / f.filename()).generic_string());
+        });
+}
+
+void define_recorder(py::module &m)
+{
+    using namespace logger;
+    py::class_<Recorder, Logger, std::shared_ptr<Recorder>>(m, "Recorder",
+                                                            "Record every logged event in a compact binary file.")
+        .def(py::init<fs::path, bool>(), py::arg("file"), py::arg("store_positions") = false)
+        .def("flush", &Recorder::flush)
+        .def("close", &Recorder::close)
+        .def_property_readonly("store_positions", &Recorder::store_positions);
+
+    py::class_<Replayer>(m, "Replayer", "Replay a recording made by a Recorder through any logger.")
+        .def(py::init<fs::path>(), py::arg("file"))
+        .def("replay", &Replayer::replay, py::arg("logger"), py::keep_alive<2, 1>(),
+             "Feed the whole recording to the logger, as if it was attached to the problems.")
+        .def_property_readonly("store_positions", &Replayer::store_positions);
+}
+
+void define_live(py::module &m)
+{
+    using namespace logger;
+    py::class_<Live, Logger, std::shared_ptr<Live>>(
+        m, "Live",
+        "Publish the best-so-far trajectory and a summary of each run in a POSIX shared memory segment, "
+        "which other processes can read while the campaign runs (see ioh.live).")
+        .def(py::init<std::string, size_t, size_t, bool>(), py::arg("name"), py::arg("nb_slots") = 1024,
+             py::arg("trajectory_capacity") = 256, py::arg("unlink") = true)
+        .def_property_readonly("name", &Live::name)
+        .def("close", &Live::close);
+}
+
+void define_trace(py::module &m)
+{
+    using namespace logger;
+    auto tr = m.def_submodule("trace", "Lossless compression of the solutions seen by a logger.");
+    py::enum_<trace::Encoding>(tr, "Encoding")
+        .value("Real", trace::Encoding::Real)
+        .value("Integer", trace::Encoding::Integer)
+        .export_values();
+
+    tr.def(
+          "encode",
+          [](const std::vector<std::vector<double>> &solutions, const trace::Encoding encoding) {
+              return py::bytes(trace::encode(solutions, encoding));
+          },
+          py::arg("solutions"), py::arg("encoding") = trace::Encoding::Real,
+          "Encode consecutive solutions, each one with respect to the previous one.")
+        .def(
+            "decode",
+            [](const py::bytes &data, const size_t n_variables, const size_t count, const trace::Encoding encoding) {
+                return trace::decode(std::string(data), n_variables, count, encoding);
+            },
+            py::arg("data"), py::arg("n_variables"), py::arg("count"), py::arg("encoding") = trace::Encoding::Real,
+            "Decode count solutions of n_variables variables.")
+        .def(
+            "read",
+            [](const fs::path &file) {
+                py::list runs;
+                for (auto &run : trace::read(file))
+                    runs.append(py::dict(py::arg("suite") = run.suite, py::arg("problem_id") = run.problem_id,
+                                         py::arg("instance") = run.instance,
+                                         py::arg("n_variables") = run.n_variables,
+                                         py::arg("evaluations") = run.evaluations,
+                                         py::arg("solutions") = run.solutions));
+                return runs;
+            },
+            py::arg("file"), "Read the runs of a file written by a PositionTrace logger.");
+
+    py::class_<PositionTrace, Logger, std::shared_ptr<PositionTrace>>(
+        m, "PositionTrace", "Write the logged solutions in a compressed, lossless, binary file.")
+        .def(py::init<Triggers, fs::path, trace::Encoding>(), py::arg("triggers"), py::arg("file"),
+             py::arg("encoding") = trace::Encoding::Real)
+        .def("close", &PositionTrace::close);
+}
+
+void define_archive(py::module &m)
+{
+    using namespace logger;
+    using PyStore = PyWatcher<Store>;
+
+    auto ar = m.def_submodule("archive", "Binary archives of the data of the in-memory loggers.");
+    ar.def(
+          "save", [](const fs::path &file, const EAF &l) { archive::save(file, l); }, py::arg("file"),
+          py::arg("logger"), "Save the data of the logger in a binary archive.")
+        .def(
+            "save", [](const fs::path &file, const EAH &l) { archive::save(file, l); }, py::arg("file"),
+            py::arg("logger"), "Save the data of the logger in a binary archive.")
+        .def(
+            "save", [](const fs::path &file, PyStore &l) { archive::save(file, l); }, py::arg("file"),
+            py::arg("logger"), "Save the data of the logger in a binary archive.")
+        .def(
+            "load", [](const fs::path &file, EAF &l) { archive::load(file, l); }, py::arg("file"), py::arg("logger"),
+            "Add the runs of a binary archive to the logger.")
+        .def(
+            "load", [](const fs::path &file, EAH &l) { archive::load(file, l); }, py::arg("file"), py::arg("logger"),
+            "Add the runs of a binary archive to the logger.")
+        .def(
+            "load", [](const fs::path &file, PyStore &l) { archive::load(file, l); }, py::arg("file"),
+            py::arg("logger"), "Add the runs of a binary archive to the logger.");
+}
+
+void define_analyzer_reader(py::module &m)
+{
+    using namespace logger::analyzer::v1;
+
+    py::class_<Table>(m, "AnalyzerTable", "Columns of a .dat file, the lines of all the runs being concatenated.")
+        .def_readonly("names", &Table::names)
+        .def_readonly("columns", &Table::columns)
+        .def_readonly("run_starts", &Table::run_starts)
+        .def_property_readonly("nb_runs", &Table::nb_runs)
+        .def("column", &Table::column, py::arg("name"))
+        .def("__len__", &Table::size)
+        .def("__repr__", [](const Table &t) {
+            return fmt::format("<AnalyzerTable {} runs, {} lines: {}>", t.nb_runs(), t.size(), fmt::join(t.names, ", "));
+        });
+
+    py::class_<Reader>(m, "AnalyzerReader", "Read back the .info and .dat files written by an Analyzer.")
+        .def(py::init<fs::path>(), py::arg("root"))
+        .def_property_readonly("root", &Reader::root)
+        .def_property_readonly("data_files", &Reader::data_files)
+        .def_property_readonly("experiments",
+                               [](const Reader &r) {
+                                   py::list experiments;
+                                   for (const auto &e : r.experiments())
+                                   {
+                                       py::dict attributes, experiment;
+                                       for (const auto &a : e.attributes)
+                                           attributes[py::str(a.name)] = a.value;
+                                       py::list scenarios;
+                                       for (const auto &s : e.dims)
+                                       {
+                                           py::list runs;
+                                           for (const auto &run : s.runs)
+                                           {
+                                               py::dict run_attributes;
+                                               for (const auto &a : run.attributes)
+                                                   run_attributes[py::str(a.name)] = a.value;
+                                               runs.append(py::dict(py::arg("instance") = run.instance,
+                                                                    py::arg("evals") = run.evals,
+                                                                    py::arg("best_y") = run.best_point.point.y,
+                                                                    py::arg("attributes") = run_attributes));
+                                           }
+                                           scenarios.append(py::dict(py::arg("dimension") = s.dimension,
+                                                                     py::arg("data_file") = s.data_file,
+                                                                     py::arg("runs") = runs));
+                                       }
+                                       experiments.append(py::dict(
+                                           py::arg("suite") = e.suite, py::arg("function_id") = e.problem.problem_id,
+                                           py::arg("function_name") = e.problem.name,
+                                           py::arg("maximization") =
+                                               e.problem.optimization_type == common::OptimizationType::Maximization,
+                                           py::arg("algorithm") = py::dict(py::arg("name") = e.algorithm.name,
+                                                                           py::arg("info") = e.algorithm.info),
+                                           py::arg("attributes") = attributes, py::arg("scenarios") = scenarios));
+                                   }
+                                   return experiments;
+                               })
+        .def("table", &Reader::table, py::arg("index"), py::call_guard<py::gil_scoped_release>(),
+             "Parse the data file of the given index in data_files.")
+        .def("tables", &Reader::tables, py::arg("nb_threads") = 0, py::call_guard<py::gil_scoped_release>(),
+             "Parse all the data files in parallel.")
+        .def("replay", &Reader::replay, py::arg("logger"), py::arg("nb_threads") = 0,
+             "Feed all the runs to a logger, as if the problems were solved again.");
+}
+
 void define_loggers(py::module &m)
 {
     using namespace logger;
@@ -450,6 +676,12 @@ void define_loggers(py::module &m)
     define_analyzer(m);
     define_eah(m);
     define_eaf(m);
+    define_summary(m);
+    define_recorder(m);
+    define_live(m);
+    define_trace(m);
+    define_archive(m);
+    define_analyzer_reader(m);
 }
 
 
@@ -256,7 +256,7 @@ void define_wrapper_functions(py::module &m, const std::string &class_name, cons
                 return Solution<T>(dim, t);
             };
 
-            wrap_function<T>(of, name, t, lb, ub, ptx, pty, pco);
+            wrap_function<T>(ObjectiveFunction<T>(of), name, t, lb, ub, ptx, pty, pco);
         },
         py::arg("f"), py::arg("name"), py::arg("optimization_type") = ioh::common::OptimizationType::Minimization,
         py::arg("lb") = std::nullopt, py::arg("ub") = std::nullopt, py::arg("transform_variables") = std::nullopt,
@@ -267,6 +267,55 @@ void define_wrapper_functions(py::module &m, const std::string &class_name, cons
 #pragma GCC diagnostic pop
 #endif
 
+template <typename T>
+void define_instances(py::module &m, const std::string &name)
+{
+    using Class = Instances<T>;
+    py::class_<Class, std::shared_ptr<Class>>(m, name.c_str(),
+                                              R"pbdoc(
+            Evaluates points on many instances of a problem at once, e.g. all the instances of a BBOB function,
+            giving the same values as calling each problem, without changing their state nor logging.
+
+            Parameters
+            ----------
+                problem: the id or the name of a registered problem
+                instances: the ids of the instances
+                n_variables: the dimension
+        )pbdoc")
+        .def(py::init<int, std::vector<int>, int>(), py::arg("problem"), py::arg("instances"), py::arg("n_variables"))
+        .def(py::init<std::string, std::vector<int>, int>(), py::arg("problem"), py::arg("instances"),
+             py::arg("n_variables"))
+        .def(
+            "__call__", [](Class &c, const std::vector<T> &x) { return c(x); }, py::arg("x"),
+            "The values of a point, one per instance.")
+        .def(
+            "__call__",
+            [](Class &c, const std::vector<std::vector<T>> &xs) {
+                const auto y = c(xs);
+                std::vector<std::vector<double>> result;
+                for (size_t p = 0; p < xs.size(); ++p)
+                    result.emplace_back(y.begin() + p * c.size(), y.begin() + (p + 1) * c.size());
+                return result;
+            },
+            py::arg("xs"), "The values of points, one list per point, with one value per instance.")
+        .def("__len__", &Class::size)
+        .def_property_readonly("instances", &Class::instances, "The ids of the instances.")
+        .def_property_readonly("n_variables", &Class::n_variables, "The dimension.")
+        .def_property_readonly(
+            "optima",
+            [](const Class &c) {
+                std::vector<std::vector<T>> optima;
+                const auto n = static_cast<size_t>(c.n_variables());
+                for (size_t k = 0; k < c.size(); ++k)
+                    optima.emplace_back(c.optima().begin() + k * n, c.optima().begin() + (k + 1) * n);
+                return optima;
+            },
+            "The optimal points, one per instance.")
+        .def_property_readonly("optimum_values", &Class::optimum_values, "The optimal values, one per instance.")
+        .def_property_readonly("stacked", &Class::stacked,
+                               "Whether the variables of all the instances are transformed in one pass.");
+}
+
 void define_helper_classes(py::module &m)
 {
     py::enum_<ioh::common::OptimizationType>(m, "OptimizationType")
@@ -293,8 +342,21 @@ void define_helper_classes(py::module &m)
                       "The number of variables (dimension) of the current problem")
         .def("__repr__", &MetaData::repr);
 
-    py::class_<ioh::logger::Info>(m, "LogInfo")
-        .def(py::init<size_t, double, double, double, Solution<double>, Solution<double>>())
+    // Log infos made in Python own their variables, which those of the problems only view.
+    py::class_<ioh::logger::Info, std::shared_ptr<ioh::logger::Info>>(m, "LogInfo")
+        .def(py::init([](const size_t evaluations, const double y_best, const double transformed_y,
+                         const double transformed_y_best, const Solution<double> &current,
+                         const Solution<double> &objective) {
+            auto info = std::make_shared<ioh::logger::StoredInfo>();
+            info->evaluations = evaluations;
+            info->raw_y_best = y_best;
+            info->transformed_y = transformed_y;
+            info->transformed_y_best = transformed_y_best;
+            info->x = current.x;
+            info->current = {info->x, current.y};
+            info->optimum = objective;
+            return std::shared_ptr<ioh::logger::Info>(std::move(info));
+        }))
         .def_readonly("evaluations", &ioh::logger::Info::evaluations,
                       "The number of evaluations performed on the current problem so far")
         .def_readonly("y_best", &ioh::logger::Info::raw_y_best, "The best fitness value found so far")
@@ -302,15 +364,92 @@ void define_helper_classes(py::module &m)
                       "The internal representation of the current fitness value")
         .def_readonly("transformed_y_best", &ioh::logger::Info::transformed_y_best,
                       "The internal representation of the best-so-far fitness")
-        .def_readonly("current", &ioh::logger::Info::current, "The fitness of the last evaluated solution")
+        .def_property_readonly(
+            "current",
+            [](const ioh::logger::Info &info) {
+                return Solution<double>(info.current.x.as_double(), info.current.y);
+            },
+            "The fitness of the last evaluated solution")
         .def_readonly("objective", &ioh::logger::Info::optimum, "The best possible fitness value");
 }
 
+//! Pickling of the problems created from their instance and dimension. The BBOB problems also carry their
+//! rotations, or the shared memory segment holding them, so that unpickling them does not compute them again.
+template <typename P>
+auto pickle_problem()
+{
+    return py::pickle(
+        [](const P &p) {
+            const auto meta_data = p.meta_data();
+            if constexpr (std::is_base_of_v<BBOB, P>)
+            {
+                const auto rotations = p.rotations();
+                const auto segment = bbob::RotationCache::instance().segment(rotations->seed, rotations->n_variables,
+                                                                             rotations->condition);
+                return py::make_tuple(meta_data.instance, meta_data.n_variables,
+                                      py::bytes(segment.empty() ? rotations->serialize() : std::string()), segment);
+            }
+            else
+                return py::make_tuple(meta_data.instance, meta_data.n_variables);
+        },
+        [](const py::tuple &state) {
+            if constexpr (std::is_base_of_v<BBOB, P>)
+            {
+                auto &cache = bbob::RotationCache::instance();
+                if (const auto segment = state[3].cast<std::string>(); not segment.empty())
+                    cache.attach(segment);
+                else
+                    cache.load(state[2].cast<std::string>());
+            }
+            return std::make_shared<P>(state[0].cast<int>(), state[1].cast<int>());
+        });
+}
+
+template <typename P>
+void define_graph_problem(py::module &m, const std::string &name, const std::string &doc)
+{
+    py::class_<P, Integer, std::shared_ptr<P>>(m, name.c_str(), py::is_final(),
+                                               (doc + R"pbdoc(
+
+            Defined on a random graph of average degree 4 with n_variables vertices, or on a given graph.
+        )pbdoc")
+                                                   .c_str())
+        .def(py::init<int, int>(), py::arg("instance"), py::arg("n_variables"))
+        .def(py::init([](const int instance, std::shared_ptr<pbo::Graph> graph) {
+                 return std::make_shared<P>(instance, std::move(graph));
+             }),
+             py::arg("instance"), py::arg("graph"))
+        .def_property_readonly("graph", &P::graph, py::return_value_policy::reference_internal)
+        .def(py::pickle(
+            [](const P &p) {
+                const auto &g = p.graph();
+                const auto bytes = [](const auto &v) {
+                    return py::bytes(reinterpret_cast<const char *>(v.data()), v.size() * sizeof(v[0]));
+                };
+                return py::make_tuple(p.meta_data().instance, g.size(), bytes(g.sources()), bytes(g.targets()),
+                                      bytes(g.weights()));
+            },
+            [](const py::tuple &state) {
+                const auto sources = state[2].cast<std::string>(), targets = state[3].cast<std::string>(),
+                           weights = state[4].cast<std::string>();
+                std::vector<pbo::Graph::Edge> edges(sources.size() / sizeof(uint32_t));
+                for (size_t e = 0; e < edges.size(); ++e)
+                {
+                    std::memcpy(&edges[e].source, sources.data() + e * sizeof(uint32_t), sizeof(uint32_t));
+                    std::memcpy(&edges[e].target, targets.data() + e * sizeof(uint32_t), sizeof(uint32_t));
+                    std::memcpy(&edges[e].weight, weights.data() + e * sizeof(double), sizeof(double));
+                }
+                return std::make_shared<P>(
+                    state[0].cast<int>(),
+                    std::make_shared<const pbo::Graph>(state[1].cast<size_t>(), std::move(edges)));
+            }));
+}
+
 void define_pbo_problems(py::module &m)
 {
     py::class_<PBO, Integer, std::shared_ptr<PBO>>(m, "PBO",
                                                    R"pbdoc(
-            Pseudo-Boolean Optimization (PBO) problem set, which contains 25 test functions taking
+            Pseudo-Boolean Optimization (PBO) problem set, which contains 29 test functions taking
             their domain on {0, 1}^n, where n is the length of bitstrings.
 
             In PBO, we cover some theory-motivated function, e.g., OneMax and LeadingOnes
@@ -334,81 +473,144 @@ void define_pbo_problems(py::module &m)
             {0,1}^n → [0..n], x ↦ ∑_{i=1}^n x_i.
 
         )pbdoc")
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::OneMax>());
     py::class_<pbo::LeadingOnes, Integer, std::shared_ptr<pbo::LeadingOnes>>(m, "LeadingOnes", py::is_final(),
                                                                              R"pbdoc(
             LeadingOnes:
             {0,1}^n → [0..n], x ↦ max{i∈[0..n] ∣ ∀j≤i: x_j=1}
 
         )pbdoc")
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::LeadingOnes>());
     py::class_<pbo::Linear, Integer, std::shared_ptr<pbo::Linear>>(m, "Linear", py::is_final(),
                                                                    R"pbdoc(
             A Linear Function with Harmonic Weights:
             {0,1}^n → ℝ, x ↦ ∑_i i * x_i
 
         )pbdoc")
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::Linear>());
     py::class_<pbo::OneMaxDummy1, Integer, std::shared_ptr<pbo::OneMaxDummy1>>(m, "OneMaxDummy1", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::OneMaxDummy1>());
     py::class_<pbo::OneMaxDummy2, Integer, std::shared_ptr<pbo::OneMaxDummy2>>(m, "OneMaxDummy2", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::OneMaxDummy2>());
     py::class_<pbo::OneMaxNeutrality, Integer, std::shared_ptr<pbo::OneMaxNeutrality>>(m, "OneMaxNeutrality",
                                                                                        py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::OneMaxNeutrality>());
     py::class_<pbo::OneMaxEpistasis, Integer, std::shared_ptr<pbo::OneMaxEpistasis>>(m, "OneMaxEpistasis",
                                                                                      py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::OneMaxEpistasis>());
     py::class_<pbo::OneMaxRuggedness1, Integer, std::shared_ptr<pbo::OneMaxRuggedness1>>(m, "OneMaxRuggedness1",
                                                                                          py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::OneMaxRuggedness1>());
     py::class_<pbo::OneMaxRuggedness2, Integer, std::shared_ptr<pbo::OneMaxRuggedness2>>(m, "OneMaxRuggedness2",
                                                                                          py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::OneMaxRuggedness2>());
     py::class_<pbo::OneMaxRuggedness3, Integer, std::shared_ptr<pbo::OneMaxRuggedness3>>(m, "OneMaxRuggedness3",
                                                                                          py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::OneMaxRuggedness3>());
     py::class_<pbo::LeadingOnesDummy1, Integer, std::shared_ptr<pbo::LeadingOnesDummy1>>(m, "LeadingOnesDummy1",
                                                                                          py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::LeadingOnesDummy1>());
     py::class_<pbo::LeadingOnesDummy2, Integer, std::shared_ptr<pbo::LeadingOnesDummy2>>(m, "LeadingOnesDummy2",
                                                                                          py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::LeadingOnesDummy2>());
     py::class_<pbo::LeadingOnesNeutrality, Integer, std::shared_ptr<pbo::LeadingOnesNeutrality>>(
         m, "LeadingOnesNeutrality", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::LeadingOnesNeutrality>());
     py::class_<pbo::LeadingOnesEpistasis, Integer, std::shared_ptr<pbo::LeadingOnesEpistasis>>(
         m, "LeadingOnesEpistasis", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::LeadingOnesEpistasis>());
     py::class_<pbo::LeadingOnesRuggedness1, Integer, std::shared_ptr<pbo::LeadingOnesRuggedness1>>(
         m, "LeadingOnesRuggedness1", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::LeadingOnesRuggedness1>());
     py::class_<pbo::LeadingOnesRuggedness2, Integer, std::shared_ptr<pbo::LeadingOnesRuggedness2>>(
         m, "LeadingOnesRuggedness2", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::LeadingOnesRuggedness2>());
     py::class_<pbo::LeadingOnesRuggedness3, Integer, std::shared_ptr<pbo::LeadingOnesRuggedness3>>(
         m, "LeadingOnesRuggedness3", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::LeadingOnesRuggedness3>());
     py::class_<pbo::LABS, Integer, std::shared_ptr<pbo::LABS>>(m, "LABS", py::is_final(),
                                                                R"pbdoc(
             Low Autocorrelation Binary Sequences (LABS):
             x ↦ n^2 / 2∑_{k=1}^{n-1}(∑_{i=1}^{n−k}s_is_{i+k})^2, where s_i = 2x_i − 1
 
         )pbdoc")
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::LABS>());
     py::class_<pbo::IsingRing, Integer, std::shared_ptr<pbo::IsingRing>>(m, "IsingRing", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::IsingRing>());
     py::class_<pbo::IsingTorus, Integer, std::shared_ptr<pbo::IsingTorus>>(m, "IsingTorus", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::IsingTorus>());
     py::class_<pbo::IsingTriangular, Integer, std::shared_ptr<pbo::IsingTriangular>>(m, "IsingTriangular",
                                                                                      py::is_final())
-        .def(py::init<int, int>());
-    py::class_<pbo::MIS, Integer, std::shared_ptr<pbo::MIS>>(m, "MIS", py::is_final()).def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::IsingTriangular>());
+    py::class_<pbo::MIS, Integer, std::shared_ptr<pbo::MIS>>(m, "MIS", py::is_final()).def(py::init<int, int>())
+        .def(pickle_problem<pbo::MIS>());
     py::class_<pbo::NQueens, Integer, std::shared_ptr<pbo::NQueens>>(m, "NQueens", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::NQueens>());
     py::class_<pbo::ConcatenatedTrap, Integer, std::shared_ptr<pbo::ConcatenatedTrap>>(m, "ConcatenatedTrap",
                                                                                        py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<pbo::ConcatenatedTrap>());
+
+    py::class_<pbo::Graph, std::shared_ptr<pbo::Graph>>(m, "Graph",
+                                                        R"pbdoc(
+            An undirected weighted graph, in compressed sparse row form, for the graph problems.
+
+            Parameters
+            ----------
+                n_vertices: the number of vertices
+                edges: the edges, as (source, target, weight) tuples
+        )pbdoc")
+        .def(py::init([](const size_t n_vertices, const std::vector<std::tuple<uint32_t, uint32_t, double>> &edges) {
+                 std::vector<pbo::Graph::Edge> graph_edges;
+                 for (const auto &[source, target, weight] : edges)
+                     graph_edges.push_back({source, target, weight});
+                 return pbo::Graph(n_vertices, std::move(graph_edges));
+             }),
+             py::arg("n_vertices"), py::arg("edges"))
+        .def_static(
+            "from_file",
+            [](const std::string &path, const size_t n_vertices) { return pbo::Graph::from_file(path, n_vertices); },
+            py::arg("path"), py::arg("n_vertices") = 0,
+            "Load an edge list, with a 'source target [weight]' line per edge, and # or % comment lines.")
+        .def_static("random", &pbo::Graph::random, py::arg("n_vertices"), py::arg("degree"), py::arg("seed"),
+                    py::arg("random_signs") = false,
+                    "A random graph, each vertex being linked to degree / 2 random other vertices.")
+        .def("__len__", &pbo::Graph::size)
+        .def_property_readonly("n_edges", &pbo::Graph::n_edges)
+        .def("degree", &pbo::Graph::degree, py::arg("vertex"))
+        .def_property_readonly("sources", &pbo::Graph::sources)
+        .def_property_readonly("targets", &pbo::Graph::targets)
+        .def_property_readonly("weights", &pbo::Graph::weights);
+
+    define_graph_problem<pbo::IsingSpinGlass>(m, "IsingSpinGlass",
+                                              "Ising spin glass: x ↦ ∑_{(u,v)∈E} w_uv s_u s_v, where s_i = 2x_i − 1");
+    define_graph_problem<pbo::MaxCut>(m, "MaxCut", "Max-Cut: x ↦ ∑_{(u,v)∈E} w_uv [x_u ≠ x_v]");
+    define_graph_problem<pbo::MaxIndependentSet>(
+        m, "MaxIndependentSet", "Maximum independent set: x ↦ ∑_v x_v − n ∑_{(u,v)∈E} x_u x_v");
+    define_graph_problem<pbo::VertexCover>(
+        m, "VertexCover", "Minimum vertex cover: x ↦ −∑_v x_v − n ∑_{(u,v)∈E} (1 − x_u)(1 − x_v)");
 }
 
 void define_bbob_problems(py::module &m)
@@ -441,61 +643,114 @@ void define_bbob_problems(py::module &m)
 
         )pbdoc");
     py::class_<bbob::Sphere, Real, std::shared_ptr<bbob::Sphere>>(m, "Sphere", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Sphere>());
     py::class_<bbob::Ellipsoid, Real, std::shared_ptr<bbob::Ellipsoid>>(m, "Ellipsoid", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Ellipsoid>());
     py::class_<bbob::Rastrigin, Real, std::shared_ptr<bbob::Rastrigin>>(m, "Rastrigin", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Rastrigin>());
     py::class_<bbob::BuecheRastrigin, Real, std::shared_ptr<bbob::BuecheRastrigin>>(m, "BuecheRastrigin",
                                                                                     py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::BuecheRastrigin>());
     py::class_<bbob::LinearSlope, Real, std::shared_ptr<bbob::LinearSlope>>(m, "LinearSlope", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::LinearSlope>());
     py::class_<bbob::AttractiveSector, Real, std::shared_ptr<bbob::AttractiveSector>>(m, "AttractiveSector",
                                                                                       py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::AttractiveSector>());
     py::class_<bbob::StepEllipsoid, Real, std::shared_ptr<bbob::StepEllipsoid>>(m, "StepEllipsoid", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::StepEllipsoid>());
     py::class_<bbob::Rosenbrock, Real, std::shared_ptr<bbob::Rosenbrock>>(m, "Rosenbrock", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Rosenbrock>());
     py::class_<bbob::RosenbrockRotated, Real, std::shared_ptr<bbob::RosenbrockRotated>>(m, "RosenbrockRotated",
                                                                                         py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::RosenbrockRotated>());
     py::class_<bbob::EllipsoidRotated, Real, std::shared_ptr<bbob::EllipsoidRotated>>(m, "EllipsoidRotated",
                                                                                       py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::EllipsoidRotated>());
     py::class_<bbob::Discus, Real, std::shared_ptr<bbob::Discus>>(m, "Discus", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Discus>());
     py::class_<bbob::BentCigar, Real, std::shared_ptr<bbob::BentCigar>>(m, "BentCigar", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::BentCigar>());
     py::class_<bbob::SharpRidge, Real, std::shared_ptr<bbob::SharpRidge>>(m, "SharpRidge", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::SharpRidge>());
     py::class_<bbob::DifferentPowers, Real, std::shared_ptr<bbob::DifferentPowers>>(m, "DifferentPowers",
                                                                                     py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::DifferentPowers>());
     py::class_<bbob::RastriginRotated, Real, std::shared_ptr<bbob::RastriginRotated>>(m, "RastriginRotated",
                                                                                       py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::RastriginRotated>());
     py::class_<bbob::Weierstrass, Real, std::shared_ptr<bbob::Weierstrass>>(m, "Weierstrass", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Weierstrass>());
     py::class_<bbob::Schaffers10, Real, std::shared_ptr<bbob::Schaffers10>>(m, "Schaffers10", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Schaffers10>());
     py::class_<bbob::Schaffers1000, Real, std::shared_ptr<bbob::Schaffers1000>>(m, "Schaffers1000", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Schaffers1000>());
     py::class_<bbob::GriewankRosenBrock, Real, std::shared_ptr<bbob::GriewankRosenBrock>>(m, "GriewankRosenBrock",
                                                                                           py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::GriewankRosenBrock>());
     py::class_<bbob::Schwefel, Real, std::shared_ptr<bbob::Schwefel>>(m, "Schwefel", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Schwefel>());
     py::class_<bbob::Gallagher101, Real, std::shared_ptr<bbob::Gallagher101>>(m, "Gallagher101", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Gallagher101>());
     py::class_<bbob::Gallagher21, Real, std::shared_ptr<bbob::Gallagher21>>(m, "Gallagher21", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Gallagher21>());
     py::class_<bbob::Katsuura, Real, std::shared_ptr<bbob::Katsuura>>(m, "Katsuura", py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::Katsuura>());
     py::class_<bbob::LunacekBiRastrigin, Real, std::shared_ptr<bbob::LunacekBiRastrigin>>(m, "LunacekBiRastrigin",
                                                                                           py::is_final())
-        .def(py::init<int, int>());
+        .def(py::init<int, int>())
+        .def(pickle_problem<bbob::LunacekBiRastrigin>());
+
+    py::class_<bbob::SharedRotations, std::shared_ptr<bbob::SharedRotations>>(m, "SharedRotations",
+                                                                              R"pbdoc(
+            A POSIX shared memory segment holding the rotations of BBOB problems, the part of their construction
+            which takes O(n^3), and the peaks of the Gallagher problems. The problems pickled while the segment is
+            open only carry its name, and the processes unpickling them map the segment once, so that the workers
+            of a pool all read the instances from one read-only copy, without computing them. The segment is
+            removed by close or at the end of a with block, and stays mapped in the processes using it.
+
+            Parameters
+            ----------
+                name: the name of the segment
+                problems: the BBOB problems
+        )pbdoc")
+        .def(py::init([](const std::string &name, const std::vector<std::shared_ptr<BBOB>> &problems) {
+                 std::vector<std::shared_ptr<const bbob::Rotations>> rotations;
+                 for (const auto &p : problems)
+                     rotations.push_back(p->rotations());
+                 return std::make_shared<bbob::SharedRotations>(name, rotations);
+             }),
+             py::arg("name"), py::arg("problems"))
+        .def("close", &bbob::SharedRotations::close, "Remove the segment.")
+        .def("__enter__", [](std::shared_ptr<bbob::SharedRotations> s) { return s; })
+        .def("__exit__", [](bbob::SharedRotations &s, const py::args &) { s.close(); })
+        .def("__len__", &bbob::SharedRotations::size)
+        .def_property_readonly("name", &bbob::SharedRotations::name)
+        .def_static(
+            "attach", [](const std::string &name) { bbob::RotationCache::instance().attach(name); },
+            py::arg("name"), "Map the rotations of a segment, e.g. in the initializer of the workers of a pool.");
 }
 
 void define_problem_bases(py::module &m)
@@ -504,6 +759,8 @@ void define_problem_bases(py::module &m)
     define_base_class<Integer, int>(m, "Integer");
     define_wrapper_functions<double>(m, "RealWrappedProblem", "wrap_real_problem");
     define_wrapper_functions<int>(m, "IntegerWrappedProblem", "wrap_integer_problem");
+    define_instances<double>(m, "RealInstances");
+    define_instances<int>(m, "IntegerInstances");
 }
 
 class WModelTrampoline : public WModel
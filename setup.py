@@ -49,6 +49,7 @@ class CMakeBuild(build_ext):
                 -m ioh.iohcpp.problem \
                 -m ioh.iohcpp.logger \
                 -m ioh.iohcpp.suite \
+                -m ioh.iohcpp.landscape \
                 -m ioh.iohcpp.logger.trigger \
                 -m ioh.iohcpp.logger.property \
                 -o ./"""
@@ -168,9 +169,12 @@ setup(
         "ioh/iohcpp/__init__.pyi",
         "ioh/iohcpp/problem.pyi",
         "ioh/iohcpp/suite.pyi",
+        "ioh/iohcpp/landscape.pyi",
         "ioh/iohcpp/logger/__init__.pyi",
         "ioh/iohcpp/logger/property.pyi",
-        "ioh/iohcpp/logger/trigger.pyi"
+        "ioh/iohcpp/logger/trigger.pyi",
+        "ioh/iohcpp/logger/archive.pyi",
+        "ioh/iohcpp/logger/trace.pyi"
     ]},
     ext_modules=[iohcpp],
     cmdclass={"build_ext": CMakeBuild},
@@ -0,0 +1,19 @@
+/** The ioh::ioh_compiled library: the explicit instantiations listed in ioh/instantiations.hpp, and the kernels
+ * of ioh/common/kernels.hpp, compiled for each target CPU.
+ *
+ * Built with the CMake option BUILD_COMPILED_LIBRARY.
+ */
+#include "ioh.hpp"
+
+IOH_INSTANTIATIONS(IOH_INSTANTIATE_TEMPLATE)
+
+bool ioh::common::link_registrations() { return true; }
+
+namespace ioh::common::kernels
+{
+    IOH_TARGET_CLONES void accumulate_columns(const double *columns, const double *d, double *z, const size_t n,
+                                              const size_t size)
+    {
+        detail::accumulate_columns(columns, d, z, n, size);
+    }
+} // namespace ioh::common::kernels
@@ -0,0 +1,122 @@
+#include "../utils.hpp"
+
+#include "ioh/landscape.hpp"
+#include "ioh/problem/bbob.hpp"
+#include "ioh/problem/pbo.hpp"
+#include "ioh/problem/wmodel.hpp"
+
+using namespace ioh::landscape;
+
+TEST_F(BaseTest, landscape_samplers)
+{
+    // The first points of the 3 dimensional Sobol sequence.
+    const sampler::Sobol sobol(3);
+    const std::vector<std::vector<double>> expected = {
+        {0, 0, 0}, {0.5, 0.5, 0.5}, {0.75, 0.25, 0.25}, {0.25, 0.75, 0.75}, {0.375, 0.375, 0.625}};
+    for (size_t i = 0; i < expected.size(); ++i)
+        EXPECT_EQ(sobol(i), expected[i]);
+    EXPECT_THROW(sampler::Sobol(1025), std::invalid_argument);
+
+    const sampler::LatinHypercube lhs(4, 50, 7);
+    for (size_t j = 0; j < 4; ++j)
+    {
+        std::vector<bool> strata(50);
+        for (size_t i = 0; i < 50; ++i)
+            strata[static_cast<size_t>(lhs(i)[j] * 50)] = true;
+        EXPECT_TRUE(std::all_of(strata.begin(), strata.end(), [](const bool s) { return s; }));
+    }
+    EXPECT_THROW(lhs(50), std::out_of_range);
+
+    const sampler::Uniform uniform(2, 3);
+    EXPECT_EQ(uniform(10), uniform(10));
+    EXPECT_NE(uniform(10), sampler::Uniform(2, 4)(10));
+}
+
+TEST_F(BaseTest, landscape_moments_merge)
+{
+    const auto values = ioh::common::random::pbo::normal(1000, 5);
+    Moments all, first, second;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        all.add(values[i] * values[i]);
+        (i < 300 ? first : second).add(values[i] * values[i]);
+    }
+    first.merge(second);
+    EXPECT_EQ(first.n, all.n);
+    EXPECT_NEAR(first.mean, all.mean, 1e-12);
+    EXPECT_NEAR(first.variance(), all.variance(), 1e-10);
+    EXPECT_NEAR(first.skewness(), all.skewness(), 1e-10);
+    EXPECT_NEAR(first.kurtosis(), all.kurtosis(), 1e-10);
+    EXPECT_EQ(first.min, all.min);
+    EXPECT_EQ(first.max, all.max);
+}
+
+TEST_F(BaseTest, landscape_analyze)
+{
+    ioh::problem::bbob::Sphere sphere(1, 5);
+    const sampler::Sobol sobol(5, 3);
+    const auto one = analyze(sphere, sobol, 4096, {1, 500});
+    const auto four = analyze(sphere, sobol, 4096, {4, 500});
+    EXPECT_EQ(sphere.state().evaluations, 2 * 4096);
+
+    EXPECT_EQ(one.features.samples, 4096);
+    EXPECT_GT(one.features.fdc, 0.9);
+    EXPECT_LT(one.features.dispersion, 0.8);
+    EXPECT_NEAR(one.features.y.mean, four.features.y.mean, 1e-9);
+    EXPECT_NEAR(one.features.fdc, four.features.fdc, 1e-9);
+    EXPECT_EQ(one.features.dispersion, four.features.dispersion);
+    EXPECT_EQ(one.nearest_better, four.nearest_better);
+    EXPECT_EQ(one.points.size(), 500);
+    EXPECT_EQ(std::count(one.nearest_better.begin(), one.nearest_better.end(), -1), 1);
+
+    ioh::problem::pbo::OneMax one_max(1, 32);
+    const auto features = analyze(one_max, sampler::Uniform(32), 2000, {2}).features;
+    EXPECT_LT(features.fdc, -0.9);
+    EXPECT_NEAR(features.y.mean, 16, 0.5);
+    EXPECT_GE(features.y.min, 0);
+    EXPECT_LE(features.y.max, 32);
+
+    EXPECT_THROW(analyze(sphere, sampler::Uniform(4), 10), std::invalid_argument);
+}
+
+TEST_F(BaseTest, landscape_enumeration)
+{
+    using namespace ioh::problem;
+    const auto &factory = ProblemRegistry<Integer>::instance();
+    const std::vector<std::pair<std::string, int>> problems = {
+        {"OneMax", 10}, {"Linear", 10}, {"LeadingOnes", 9}, {"IsingRing", 10}, {"IsingTorus", 9},
+        {"IsingTorus", 16}, {"IsingTriangular", 9}, {"MIS", 10}, {"LABS", 8}};
+    for (const auto &[name, n] : problems)
+        for (const auto instance : {1, 7, 60})
+        {
+            const auto problem = factory.create(name, instance, n);
+            const Enumeration<double> enumeration(*problem, 3);
+            EXPECT_TRUE(enumeration.delta());
+            for (size_t x = 0; x < enumeration.values().size(); ++x)
+                ASSERT_DOUBLE_EQ(enumeration.values()[x], (*problem)(enumeration.solution(x)))
+                    << name << " " << instance << " " << x;
+        }
+
+    // The W-model is not a PBO problem, and is evaluated in full.
+    wmodel::WModelOneMax w_model(1, 8, 0.5);
+    const Enumeration<double> full(w_model, 2);
+    EXPECT_FALSE(full.delta());
+    EXPECT_DOUBLE_EQ(full({1, 0, 1, 1, 0, 0, 1, 1}), w_model({1, 0, 1, 1, 0, 0, 1, 1}));
+
+    pbo::OneMax one_max(5, 12);
+    const Enumeration<> enumeration(one_max);
+    EXPECT_EQ(one_max.state().evaluations, 0);
+    const auto optimum = Enumeration<>::index(one_max.objective().x);
+    EXPECT_EQ(enumeration.local_optima(), std::vector<uint32_t>{static_cast<uint32_t>(optimum)});
+    const auto basins = enumeration.basins();
+    EXPECT_EQ(basins.sizes, std::vector<size_t>{4096});
+    EXPECT_FLOAT_EQ(basins.values.at(basins.global), static_cast<float>(one_max.objective().y));
+
+    pbo::IsingRing ising(1, 10);
+    const auto ising_basins = Enumeration<>(ising, 2).basins();
+    EXPECT_EQ(std::accumulate(ising_basins.sizes.begin(), ising_basins.sizes.end(), size_t{0}), 1024);
+    EXPECT_EQ(ising_basins.optima, Enumeration<>(ising, 1).local_optima());
+    EXPECT_FLOAT_EQ(ising_basins.values.at(ising_basins.global), 10);
+    pbo::OneMax large(1, 40);
+    EXPECT_THROW(Enumeration<>(large, 1), std::invalid_argument);
+}
@@ -128,4 +128,103 @@ TEST_F(BaseTest, logger_v2)
     EXPECT_TRUE(fs::exists(output_directory / "data_f1_Sphere" / "IOHprofiler_f1_DIM5.dat"));
     EXPECT_TRUE(fs::remove_all(output_directory));
     EXPECT_TRUE(!fs::exists(output_directory));
-}
\ No newline at end of file
+}
+TEST_F(BaseTest, logger_last_evaluation)
+{
+    using namespace ioh;
+    auto p = problem::bbob::Sphere(1, 2);
+    fs::path output_directory;
+    {
+        logger::Analyzer l({trigger::each(3)}, {watch::evaluations});
+        output_directory = l.output_directory();
+        p.attach_logger(l);
+        for (auto s = 1; s <= 5; ++s)
+        {
+            p(common::random::pbo::uniform(2, s));
+            // The Analyzer skips the evaluations no trigger fires at, the problem hands over the last one.
+            EXPECT_GT(l.next_evaluation(), static_cast<size_t>(s));
+        }
+        p.reset();
+    }
+    // The last evaluation is written even though no trigger fired.
+    const auto data = get_file_as_string(get_dat_path(output_directory, p));
+    EXPECT_EQ(std::count(data.begin(), data.end(), '\n'), 3);
+    EXPECT_EQ(data.find("\n3 "), data.find('\n'));
+    EXPECT_NE(data.find("\n5 "), std::string::npos);
+
+    fs::remove_all(output_directory);
+}
+
+TEST_F(BaseTest, logger_many_runs)
+{
+    using namespace ioh;
+    auto p = problem::bbob::Sphere(1, 2);
+    fs::path output_directory;
+    const auto info_file = fmt::format("IOHprofiler_f{:d}_{}.info", p.meta_data().problem_id, p.meta_data().name);
+    {
+        logger::Analyzer l({trigger::on_improvement}, {watch::evaluations});
+        output_directory = l.output_directory();
+        p.attach_logger(l);
+        const auto info_size = fs::file_size(output_directory / info_file);
+        for (auto r = 0; r < 1000; ++r)
+        {
+            for (auto s = 0; s < 5; ++s)
+                p(common::random::pbo::uniform(2, 10 * r + s, -5, 5));
+            p.reset();
+            // New runs of the same problem do not touch the files (until the buffers are full).
+            EXPECT_EQ(fs::file_size(output_directory / info_file), info_size);
+            if (r < 10)
+            {
+                EXPECT_EQ(fs::file_size(get_dat_path(output_directory, p)), 0);
+            }
+        }
+    }
+    const auto info = get_file_as_string(output_directory / info_file);
+    EXPECT_EQ(std::count(info.begin(), info.end(), '|'), 1000);
+    EXPECT_EQ(info.find(", 1:"), info.rfind(".dat") + 4);
+
+    const auto data = get_file_as_string(get_dat_path(output_directory, p));
+    size_t headers = 0;
+    for (auto pos = data.find("\"function evaluation\""); pos != std::string::npos;
+         pos = data.find("\"function evaluation\"", pos + 1))
+        ++headers;
+    EXPECT_EQ(headers, 1000);
+    EXPECT_EQ(data.find("1 "), data.find('\n') + 1);
+
+    fs::remove_all(output_directory);
+}
+
+TEST_F(BaseTest, logger_analyzer_last_evaluation_without_reset)
+{
+    using namespace ioh;
+    fs::path output_directory;
+    std::vector<fs::path> dat_paths;
+    {
+        logger::Analyzer logger({trigger::on_improvement}, {}, fs::current_path(), "ioh_last_evaluation", "a", "b",
+                                true);
+        output_directory = logger.output_directory();
+        for (const int id : {1, 6})
+        {
+            // Neither run is reset, and the problems do not outlive them.
+            const auto p = problem::ProblemRegistry<problem::Real>::instance().create(id, 1, 2);
+            dat_paths.push_back(get_dat_path(output_directory, *p));
+            p->attach_logger(logger);
+            (*p)(p->objective().x);
+            (*p)({4.0, 4.0});
+            (*p)({-4.0, 4.0});
+            // The evaluations which do not improve are skipped, the problem hands over the last one.
+            EXPECT_FALSE(logger.is_due(4, false));
+        }
+        logger.close();
+    }
+    for (const auto &dat : dat_paths)
+    {
+        const auto content = get_file_as_string(dat);
+        const auto end = content.find_last_not_of("\r\n") + 1;
+        const auto start = content.rfind('\n', end - 1) + 1;
+        const auto line = content.substr(start, end - start);
+        EXPECT_EQ(line.substr(0, 2), "3 ") << dat;
+        EXPECT_EQ(line.substr(line.size() - 5), " -4 4") << dat;
+    }
+    fs::remove_all(output_directory);
+}
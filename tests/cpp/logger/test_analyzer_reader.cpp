@@ -0,0 +1,126 @@
+#include "../utils.hpp"
+
+#include "ioh/logger/analyzer_reader.hpp"
+#include "ioh/logger/combine.hpp"
+#include "ioh/logger/eaf.hpp"
+#include "ioh/suite.hpp"
+
+using namespace ioh;
+
+TEST_F(BaseTest, analyzer_reader)
+{
+    logger::EAF eaf;
+    fs::path root;
+    double budget = 0;
+    {
+        logger::Analyzer analyzer({trigger::on_improvement}, {}, fs::current_path(), "reader_data", "rs",
+                                  "random, search", true);
+        analyzer.add_experiment_attribute("seed", "7");
+        analyzer.add_run_attribute("budget", &budget);
+        root = analyzer.output_directory();
+
+        logger::Combine both({analyzer, eaf});
+        suite::BBOB suite({1, 2}, {1, 2}, {2, 3});
+        suite.attach_logger(both);
+        for (const auto &pb : suite)
+        {
+            for (int r = 0; r < 2; ++r)
+            {
+                budget = 30. + r;
+                for (int s = 0; s < 30 + r; ++s)
+                    (*pb)(common::random::pbo::uniform(pb->meta_data().n_variables, 100 * r + s, -5, 5));
+                pb->reset();
+            }
+        }
+    }
+
+    const logger::analyzer::v1::Reader reader(root);
+    ASSERT_EQ(reader.experiments().size(), 2);
+    ASSERT_EQ(reader.data_files().size(), 4);
+    const auto &sphere = reader.experiments().front();
+    EXPECT_EQ(sphere.suite, "BBOB");
+    EXPECT_EQ(sphere.problem.problem_id, 1);
+    EXPECT_EQ(sphere.problem.name, "Sphere");
+    EXPECT_EQ(sphere.problem.optimization_type, common::OptimizationType::Minimization);
+    EXPECT_EQ(sphere.algorithm.info, "random, search");
+    ASSERT_EQ(sphere.attributes.size(), 1);
+    EXPECT_EQ(sphere.attributes.front().value, "7");
+    ASSERT_EQ(sphere.dims.size(), 2);
+    EXPECT_EQ(sphere.dims.back().dimension, 3);
+    ASSERT_EQ(sphere.dims.front().runs.size(), 4);
+    const auto &run = sphere.dims.front().runs.back();
+    EXPECT_EQ(run.instance, 2);
+    ASSERT_EQ(run.attributes.size(), 1);
+    EXPECT_EQ(run.attributes.front().value, 31.);
+
+    // Columnar view, the runs of a file being concatenated.
+    const auto tables = reader.tables(2);
+    ASSERT_EQ(tables.size(), 4);
+    const auto &table = tables.front();
+    EXPECT_EQ(table.nb_runs(), 4);
+    EXPECT_EQ(table.names.size(), 5 + 2);
+    EXPECT_EQ(table.names.back(), "x1");
+    const auto &evals = table.column("function evaluation");
+    const auto last = reader.location(0, 0, 3);
+    EXPECT_EQ(evals[table.run_starts[last.run + 1] - 1], 31.);
+    EXPECT_THROW((void)table.column("nope"), std::out_of_range);
+
+    // Replaying the data gives the same fronts, up to the printed precision.
+    logger::EAF replayed;
+    reader.replay(replayed);
+    EXPECT_EQ(replayed.data().size(), eaf.data().size());
+    for (const auto &[suite, problems] : eaf.data())
+        for (const auto &[pb, dims] : problems)
+            for (const auto &[dim, instances] : dims)
+                for (const auto &[ins, runs] : instances)
+                    for (const auto &[r, front] : runs)
+                    {
+                        const auto &other = replayed.data(logger::EAF::Cursor(suite, pb, dim, ins, r));
+                        ASSERT_EQ(front.size(), other.size());
+                        for (size_t i = 0; i < front.size(); ++i)
+                        {
+                            EXPECT_EQ(front[i].time, other[i].time);
+                            EXPECT_NEAR(front[i].qual, other[i].qual, 1e-5);
+                        }
+                    }
+
+    // Malformed data.
+    {
+        std::ofstream out(reader.data_files().back(), std::ios::app);
+        out << "\n1 2 3\n";
+    }
+    EXPECT_THROW(reader.table(3), std::runtime_error);
+    fs::remove_all(root);
+}
+
+TEST_F(BaseTest, analyzer_reader_replay_analyzer)
+{
+    // Replaying consecutive runs of a problem into an Analyzer writes the same files.
+    fs::path root, replayed_root;
+    {
+        logger::Analyzer analyzer({trigger::always}, {}, fs::current_path(), "reader_source");
+        root = analyzer.output_directory();
+        problem::bbob::Sphere sphere(1, 2);
+        sphere.attach_logger(analyzer);
+        for (int r = 0; r < 2; ++r)
+        {
+            for (int s = 0; s < 20; ++s)
+                sphere(common::random::pbo::uniform(2, 20 * r + s, -5, 5));
+            sphere.reset();
+        }
+    }
+    {
+        const logger::analyzer::v1::Reader reader(root);
+        logger::Analyzer analyzer({trigger::always}, {}, fs::current_path(), "reader_replayed");
+        replayed_root = analyzer.output_directory();
+        reader.replay(analyzer);
+        analyzer.close();
+    }
+    const fs::path info = "IOHprofiler_f1_Sphere.info", dat = fs::path("data_f1_Sphere") / "IOHprofiler_f1_DIM2.dat";
+    const auto expected = get_file_as_string(root / info);
+    EXPECT_EQ(std::count(expected.begin(), expected.end(), '|'), 2);
+    EXPECT_EQ(get_file_as_string(replayed_root / info), expected);
+    EXPECT_EQ(get_file_as_string(replayed_root / dat), get_file_as_string(root / dat));
+    fs::remove_all(root);
+    fs::remove_all(replayed_root);
+}
@@ -0,0 +1,148 @@
+#include "../utils.hpp"
+
+#include "ioh/logger/archive.hpp"
+#include "ioh/suite.hpp"
+
+using namespace ioh;
+
+namespace
+{
+    //! Run a few random searches on a small BBOB suite.
+    void campaign(Logger &logger, const size_t nb_runs, const long seed)
+    {
+        suite::BBOB suite({1, 2}, {1, 2}, {2, 5});
+        suite.attach_logger(logger);
+        for (const auto &pb : suite)
+        {
+            for (size_t r = 0; r < nb_runs; ++r)
+            {
+                for (long s = 0; s < 50; ++s)
+                    (*pb)(common::random::pbo::uniform(pb->meta_data().n_variables, seed + s, -5, 5));
+                pb->reset();
+            }
+        }
+    }
+
+    //! Compare two fronts.
+    void expect_same(const logger::eaf::Front &a, const logger::eaf::Front &b)
+    {
+        ASSERT_EQ(a.size(), b.size());
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            EXPECT_EQ(a[i].qual, b[i].qual);
+            EXPECT_EQ(a[i].time, b[i].time);
+            EXPECT_EQ(a[i].run, b[i].run);
+        }
+    }
+} // namespace
+
+TEST_F(BaseTest, archive_eaf)
+{
+    logger::EAF eaf;
+    campaign(eaf, 2, 0);
+    logger::archive::save("eaf.ioh", eaf);
+
+    const logger::archive::Reader reader("eaf.ioh");
+    EXPECT_EQ(reader.kind(), logger::archive::Kind::EAF);
+    EXPECT_EQ(reader.format_version(), logger::archive::version);
+    EXPECT_EQ(reader.entries().size(), 2 * 2 * 2 * 2);
+    EXPECT_EQ(reader.optimization_type(), common::OptimizationType::Minimization);
+    EXPECT_THROW(reader.matrix(reader.entries().front()), std::runtime_error);
+
+    // Lazy access to a single run.
+    const auto &entry = reader.entries().back();
+    expect_same(reader.front(entry),
+                eaf.data(logger::EAF::Cursor(entry.key.suite, entry.key.problem, entry.key.dimension,
+                                             entry.key.instance, entry.key.run)));
+
+    // Merge the runs of two "processes", renumbering the runs of the second one.
+    logger::EAF other;
+    campaign(other, 2, 100);
+    logger::archive::save("other.ioh", other);
+
+    logger::EAF merged;
+    logger::archive::load("eaf.ioh", merged);
+    logger::archive::load("other.ioh", merged);
+    const auto &runs = merged.data().at("BBOB").at(2).at(5).at(1);
+    ASSERT_EQ(runs.size(), 4);
+    expect_same(runs.at(1), eaf.data().at("BBOB").at(2).at(5).at(1).at(1));
+    const auto &renumbered = runs.at(3);
+    ASSERT_EQ(renumbered.size(), other.data().at("BBOB").at(2).at(5).at(1).at(1).size());
+    for (const auto &p : renumbered)
+        EXPECT_EQ(p.run, 3);
+
+    const auto levels = logger::eaf::levels(merged.optimization_type(), merged);
+    EXPECT_EQ(levels.size(), 2 * 2 * 2 * 4);
+
+    // Fronts of maximized problems cannot be mixed with them.
+    EXPECT_THROW(merged.merge(other.data(), common::OptimizationType::Maximization), std::invalid_argument);
+    EXPECT_EQ(merged.data().at("BBOB").at(2).at(5).at(1).size(), 4);
+
+    fs::remove("eaf.ioh");
+    fs::remove("other.ioh");
+}
+
+TEST_F(BaseTest, archive_eah)
+{
+    logger::EAH eah(0, 6e7, 20, 0, 50, 10);
+    campaign(eah, 3, 0);
+    logger::archive::save("eah.ioh", eah);
+
+    logger::EAH loaded(0, 6e7, 20, 0, 50, 10);
+    logger::archive::load("eah.ioh", loaded);
+    EXPECT_EQ(loaded.data(), eah.data());
+
+    logger::archive::load("eah.ioh", loaded);
+    EXPECT_EQ(loaded.data().at(1).at(2).at(1).size(), 6);
+    EXPECT_EQ(loaded.data().at(1).at(2).at(1).at(6), eah.data().at(1).at(2).at(1).at(3));
+
+    logger::eah::stat::Histogram histo;
+    histo(loaded);
+    EXPECT_EQ(histo.nb_attainments(), 2 * eah.data().size() * 2 * 2 * 3);
+
+    logger::EAH other_scales(0, 6e7, 20, 0, 100, 10);
+    EXPECT_THROW(logger::archive::load("eah.ioh", other_scales), std::invalid_argument);
+
+    // Scales of another kind over the same domain have other buckets.
+    logger::eah::LinearScale<double> linear_errors(0, 6e7, 20);
+    logger::eah::Log10Scale<size_t> evaluations(0, 50, 10);
+    logger::EAH other_kind(linear_errors, evaluations);
+    EXPECT_EQ(logger::archive::Reader("eah.ioh").scales().first.kind, logger::archive::ScaleKind::Log10);
+    EXPECT_THROW(logger::archive::load("eah.ioh", other_kind), std::invalid_argument);
+    fs::remove("eah.ioh");
+}
+
+TEST_F(BaseTest, archive_store)
+{
+    logger::Store store({trigger::on_improvement}, {watch::evaluations, watch::transformed_y_best, watch::current_y});
+    campaign(store, 2, 0);
+    logger::archive::save("store.ioh", store.data());
+
+    const logger::archive::Reader reader("store.ioh");
+    EXPECT_EQ(reader.kind(), logger::archive::Kind::Store);
+    EXPECT_EQ(reader.store_suites(), store.data());
+
+    logger::Store merged({trigger::always}, {watch::evaluations});
+    logger::archive::load("store.ioh", merged);
+    logger::archive::load("store.ioh", merged);
+    const auto runs = merged.data().at("BBOB").at(1).at(2).at(2);
+    ASSERT_EQ(runs.size(), 4);
+    EXPECT_EQ(runs.at(3), store.data().at("BBOB").at(1).at(2).at(2).at(1));
+
+    // Spilled runs are saved one at a time.
+    logger::Store bounded({trigger::on_improvement}, {watch::evaluations, watch::transformed_y_best, watch::current_y},
+                          256, fs::current_path());
+    campaign(bounded, 2, 0);
+    EXPECT_GT(bounded.nb_spilled(), 0);
+    logger::archive::save("bounded.ioh", bounded);
+    EXPECT_EQ(logger::archive::Reader("bounded.ioh").store_suites(), store.data());
+    fs::remove("bounded.ioh");
+
+    // Not an archive.
+    {
+        std::ofstream out("store.ioh");
+        out << "suite_name problem_id";
+    }
+    EXPECT_THROW(logger::archive::Reader("store.ioh"), std::runtime_error);
+    fs::remove("store.ioh");
+}
@@ -0,0 +1,89 @@
+#include "../utils.hpp"
+
+#include "ioh/common/gzip.hpp"
+#include "ioh/logger/analyzer_reader.hpp"
+#include "ioh/logger/combine.hpp"
+#include "ioh/suite.hpp"
+
+using namespace ioh;
+
+#ifdef IOH_HAS_ZLIB
+
+TEST_F(BaseTest, compressed_flatfile)
+{
+    trigger::Always always;
+    watch::TransformedY transformed_y;
+    fs::create_directory("compressed");
+    {
+        logger::FlatFile plain({always}, {transformed_y}, "IOH.dat", ".");
+        logger::FlatFile compressed({always}, {transformed_y}, "IOH.dat", "compressed");
+        compressed.compress(6);
+        EXPECT_EQ(compressed.file_suffix(), ".gz");
+        EXPECT_THROW(compressed.compress(10), std::invalid_argument);
+        logger::Combine both({plain, compressed});
+
+        suite::BBOB suite({1, 2}, {1}, {2, 10});
+        suite.attach_logger(both);
+        for (const auto &pb : suite)
+            for (int r = 0; r < 3; ++r)
+            {
+                for (long s = 0; s < 2000; ++s)
+                    (*pb)(common::random::pbo::uniform(pb->meta_data().n_variables, s + r, -5, 5));
+                pb->reset();
+            }
+    }
+    const auto text = get_file_as_string("IOH.dat");
+    EXPECT_EQ(common::gzip::decompress(fs::path("compressed") / "IOH.dat.gz", 3), text);
+    EXPECT_LT(fs::file_size(fs::path("compressed") / "IOH.dat.gz") * 3, text.size());
+
+    // Each run starts a member.
+    const common::file::MappedFile gz(fs::path("compressed") / "IOH.dat.gz");
+    const auto members = common::gzip::members(gz.data(), gz.size());
+    std::vector<std::string> runs;
+    for (const auto &m : members)
+        if (m.flags & common::gzip::run_start)
+            runs.push_back(common::gzip::decompress(gz.data(), m));
+        else
+            runs.back() += common::gzip::decompress(gz.data(), m);
+    ASSERT_EQ(runs.size(), 2 * 2 * 3);
+    EXPECT_EQ(runs[1].find("BBOB\tSphere\t1\t1\tmin\t2\t1"), 0);
+
+    std::string corrupted(gz.data(), gz.size());
+    corrupted[members[1].offset + common::gzip::header_size + 2] ^= 0x55;
+    EXPECT_THROW(common::gzip::decompress(corrupted.data(), members[1]), std::runtime_error);
+
+    fs::remove("IOH.dat");
+    fs::remove_all("compressed");
+}
+
+TEST_F(BaseTest, compressed_analyzer)
+{
+    fs::path root;
+    {
+        logger::Analyzer analyzer({trigger::on_improvement}, {}, fs::current_path(), "compressed_data");
+        analyzer.compress();
+        root = analyzer.output_directory();
+        suite::BBOB suite({1, 2}, {1, 2}, {2, 3});
+        suite.attach_logger(analyzer);
+        for (const auto &pb : suite)
+            for (int r = 0; r < 2; ++r)
+            {
+                for (long s = 0; s < 50; ++s)
+                    (*pb)(common::random::pbo::uniform(pb->meta_data().n_variables, s + 100 * r, -5, 5));
+                pb->reset();
+            }
+    }
+    EXPECT_TRUE(fs::exists(root / "data_f1_Sphere" / "IOHprofiler_f1_DIM2.dat.gz"));
+    EXPECT_FALSE(fs::exists(root / "data_f1_Sphere" / "IOHprofiler_f1_DIM2.dat"));
+
+    // The .info files point to the compressed files.
+    const logger::analyzer::v1::Reader reader(root);
+    EXPECT_EQ(reader.experiments().front().dims.front().data_file, "data_f1_Sphere/IOHprofiler_f1_DIM2.dat.gz");
+    const auto tables = reader.tables();
+    ASSERT_EQ(tables.size(), 4);
+    for (const auto &t : tables)
+        EXPECT_EQ(t.nb_runs(), 4);
+    fs::remove_all(root);
+}
+
+#endif
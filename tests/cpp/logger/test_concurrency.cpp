@@ -0,0 +1,118 @@
+#include <thread>
+
+#include "../utils.hpp"
+
+#include "ioh/logger/store.hpp"
+#include "ioh/problem/concurrent.hpp"
+#include "ioh/problem/bbob/sphere.hpp"
+
+using namespace ioh;
+
+namespace
+{
+    //! Log a few runs of random search on the given problem, the triggers and properties being shared globals.
+    logger::Store::Runs search(problem::bbob::Sphere &pb, const int seed)
+    {
+        logger::Store store({trigger::on_improvement, trigger::each(10)},
+                            {watch::evaluations, watch::transformed_y_best});
+        pb.attach_logger(store);
+        for (auto r = 0; r < 3; ++r)
+        {
+            for (auto s = 0; s < 200; ++s)
+                pb(common::random::pbo::uniform(pb.meta_data().n_variables, seed + s, -5, 5));
+            pb.reset();
+        }
+        pb.detach_logger();
+        return store.data().at(logger::Store::default_suite).at(1).at(10).at(pb.meta_data().instance);
+    }
+} // namespace
+
+TEST_F(BaseTest, triggers_cloned_per_logger)
+{
+    problem::bbob::Sphere p0(1, 2);
+    problem::bbob::Sphere p1(1, 2);
+    const std::vector<double> best{0, 0}, worst{5, 5};
+    ASSERT_LT(problem::bbob::Sphere(1, 2)(best), problem::bbob::Sphere(1, 2)(worst));
+
+    logger::Store l0({trigger::on_improvement}, {watch::evaluations});
+    logger::Store l1({trigger::on_improvement}, {watch::evaluations});
+    p0.attach_logger(l0);
+    p1.attach_logger(l1);
+
+    // p1 sees a better value first, which should not hide the improvement of p0.
+    p1(best);
+    p0(worst);
+
+    EXPECT_EQ(l0.data().at(logger::Store::default_suite).at(1).at(2).at(1).at(0).size(), 1);
+    EXPECT_EQ(l1.data().at(logger::Store::default_suite).at(1).at(2).at(1).at(0).size(), 1);
+}
+
+TEST_F(BaseTest, loggers_concurrent_runs)
+{
+    const int n = 8;
+    std::vector<problem::bbob::Sphere> problems;
+    problems.reserve(n);
+    for (auto i = 1; i <= n; ++i)
+        problems.emplace_back(i, 10);
+
+    std::vector<logger::Store::Runs> results(n);
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < n; ++i)
+        threads.emplace_back([&, i]() { results[i] = search(problems[i], i); });
+    for (auto &t : threads)
+        t.join();
+
+    for (auto i = 0; i < n; ++i)
+    {
+        problem::bbob::Sphere pb(i + 1, 10);
+        const auto expected = search(pb, i);
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(results[i], expected);
+    }
+}
+
+TEST_F(BaseTest, problem_concurrent_evaluations)
+{
+    const int n = 8, evaluations = 500;
+    problem::bbob::Sphere pb(1, 5);
+    logger::Store store({trigger::always}, {watch::evaluations, watch::transformed_y, watch::transformed_y_best});
+    pb.attach_logger(store);
+
+    std::vector<double> best(n, std::numeric_limits<double>::infinity());
+    {
+        problem::Concurrent<double> concurrent(pb);
+        std::vector<std::thread> threads;
+        for (auto i = 0; i < n; ++i)
+            threads.emplace_back([&, i]() {
+                for (auto s = 0; s < evaluations; ++s)
+                    best[i] = std::min(best[i], concurrent(common::random::pbo::uniform(5, i * evaluations + s, -5, 5)));
+            });
+        for (auto &t : threads)
+            t.join();
+        EXPECT_EQ(concurrent.evaluations(), n * evaluations);
+        EXPECT_EQ(concurrent.current_best().y, *std::min_element(best.begin(), best.end()));
+    }
+
+    // The logger saw the evaluations in order, as in a sequential run.
+    EXPECT_EQ(pb.state().evaluations, n * evaluations);
+    EXPECT_EQ(pb.state().current_best.y, *std::min_element(best.begin(), best.end()));
+    const auto run = store.data().at(logger::Store::default_suite).at(1).at(5).at(1).at(0);
+    ASSERT_EQ(run.size(), n * evaluations);
+    auto y_best = std::numeric_limits<double>::infinity();
+    for (const auto &[i, event] : run)
+    {
+        EXPECT_EQ(event.at("evaluations").value(), i + 1);
+        y_best = std::min(y_best, event.at("transformed_y").value());
+        EXPECT_EQ(event.at("transformed_y_best").value(), y_best);
+    }
+    pb.detach_logger();
+
+    // Without logger, the state of the problem is updated by flush.
+    problem::Concurrent<double> concurrent(pb);
+    concurrent(std::vector<double>(5, 0.0));
+    concurrent.flush();
+    EXPECT_EQ(pb.state().evaluations, n * evaluations + 1);
+    concurrent.reset();
+    EXPECT_EQ(pb.state().evaluations, 0);
+    EXPECT_EQ(concurrent.evaluations(), 0);
+}
@@ -99,3 +99,54 @@ TEST_F(BaseTest, eah_scales_death)
     EXPECT_DEBUG_DEATH(logr_small.bounds(10) , "");
 }
 
+
+namespace
+{
+    //! Check that the tabulated index matches the scale's formula, around each threshold and all along the scale.
+    template <class S>
+    void expect_same_indices(const S &scale)
+    {
+        ASSERT_EQ(scale.thresholds().size(), scale.size() - 1);
+        std::vector<double> xs;
+        for (const auto threshold : scale.thresholds())
+        {
+            double x = threshold;
+            for (int k = 0; k < 8; ++k)
+                x = std::nextafter(x, -std::numeric_limits<double>::infinity());
+            for (int k = 0; k < 16; ++k, x = std::nextafter(x, std::numeric_limits<double>::infinity()))
+                if (scale.min() <= x and x <= scale.max())
+                    xs.push_back(x);
+        }
+        for (size_t k = 0; k < 1000; ++k)
+            xs.push_back(scale.min() + static_cast<double>(scale.length()) * static_cast<double>(k) / 1000.0);
+        xs.push_back(scale.max());
+
+        const auto is = scale.indices(xs);
+        ASSERT_EQ(is.size(), xs.size());
+        for (size_t k = 0; k < xs.size(); ++k)
+        {
+            const auto expected = xs[k] >= scale.max() ? scale.size() - 1
+                                                       : std::min(scale.size() - 1, scale.compute_index(xs[k]));
+            EXPECT_EQ(scale.index(xs[k]), expected) << "x=" << xs[k];
+            EXPECT_EQ(is[k], expected) << "x=" << xs[k];
+        }
+    }
+} // namespace
+
+TEST_F(BaseTest, eah_scales_tabulated)
+{
+    expect_same_indices(eah::Log2Scale<double>(0, 8, 5));
+    expect_same_indices(eah::Log2Scale<double>(0, 6e7, 100));
+    expect_same_indices(eah::Log2Scale<double>(-10, 1e3, 2000));
+    expect_same_indices(eah::Log2Scale<size_t>(0, 10000, 50));
+    expect_same_indices(eah::Log10Scale<double>(0, 6e7, 10));
+    expect_same_indices(eah::Log10Scale<double>(0, 1e2, 1000));
+    expect_same_indices(eah::Log10Scale<double>(1e-10, 1e10, 100));
+    expect_same_indices(eah::Log10Scale<size_t>(0, 100000, 500));
+    expect_same_indices(eah::Log10Scale<size_t>(0, 10, 1));
+
+    // Not tabulated.
+    eah::LinearScale<double> linr(0, 100, 10);
+    EXPECT_TRUE(linr.thresholds().empty());
+    EXPECT_EQ(linr.indices({0, 9, 50, 99, 100}), std::vector<size_t>({0, 0, 5, 9, 9}));
+}
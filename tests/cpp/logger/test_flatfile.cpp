@@ -3,6 +3,7 @@
 #include "ioh/logger/flatfile.hpp"
 #include "ioh/problem/bbob/sphere.hpp"
 #include "ioh/problem/bbob/attractive_sector.hpp"
+#include "ioh/problem/pbo/one_max.hpp"
 
 using namespace ioh;
 
@@ -35,3 +36,47 @@ TEST_F(BaseTest, logger_flatfile)
     fs::remove("./IOH.dat");
     EXPECT_TRUE(!fs::exists("./IOH.dat"));
 }
+
+TEST_F(BaseTest, logger_flatfile_positions)
+{
+    auto pb = problem::bbob::Sphere(1, 2);
+    const std::vector<double> x{0.1, -1.0 / 3.0};
+    {
+        auto logger = logger::FlatFile({trigger::always}, {watch::evaluations}, "IOH.dat", ".", " ", "# ", "None",
+                                       "\n", false, true, {});
+        pb.attach_logger(logger);
+        pb(x);
+
+        // Previous runs are written to the file when a new one starts.
+        pb.reset();
+        compare_file_with_string("./IOH.dat", "# evaluations x0 x1\n1 0.1 -0.3333333333333333\n");
+    }
+    fs::remove("./IOH.dat");
+}
+
+TEST_F(BaseTest, logger_flatfile_integer_positions)
+{
+    auto pb = problem::pbo::OneMax(1, 3);
+    {
+        auto logger = logger::FlatFile({trigger::always}, {watch::evaluations}, "IOH.dat", ".", " ", "# ", "None",
+                                       "\n", false, true, {});
+        pb.attach_logger(logger);
+        pb({1, 0, 1});
+
+        // The log info views the variables of the problem, with their type.
+        const auto &info = pb.log_info();
+        EXPECT_EQ(info.current.x.type(), logger::Variables::Type::Integer);
+        EXPECT_EQ(info.current.x.as_double(), std::vector<double>({1, 0, 1}));
+
+        // A stored info keeps its variables after the next evaluation.
+        const logger::StoredInfo stored(info);
+        pb({0, 0, 1});
+        EXPECT_EQ(std::vector<double>(info.current.x.begin(), info.current.x.end()), std::vector<double>({0, 0, 1}));
+        EXPECT_EQ(std::vector<double>(stored.current.x.begin(), stored.current.x.end()),
+                  std::vector<double>({1, 0, 1}));
+
+        pb.reset();
+        compare_file_with_string("./IOH.dat", "# evaluations x0 x1 x2\n1 1 0 1\n2 0 0 1\n");
+    }
+    fs::remove("./IOH.dat");
+}
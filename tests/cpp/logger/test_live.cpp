@@ -0,0 +1,98 @@
+#include "../utils.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include "ioh/logger/combine.hpp"
+#include "ioh/logger/live.hpp"
+#include "ioh/suite.hpp"
+
+using namespace ioh;
+
+#ifndef _WIN32
+
+TEST_F(BaseTest, live_results)
+{
+    const auto name = fmt::format("ioh-test-live-{}", ::getpid());
+    logger::Live live(name, 6, 4);
+    logger::Store improvements({trigger::on_improvement}, {watch::evaluations, watch::transformed_y_best});
+    logger::Combine both({live, improvements});
+    const logger::live::Reader reader(name);
+    EXPECT_EQ(reader.nb_runs(), 0);
+    EXPECT_EQ(reader.pid(), static_cast<uint64_t>(::getpid()));
+
+    // A concurrent reader only sees consistent runs.
+    std::atomic<bool> done{false};
+    size_t inconsistent = 0, snapshots = 0;
+    std::thread watcher([&] {
+        while (not done)
+        {
+            for (const auto &run : reader.snapshot())
+                if (run.nb_points > 0 and
+                    (run.trajectory.back().y != run.best_y or run.trajectory.back().evaluations != run.best_evaluation))
+                    ++inconsistent;
+            ++snapshots;
+        }
+    });
+
+    suite::BBOB suite({1, 2}, {1}, {2, 3});
+    suite.attach_logger(both);
+    for (const auto &pb : suite)
+        for (int r = 0; r < 2; ++r)
+        {
+            for (long s = 0; s < 2000; ++s)
+            {
+                (*pb)(common::random::pbo::uniform(pb->meta_data().n_variables, s + 10000 * r, -5, 5));
+                if (s % 500 == 0)
+                {
+                    EXPECT_EQ(reader.run(reader.nb_runs() - 1)->evaluations, s + 1);
+                }
+            }
+            if (pb->meta_data().problem_id != 2 or pb->meta_data().n_variables != 3 or r != 1)
+                pb->reset();
+        }
+    done = true;
+    watcher.join();
+    EXPECT_EQ(inconsistent, 0);
+    EXPECT_GT(snapshots, 0);
+
+    EXPECT_EQ(reader.nb_runs(), 8);
+    EXPECT_FALSE(reader.run(0)); // Overwritten.
+    EXPECT_FALSE(reader.run(8)); // Not started.
+    const auto runs = reader.snapshot();
+    ASSERT_EQ(runs.size(), 6);
+    EXPECT_EQ(runs.front().run, 2);
+    EXPECT_TRUE(runs.front().finished);
+    EXPECT_FALSE(runs.back().finished); // Still running.
+
+    const auto all = improvements.data();
+    const auto &data = all.at("BBOB");
+    for (const auto &run : runs)
+    {
+        EXPECT_EQ(run.suite, "BBOB");
+        EXPECT_EQ(run.problem, run.problem_id == 1 ? "Sphere" : "Ellipsoid");
+        EXPECT_EQ(run.optimization_type, common::OptimizationType::Minimization);
+        // The number of evaluations is published at each of them, finished or not.
+        EXPECT_EQ(run.evaluations, 2000);
+        const auto &expected = data.at(run.problem_id).at(run.n_variables).at(1).at(run.run % 2);
+        ASSERT_EQ(run.nb_points, expected.size());
+        const auto n = std::min<size_t>(expected.size(), 4);
+        ASSERT_EQ(run.trajectory.size(), n);
+        // The first points, then the last one.
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto &point = std::next(expected.begin(), i + 1 < n ? i : expected.size() - 1)->second;
+            EXPECT_EQ(run.trajectory[i].evaluations, point.at("evaluations").value());
+            EXPECT_EQ(run.trajectory[i].y, point.at("transformed_y_best").value());
+        }
+        EXPECT_EQ(run.best_y, expected.rbegin()->second.at("transformed_y_best").value());
+    }
+
+    EXPECT_FALSE(reader.closed());
+    live.close();
+    EXPECT_TRUE(reader.closed());
+    EXPECT_TRUE(reader.snapshot().back().finished);
+    EXPECT_THROW(logger::live::Reader{name}, std::runtime_error); // Removed.
+}
+
+#endif
@@ -0,0 +1,81 @@
+#include "../utils.hpp"
+
+#include "ioh/logger/analyzer.hpp"
+#include "ioh/logger/combine.hpp"
+#include "ioh/logger/eaf.hpp"
+#include "ioh/logger/recorder.hpp"
+#include "ioh/logger/summary.hpp"
+#include "ioh/suite.hpp"
+
+using namespace ioh;
+
+TEST_F(BaseTest, recorder_replay)
+{
+    const std::vector<double> targets{100, 10, 1};
+    const std::vector<size_t> budgets{1, 10, 30};
+
+    logger::EAF eaf;
+    {
+        logger::Recorder recorder("campaign.iohrec", true);
+        logger::Summary summary(targets, budgets, "live-summary.dat", ".");
+        logger::Analyzer analyzer({trigger::on_improvement}, {}, fs::current_path(), "live_data");
+        logger::Combine all({recorder, eaf, summary, analyzer});
+
+        suite::BBOB suite({1, 2}, {1, 2}, {2, 3});
+        suite.attach_logger(all);
+        for (const auto &pb : suite)
+        {
+            for (long r = 0; r < 2; ++r)
+            {
+                for (long s = 0; s < 40; ++s)
+                    (*pb)(common::random::pbo::uniform(pb->meta_data().n_variables, 100 * r + s, -5, 5));
+                pb->reset();
+            }
+        }
+    }
+
+    logger::Replayer replayer("campaign.iohrec");
+    EXPECT_TRUE(replayer.store_positions());
+    logger::EAF replayed_eaf;
+    {
+        logger::Summary summary(targets, budgets, "replayed-summary.dat", ".");
+        logger::Analyzer analyzer({trigger::on_improvement}, {}, fs::current_path(), "replayed_data");
+        logger::Combine all({replayed_eaf, summary, analyzer});
+        replayer.replay(all);
+    }
+
+    // The loggers fed by the replay wrote exactly the same data.
+    EXPECT_EQ(get_file_as_string("replayed-summary.dat"), get_file_as_string("live-summary.dat"));
+    const auto dat = fs::path("data_f2_Ellipsoid") / "IOHprofiler_f2_DIM3.dat";
+    EXPECT_EQ(get_file_as_string("replayed_data" / dat), get_file_as_string("live_data" / dat));
+
+    const auto &live = eaf.data().at("BBOB");
+    const auto &replayed = replayed_eaf.data().at("BBOB");
+    ASSERT_EQ(replayed.size(), live.size());
+    for (const auto &[pb, dims] : live)
+        for (const auto &[dim, instances] : dims)
+            for (const auto &[ins, runs] : instances)
+                for (const auto &[run, front] : runs)
+                {
+                    const auto &other = replayed.at(pb).at(dim).at(ins).at(run);
+                    ASSERT_EQ(other.size(), front.size());
+                    for (size_t i = 0; i < front.size(); ++i)
+                    {
+                        EXPECT_EQ(other[i].qual, front[i].qual);
+                        EXPECT_EQ(other[i].time, front[i].time);
+                    }
+                }
+
+    // Not a recording.
+    {
+        std::ofstream out("campaign.iohrec");
+        out << "suite_name problem_id";
+    }
+    EXPECT_THROW(logger::Replayer("campaign.iohrec"), std::runtime_error);
+
+    fs::remove("campaign.iohrec");
+    fs::remove("live-summary.dat");
+    fs::remove("replayed-summary.dat");
+    fs::remove_all("live_data");
+    fs::remove_all("replayed_data");
+}
@@ -1,6 +1,7 @@
 #include "../utils.hpp"
 
 #include "ioh/logger/store.hpp"
+#include "ioh/logger/combine.hpp"
 #include "ioh/suite.hpp"
 
 TEST_F(BaseTest, store_data_consistency)
@@ -34,6 +35,53 @@ TEST_F(BaseTest, store_data_consistency)
 
 }
 
+TEST_F(BaseTest, store_skip_ahead)
+{
+    using namespace ioh;
+
+    // Loggers with sparse triggers skip non-firing evaluations, but log the same events.
+    suite::BBOB suite({1, 2}, {1}, {5});
+    trigger::OnImprovement on_improvement;
+    auto each = trigger::Each(10, 5);
+    auto at = trigger::At({3, 33});
+    logger::Store sparse({each, at, on_improvement}, {watch::evaluations, watch::transformed_y_best});
+    logger::Store dense({trigger::always}, {watch::evaluations, watch::transformed_y_best, watch::transformed_y});
+    logger::Combine loggers({sparse, dense});
+    suite.attach_logger(loggers);
+
+    for (const auto &pb : suite) {
+        for (auto r = 0; r < 2; r++) {
+            for (auto s = 0; s < 100; ++s) {
+                (*pb)(common::random::pbo::uniform(pb->meta_data().n_variables, s + 100 * r, -5, 5));
+            }
+            pb->reset();
+        }
+    }
+
+    const auto dense_data = dense.data();
+    const auto sparse_data = sparse.data();
+    for (const auto &[pb, dims] : dense_data.at(suite.name())) {
+        for (const auto &[run, evals] : dims.at(5).at(1)) {
+            const auto &sparse_evals = sparse_data.at(suite.name()).at(pb).at(5).at(1).at(run);
+            // Rebuild what the sparse logger should have logged from the dense one.
+            std::vector<double> expected;
+            double best = std::numeric_limits<double>::infinity();
+            for (const auto &[i, att] : evals) {
+                const auto e = static_cast<size_t>(att.at("evaluations").value());
+                const double y = att.at("transformed_y").value();
+                const bool improved = y < best;
+                best = std::min(best, y);
+                if (improved or (e >= 5 and (e - 5) % 10 == 0) or e == 3 or e == 33)
+                    expected.push_back(static_cast<double>(e));
+            }
+            ASSERT_EQ(sparse_evals.size(), expected.size());
+            size_t k = 0;
+            for (const auto &[i, att] : sparse_evals)
+                EXPECT_EQ(att.at("evaluations").value(), expected[k++]);
+        }
+    }
+}
+
 TEST_F(BaseTest, issue94)
 {
     using namespace ioh;
@@ -148,3 +196,168 @@ TEST_F(BaseTest, store_properties)
     ASSERT_EQ(logger.at(last_eval, attr ).value(), my_attribute-1);
     ASSERT_EQ(logger.at(last_eval, attpr).value(), my_attribute-1);
 }
+
+TEST_F(BaseTest, store_watch_after_attach)
+{
+    using namespace ioh;
+
+    problem::bbob::Sphere pb(1, 3);
+    double my_attribute = 42;
+    watch::Reference attr("Att_reference", my_attribute);
+
+    logger::Store logger({trigger::always}, {watch::transformed_y});
+    pb.attach_logger(logger);
+    pb(common::random::pbo::uniform(3, 0));
+
+    // Properties added after attachment are logged from the next event on.
+    logger.watch(attr);
+    pb(common::random::pbo::uniform(3, 1));
+
+    const auto run = logger.data().at(logger::Store::default_suite).at(1).at(3).at(1).at(0);
+    EXPECT_EQ(run.at(0).count(attr.name()), 0);
+    ASSERT_EQ(run.at(1).count(attr.name()), 1);
+    EXPECT_EQ(run.at(1).at(attr.name()), 42);
+    EXPECT_EQ(run.at(1).at(watch::transformed_y.name()), pb.state().current.y);
+}
+
+TEST_F(BaseTest, store_attach_without_reset)
+{
+    using namespace ioh;
+
+    // The run of a problem is filed under it when the logger is attached to another one without a reset.
+    problem::bbob::Sphere sphere(1, 2);
+    problem::bbob::Ellipsoid ellipsoid(1, 2);
+    logger::Store logger({trigger::always}, {watch::evaluations});
+
+    sphere.attach_logger(logger);
+    for (auto s = 0; s < 3; ++s)
+        sphere(common::random::pbo::uniform(2, s));
+    ellipsoid.attach_logger(logger);
+    ellipsoid(common::random::pbo::uniform(2, 3));
+
+    const auto data = logger.data().at(logger::Store::default_suite);
+    ASSERT_EQ(data.at(1).at(2).at(1).size(), 1);
+    EXPECT_EQ(data.at(1).at(2).at(1).at(0).size(), 3);
+    ASSERT_EQ(data.at(2).at(2).at(1).size(), 1);
+    EXPECT_EQ(data.at(2).at(2).at(1).at(0).size(), 1);
+}
+
+TEST_F(BaseTest, store_spill)
+{
+    using namespace ioh;
+
+    suite::BBOB suite({1, 2}, {1, 2}, {3, 5});
+    double my_attribute = 42;
+    watch::Reference attr("Att_reference", my_attribute);
+    logger::Store unbounded({trigger::always}, {watch::transformed_y, watch::evaluations});
+    fs::path spill_file;
+    {
+        logger::Store bounded({trigger::always}, {watch::transformed_y, watch::evaluations}, 4 * 1024, fs::current_path());
+        logger::Combine loggers({unbounded, bounded});
+        suite.attach_logger(loggers);
+        for (const auto &pb : suite) {
+            for (auto r = 0; r < 3; r++) {
+                for (auto s = 0; s < 100; ++s) {
+                    (*pb)(common::random::pbo::uniform(pb->meta_data().n_variables, s + 100 * r, -5, 5));
+                    if (pb->meta_data().problem_id == 1 and pb->meta_data().instance == 1 and pb->meta_data().n_variables == 3 and r == 1 and s == 50) {
+                        // Some evaluations of the spilled runs lack this property.
+                        unbounded.watch(attr);
+                        bounded.watch(attr);
+                    }
+                }
+                pb->reset();
+            }
+        }
+
+        EXPECT_EQ(unbounded.nb_spilled(), 0);
+        EXPECT_GT(unbounded.memory_usage(), 8 * bounded.memory_budget());
+        EXPECT_GT(bounded.nb_spilled(), 0);
+        EXPECT_GT(bounded.spilled_size(), 0);
+        EXPECT_LE(bounded.memory_usage(), bounded.memory_budget());
+        spill_file = bounded.spill_file();
+        EXPECT_TRUE(fs::exists(spill_file));
+
+        // Spilled runs are accessed transparently.
+        EXPECT_EQ(bounded.data(), unbounded.data());
+        for (const auto &pb : {1, 2}) {
+            for (const auto &run : {0, 1, 2}) {
+                for (const auto &evaluation : {0, 50, 51, 99}) {
+                    const logger::Store::Cursor cursor(suite.name(), pb, 5, 2, run, evaluation);
+                    EXPECT_EQ(bounded.data(cursor), unbounded.data(cursor));
+                }
+            }
+        }
+        const logger::Store::Cursor last(suite.name(), 1, 3, 1, 1, 99);
+        EXPECT_EQ(bounded.at(last, attr), 42);
+        EXPECT_THROW(bounded.data(logger::Store::Cursor(suite.name(), 1, 3, 1, 1, 100)), std::out_of_range);
+    }
+    EXPECT_FALSE(fs::exists(spill_file));
+}
+
+TEST_F(BaseTest, store_spill_long_run)
+{
+    using namespace ioh;
+
+    problem::bbob::Sphere pb(1, 5);
+    logger::Store unbounded({trigger::always}, {watch::transformed_y, watch::evaluations});
+    const logger::Store::Cursor cursor(logger::Store::default_suite, 1, 5, 1, 0, 500);
+    fs::path spill_file;
+    {
+        logger::Store bounded({trigger::always}, {watch::transformed_y, watch::evaluations}, 1024, fs::current_path());
+        logger::Combine loggers({unbounded, bounded});
+        pb.attach_logger(loggers);
+        // The rows of the current run are spilled as well.
+        for (auto s = 0; s < 1000; ++s) {
+            pb(common::random::pbo::uniform(5, s, -5, 5));
+            ASSERT_LE(bounded.memory_usage(), bounded.memory_budget());
+        }
+        pb.detach_logger();
+        EXPECT_EQ(bounded.nb_spilled(), 1);
+        EXPECT_EQ(bounded.data(), unbounded.data());
+        EXPECT_EQ(bounded.data(cursor), unbounded.data(cursor));
+
+        // Moved loggers keep their spill file.
+        logger::Store moved(std::move(bounded));
+        spill_file = moved.spill_file();
+        EXPECT_TRUE(bounded.spill_file().empty());
+        EXPECT_TRUE(fs::exists(spill_file));
+        ASSERT_EQ(moved.runs().size(), 1);
+        EXPECT_EQ(moved.run(moved.runs().front()), unbounded.data().at(logger::Store::default_suite).at(1).at(5).at(1).at(0));
+        EXPECT_EQ(moved.data(cursor), unbounded.data(cursor));
+
+        logger::Store assigned({trigger::always}, {watch::evaluations});
+        assigned = std::move(moved);
+        EXPECT_TRUE(fs::exists(spill_file));
+        EXPECT_EQ(assigned.data(cursor), unbounded.data(cursor));
+    }
+    EXPECT_FALSE(fs::exists(spill_file));
+}
+
+TEST_F(BaseTest, store_merge_during_run)
+{
+    using namespace ioh;
+
+    problem::bbob::Sphere pb(1, 2);
+    logger::Store logger({trigger::always}, {watch::evaluations});
+    pb.attach_logger(logger);
+    pb(common::random::pbo::uniform(2, 0, -5, 5));
+
+    logger::Store::Suites other;
+    auto& runs = other[logger::Store::default_suite][1][2][1];
+    runs[0][0]["evaluations"] = 10;
+    runs[5][0]["evaluations"] = 20;
+    logger.merge(other);
+
+    // The current run keeps its id, the merged runs come after it.
+    pb(common::random::pbo::uniform(2, 1, -5, 5));
+    pb.reset();
+    pb(common::random::pbo::uniform(2, 2, -5, 5));
+
+    const auto data = logger.data().at(logger::Store::default_suite).at(1).at(2).at(1);
+    ASSERT_EQ(data.size(), 4);
+    EXPECT_EQ(data.at(0).size(), 2);
+    EXPECT_EQ(data.at(1).at(0).at("evaluations"), 10);
+    EXPECT_EQ(data.at(2).at(0).at("evaluations"), 20);
+    EXPECT_EQ(data.at(3).size(), 1);
+    EXPECT_EQ(data.at(3).at(0).at("evaluations"), 1);
+}
@@ -0,0 +1,106 @@
+#include "../utils.hpp"
+
+#include "ioh/logger/summary.hpp"
+#include "ioh/problem/bbob/sphere.hpp"
+
+using namespace ioh;
+
+TEST_F(BaseTest, logger_summary)
+{
+    const std::vector<double> targets{100, 10, 1, 1e-8};
+    const std::vector<size_t> budgets{1, 5, 10, 20};
+    const size_t samples = 10;
+
+    auto pb = problem::bbob::Sphere(1, 2);
+    {
+        logger::Summary summary(targets, budgets, "IOH-summary.dat", ".");
+        pb.attach_logger(summary);
+        for (size_t s = 0; s < samples; ++s)
+            pb(common::random::pbo::uniform(2, static_cast<long>(s), -5, 5));
+        pb.reset();
+    }
+
+    // Recompute the expected record.
+    auto ref = problem::bbob::Sphere(1, 2);
+    std::vector<double> errors;
+    double best = std::numeric_limits<double>::infinity();
+    for (size_t s = 0; s < samples; ++s)
+    {
+        best = std::min(best, ref(common::random::pbo::uniform(2, static_cast<long>(s), -5, 5)));
+        errors.push_back(std::abs(best - ref.objective().y));
+    }
+
+    const auto lines = split(get_file_as_string("IOH-summary.dat"), "\n");
+    ASSERT_EQ(lines.size(), 3); // Header, run, and the empty string after the last line.
+    const auto header = split(lines.at(0), " ");
+    const auto record = split(lines.at(1), " ");
+    ASSERT_EQ(header.size(), 7 + targets.size() + budgets.size());
+    ASSERT_EQ(record.size(), header.size());
+    EXPECT_EQ(header.at(7), "target_1e-08");
+    EXPECT_EQ(header.at(11), "budget_1");
+
+    EXPECT_EQ(record.at(5), "10");
+    EXPECT_EQ(std::stod(record.at(6)), errors.back());
+
+    // Targets are sorted.
+    for (size_t t = 0; t < targets.size(); ++t)
+    {
+        const double target = std::stod(header.at(7 + t).substr(7));
+        const auto hit = std::find_if(errors.begin(), errors.end(), [&](const double e) { return e <= target; });
+        if (hit == errors.end())
+            EXPECT_EQ(record.at(7 + t), "None");
+        else
+            EXPECT_EQ(std::stoul(record.at(7 + t)), hit - errors.begin() + 1);
+    }
+
+    for (size_t b = 0; b < budgets.size(); ++b)
+    {
+        if (budgets.at(b) > samples)
+            EXPECT_EQ(record.at(11 + b), "None");
+        else
+            EXPECT_EQ(std::stod(record.at(11 + b)), errors.at(budgets.at(b) - 1));
+    }
+    fs::remove("IOH-summary.dat");
+}
+
+TEST_F(BaseTest, logger_summary_grid)
+{
+    const auto budgets = logger::Summary::grid(logger::eah::Log10Scale<size_t>(0, 10000, 4));
+    EXPECT_EQ(budgets, std::vector<size_t>({9, 99, 999, 10000}));
+
+    const auto targets = logger::Summary::grid(logger::eah::Log10Scale<double>(0, 99, 2));
+    ASSERT_EQ(targets.size(), 2);
+    EXPECT_NEAR(targets.at(0), 9, 1e-12);
+    EXPECT_NEAR(targets.at(1), 99, 1e-12);
+}
+
+TEST_F(BaseTest, logger_summary_without_reset)
+{
+    // Runs ended by attaching another problem, or by closing the logger, record all their evaluations.
+    const std::vector<double> targets{1e-8};
+    const std::vector<size_t> budgets{5, 10};
+    auto first = problem::bbob::Sphere(1, 2);
+    auto second = problem::bbob::Sphere(2, 2);
+    {
+        logger::Summary summary(targets, budgets, "IOH-summary.dat", ".");
+        first.attach_logger(summary);
+        for (long s = 0; s < 10; ++s)
+            first(common::random::pbo::uniform(2, s, -5, 5));
+        second.attach_logger(summary);
+        for (long s = 0; s < 7; ++s)
+            second(common::random::pbo::uniform(2, s, -5, 5));
+        summary.close();
+    }
+
+    const auto lines = split(get_file_as_string("IOH-summary.dat"), "\n");
+    ASSERT_EQ(lines.size(), 4);
+    const auto run = split(lines.at(1), " ");
+    EXPECT_EQ(run.at(5), "10");
+    EXPECT_NE(run.at(8), "None");
+    EXPECT_NE(run.at(9), "None");
+    const auto other = split(lines.at(2), " ");
+    EXPECT_EQ(other.at(5), "7");
+    EXPECT_NE(other.at(8), "None");
+    EXPECT_EQ(other.at(9), "None");
+    fs::remove("IOH-summary.dat");
+}
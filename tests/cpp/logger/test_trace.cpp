@@ -0,0 +1,115 @@
+#include "../utils.hpp"
+
+#include "ioh/logger/trace.hpp"
+#include "ioh/problem/bbob/sphere.hpp"
+#include "ioh/problem/pbo/one_max.hpp"
+
+using namespace ioh;
+
+namespace
+{
+    //! Size of the solutions printed as the FlatFile does.
+    size_t text_size(const std::vector<std::vector<double>> &solutions)
+    {
+        size_t size = 0;
+        for (const auto &x : solutions)
+            size += fmt::format("{:f}", fmt::join(x, " ")).size() + 1;
+        return size;
+    }
+
+    //! A random walk changing one variable at each step.
+    std::vector<std::vector<double>> walk(const size_t n, const size_t steps, const bool binary)
+    {
+        std::vector<std::vector<double>> solutions;
+        auto x = common::random::pbo::uniform(n, 42, binary ? 0 : -5, binary ? 1 : 5);
+        if (binary)
+            for (auto &xi : x)
+                xi = std::round(xi);
+        const auto changes = common::random::pbo::uniform(2 * steps, 7, 0, 1);
+        for (size_t s = 0; s < steps; ++s)
+        {
+            const auto i = std::min(n - 1, static_cast<size_t>(changes[2 * s] * static_cast<double>(n)));
+            x[i] = binary ? 1 - x[i] : x[i] + changes[2 * s + 1] - 0.5;
+            solutions.push_back(x);
+        }
+        return solutions;
+    }
+} // namespace
+
+TEST_F(BaseTest, trace_real)
+{
+    const auto solutions = walk(100, 1000, false);
+    const auto bytes = logger::trace::encode(solutions, logger::trace::Encoding::Real);
+    EXPECT_EQ(logger::trace::decode(bytes, 100, solutions.size(), logger::trace::Encoding::Real), solutions);
+    EXPECT_GT(text_size(solutions), 10 * bytes.size());
+
+    // Any bit pattern, including special values.
+    const std::vector<std::vector<double>> special{{0., -0., 1e-320, std::numeric_limits<double>::infinity()},
+                                                   {std::numeric_limits<double>::max(), -0., 0., 1.},
+                                                   {std::numeric_limits<double>::quiet_NaN(), 3., 3., 3.}};
+    const auto decoded = logger::trace::decode(logger::trace::encode(special, logger::trace::Encoding::Real), 4,
+                                               special.size(), logger::trace::Encoding::Real);
+    EXPECT_EQ(0, std::memcmp(decoded[0].data(), special[0].data(), 4 * sizeof(double)));
+    EXPECT_EQ(decoded[1], special[1]);
+    EXPECT_TRUE(std::isnan(decoded[2][0]));
+
+    EXPECT_THROW(logger::trace::decode(bytes.substr(0, bytes.size() / 2), 100, solutions.size(),
+                                       logger::trace::Encoding::Real),
+                 std::runtime_error);
+}
+
+TEST_F(BaseTest, trace_integer)
+{
+    const auto bits = walk(100, 1000, true);
+    const auto bytes = logger::trace::encode(bits, logger::trace::Encoding::Integer);
+    EXPECT_EQ(logger::trace::decode(bytes, 100, bits.size(), logger::trace::Encoding::Integer), bits);
+    EXPECT_GT(text_size(bits), 50 * bytes.size());
+
+    const std::vector<std::vector<double>> integers{{0, 5, -3}, {0, 5, -3}, {1e15, -7, -3}, {-1e15, 1, 0}};
+    EXPECT_EQ(logger::trace::decode(logger::trace::encode(integers, logger::trace::Encoding::Integer), 3,
+                                    integers.size(), logger::trace::Encoding::Integer),
+              integers);
+    EXPECT_THROW(logger::trace::encode({{0.5}}, logger::trace::Encoding::Integer), std::invalid_argument);
+}
+
+TEST_F(BaseTest, trace_logger)
+{
+    std::vector<std::vector<double>> improvements;
+    {
+        logger::PositionTrace real({trigger::on_improvement}, "real.iohtrace");
+        auto sphere = problem::bbob::Sphere(1, 10);
+        sphere.attach_logger(real);
+        for (auto &x : walk(10, 200, false))
+        {
+            const auto best = sphere.state().current_best.y;
+            if (sphere(x) < best)
+                improvements.push_back(x);
+        }
+    }
+    const auto runs = logger::trace::read("real.iohtrace");
+    ASSERT_EQ(runs.size(), 1);
+    EXPECT_EQ(runs[0].problem_id, 1);
+    EXPECT_EQ(runs[0].n_variables, 10);
+    EXPECT_EQ(runs[0].solutions, improvements);
+    ASSERT_EQ(runs[0].evaluations.size(), improvements.size());
+    EXPECT_EQ(runs[0].evaluations.front(), 1);
+
+    {
+        logger::PositionTrace bits({trigger::always}, "bits.iohtrace", logger::trace::Encoding::Integer);
+        auto onemax = problem::pbo::OneMax(1, 20);
+        onemax.attach_logger(bits);
+        for (int r = 0; r < 2; ++r)
+        {
+            for (auto &x : walk(20, 30, true))
+                onemax(std::vector<int>(x.begin(), x.end()));
+            onemax.reset();
+        }
+    }
+    const auto bit_runs = logger::trace::read("bits.iohtrace");
+    ASSERT_EQ(bit_runs.size(), 2);
+    EXPECT_EQ(bit_runs[1].solutions, walk(20, 30, true));
+    EXPECT_EQ(bit_runs[1].evaluations.back(), 30);
+
+    fs::remove("real.iohtrace");
+    fs::remove("bits.iohtrace");
+}
@@ -131,3 +131,66 @@ TEST_F(BaseTest, trigger_during)
     EXPECT_FALSE(t(e102,pb));
 }
 
+
+TEST_F(BaseTest, trigger_next)
+{
+    trigger::Always always;
+    EXPECT_EQ(always.next(0), 1);
+    EXPECT_EQ(always.next(41), 42);
+
+    trigger::OnImprovement on_improvement;
+    EXPECT_EQ(on_improvement.next(0), trigger::never);
+
+    auto each = trigger::Each(10, 1);
+    EXPECT_EQ(each.next(0), 1);
+    EXPECT_EQ(each.next(1), 11);
+    EXPECT_EQ(each.next(10), 11);
+    EXPECT_EQ(each.next(11), 21);
+
+    auto at = trigger::At({1, 10, 100});
+    EXPECT_EQ(at.next(0), 1);
+    EXPECT_EQ(at.next(1), 10);
+    EXPECT_EQ(at.next(50), 100);
+    EXPECT_EQ(at.next(100), trigger::never);
+
+    auto during = trigger::During({{10, 18}, {15, 30}, {101, 101}});
+    EXPECT_EQ(during.next(0), 10);
+    EXPECT_EQ(during.next(12), 13);
+    EXPECT_EQ(during.next(18), 19);
+    EXPECT_EQ(during.next(30), 101);
+    EXPECT_EQ(during.next(101), trigger::never);
+
+    auto any = trigger::Any({each, at});
+    EXPECT_EQ(any.next(2), 10);
+    EXPECT_EQ(any.next(10), 11);
+
+    auto all = trigger::All({on_improvement, during});
+    EXPECT_EQ(all.next(0), trigger::never);
+}
+
+TEST_F(BaseTest, trigger_next_is_exact)
+{
+    // The announced next evaluation is the first one at which the trigger fires.
+    problem::MetaData pb(0, 0, "fake", 2);
+    auto each = trigger::Each(7, 3);
+    auto at = trigger::At({2, 5, 64});
+    auto during = trigger::During({{10, 12}, {11, 20}, {40, 41}});
+    for (logger::Trigger *t : std::vector<logger::Trigger *>{&each, &at, &during})
+    {
+        logger::Info info;
+        for (size_t e = 0; e < 100; ++e)
+        {
+            const size_t n = t->next(e);
+            for (size_t f = e + 1; f < std::min<size_t>(n, 100); ++f)
+            {
+                info.evaluations = f;
+                EXPECT_FALSE((*t)(info, pb)) << "at " << f << " before " << n;
+            }
+            if (n < 100)
+            {
+                info.evaluations = n;
+                EXPECT_TRUE((*t)(info, pb)) << "at " << n;
+            }
+        }
+    }
+}
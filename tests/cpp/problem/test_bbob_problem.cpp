@@ -1,6 +1,7 @@
 #include "../utils.hpp"
 
 #include "ioh/problem/bbob.hpp"
+#include "ioh/problem/instances.hpp"
 
 double test_eval(const std::shared_ptr<ioh::problem::Real> &f)
 {
@@ -132,4 +133,95 @@ TEST_F(BaseTest, xopt_equals_yopt_bbob)
         auto problem = problem_factory.create(name, 1, 16);
         EXPECT_DOUBLE_EQ(problem->objective().y, (*problem)(problem->objective().x)) << *problem;
     }
-}
\ No newline at end of file
+}
+TEST_F(BaseTest, bbob_instances)
+{
+    std::vector<int> instances(15);
+    std::iota(instances.begin(), instances.end(), 1);
+    const auto &factory = ioh::problem::ProblemRegistry<ioh::problem::BBOB>::instance();
+    for (const auto id : factory.ids())
+    {
+        ioh::problem::Instances<double> batch(id, instances, 4);
+        ASSERT_EQ(batch.size(), instances.size());
+        const std::set<int> affine{1, 6, 9, 13, 14, 23};
+        EXPECT_EQ(batch.stacked(), affine.count(id) == 1) << id;
+        std::vector<std::vector<double>> xs;
+        for (long s = 0; s < 5; ++s)
+            xs.push_back(ioh::common::random::pbo::uniform(4, s, -5, 5));
+        xs.push_back(ioh::common::random::pbo::uniform(4, 5, 5, 7));
+        const auto ys = batch(xs);
+        for (size_t k = 0; k < instances.size(); ++k)
+        {
+            const auto problem = factory.create(id, instances[k], 4);
+            EXPECT_EQ(batch.optimum_values()[k], problem->objective().y);
+            EXPECT_EQ(batch.optima()[k * 4 + 3], problem->objective().x[3]);
+            for (size_t p = 0; p < xs.size(); ++p)
+                EXPECT_EQ(ys[p * instances.size() + k], (*problem)(xs[p])) << id << " " << instances[k];
+        }
+    }
+    ioh::problem::Instances<double> sphere("Sphere", {1, 2}, 3);
+    EXPECT_TRUE(std::isnan(sphere(std::vector<double>(2, 0.0)).front()));
+    EXPECT_THROW(ioh::problem::Instances<double>("NoSuchProblem", {1}, 3), std::invalid_argument);
+    EXPECT_THROW(ioh::problem::Instances<double>({factory.create(1, 1, 4), factory.create(2, 1, 4)}),
+                 std::invalid_argument);
+    EXPECT_THROW(ioh::problem::Instances<double>({factory.create(1, 1, 4), factory.create(1, 2, 5)}),
+                 std::invalid_argument);
+}
+
+TEST_F(BaseTest, bbob_rotation_cache)
+{
+    using namespace ioh::problem;
+    const auto &factory = ProblemRegistry<BBOB>::instance();
+    auto &cache = bbob::RotationCache::instance();
+    cache.clear();
+
+    const auto x = ioh::common::random::pbo::uniform(10, 3);
+    for (const auto id : {1, 4, 8, 10, 16, 17, 19, 21, 22, 23, 24})
+    {
+        const auto problem = factory.create(id, 7, 10);
+        const auto data = problem->rotations()->serialize();
+        EXPECT_EQ(data.size(), bbob::Rotations::deserialize(data.data(), data.size())->serialized_size());
+        cache.clear();
+        EXPECT_EQ(cache.load(data + data), 2);
+        EXPECT_EQ(cache.size(), 1);
+        const auto copy = factory.create(id, 7, 10);
+        EXPECT_EQ((*copy)(x), (*problem)(x)) << id;
+        EXPECT_EQ(copy->objective().x, problem->objective().x);
+        EXPECT_EQ(copy->rotations()->serialize(), data) << id;
+        EXPECT_EQ(copy->rotations(), cache.find(bbob::Rotations::deserialize(data.data(), data.size())->seed, 10,
+                                                copy->rotations()->condition));
+        cache.clear();
+    }
+    EXPECT_THROW(cache.load(std::string(100, 'x')), std::invalid_argument);
+
+    const auto y = ioh::common::random::pbo::uniform(6, 5);
+    std::vector<std::shared_ptr<BBOB>> problems, attached;
+    for (const auto id : {2, 9, 21})
+        problems.push_back(factory.create(id, 1, 6));
+    {
+        const bbob::SharedRotations shared("ioh-test-rotations", {problems[0]->rotations(), problems[1]->rotations(),
+                                                                  problems[2]->rotations()});
+        EXPECT_EQ(cache.segment(9 + 10000, 6, sqrt(10.0)), "/ioh-test-rotations");
+        cache.clear();
+        cache.attach("ioh-test-rotations");
+        EXPECT_EQ(cache.size(), 3);
+        const auto gallagher = cache.find(21 + 10000, 6, sqrt(10.0));
+        EXPECT_TRUE(gallagher->first.is_view());
+        EXPECT_EQ(gallagher->peaks(), 101);
+        for (const auto &problem : problems)
+            attached.push_back(factory.create(problem->meta_data().problem_id, 1, 6));
+    }
+    EXPECT_EQ(cache.segment(9 + 10000, 6, sqrt(10.0)), "");
+    cache.clear();
+    for (size_t i = 0; i < problems.size(); ++i)
+        EXPECT_EQ((*attached[i])(y), (*problems[i])(y)) << i;
+    EXPECT_THROW(cache.attach("ioh-test-rotations"), std::runtime_error);
+
+    bbob::Matrix matrix(2, 2, 1.0);
+    auto view = bbob::Matrix::view(matrix.data(), 2, 2, nullptr);
+    view(1, 0) = 3.0;
+    EXPECT_FALSE(view.is_view());
+    EXPECT_EQ(matrix[1][0], 1.0);
+    EXPECT_EQ(view.at(1).at(0), 3.0);
+    EXPECT_THROW((void)view.at(2), std::out_of_range);
+}
@@ -0,0 +1,57 @@
+#include "../utils.hpp"
+
+#include "ioh/problem/external.hpp"
+
+#ifdef IOH_STUB_WORKER
+TEST_F(BaseTest, external_problem)
+{
+    using namespace ioh::problem;
+    ExternalProblem<double> problem({IOH_STUB_WORKER, "3", "-5", "5"}, 2);
+    EXPECT_EQ(problem.nb_workers(), 2);
+    EXPECT_EQ(problem.meta_data().name, "StubSphere");
+    EXPECT_EQ(problem.meta_data().n_variables, 3);
+    EXPECT_EQ(problem.meta_data().optimization_type, ioh::common::OptimizationType::Minimization);
+    EXPECT_EQ(problem.constraint().ub, std::vector<double>(3, 5.0));
+    EXPECT_DOUBLE_EQ(problem({1, 2, 3}), 14);
+
+    std::vector<std::vector<double>> xs;
+    for (auto k = 0; k < 1000; ++k)
+        xs.push_back({k / 1000.0, -1.0, 2.0 - k / 500.0});
+    xs[10] = {1.0, 2.0};
+    const auto ys = problem(xs);
+    EXPECT_TRUE(std::isnan(ys[10]));
+    for (size_t k = 0; k < xs.size(); ++k)
+    {
+        if (k != 10)
+        {
+            ASSERT_DOUBLE_EQ(ys[k], xs[k][0] * xs[k][0] + 1 + xs[k][2] * xs[k][2]) << k;
+        }
+    }
+    EXPECT_EQ(problem.state().evaluations, 1000);
+    EXPECT_DOUBLE_EQ(problem.state().current_best.y, 1.8);
+    EXPECT_EQ(problem.state().current_best.x, xs[800]);
+
+    // Each worker exits at its 40th evaluation, and is restarted.
+    ExternalProblem<double> crashing({IOH_STUB_WORKER, "2", "-1", "1", "40"}, 2);
+    std::vector<std::vector<double>> batch(200, {0.5, 0.5});
+    const auto values = crashing(batch);
+    EXPECT_EQ(values, std::vector<double>(200, 0.5));
+    EXPECT_EQ(crashing.restarts(), 4);
+    EXPECT_DOUBLE_EQ(crashing({1, 1}), 2);
+
+    EXPECT_THROW(ExternalProblem<double>({IOH_STUB_WORKER, "2", "-1", "1", "1"}, 1)(batch), std::runtime_error);
+
+    // Each worker hangs at its 30th evaluation, and is killed and restarted.
+    external::Options options;
+    options.evaluation_timeout = std::chrono::milliseconds(200);
+    ExternalProblem<double> hanging({IOH_STUB_WORKER, "2", "-1", "1", "0", "30"}, 2, options);
+    const std::vector<std::vector<double>> slow(100, {0.5, 0.5});
+    EXPECT_EQ(hanging(slow), std::vector<double>(100, 0.5));
+    EXPECT_EQ(hanging.restarts(), 2);
+    EXPECT_THROW(ExternalProblem<double>({IOH_STUB_WORKER, "2", "-1", "1", "0", "1"}, 1, options)(slow),
+                 std::runtime_error);
+    EXPECT_THROW(ExternalProblem<int>({IOH_STUB_WORKER, "2", "-1", "1"}), std::runtime_error);
+    EXPECT_THROW(ExternalProblem<double>({IOH_STUB_WORKER}), std::runtime_error);
+    EXPECT_THROW(ExternalProblem<double>({"ioh-no-such-worker"}), std::runtime_error);
+}
+#endif
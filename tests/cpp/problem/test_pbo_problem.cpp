@@ -1,6 +1,7 @@
 #include "../utils.hpp" 
 
 #include "ioh/problem/pbo.hpp"
+#include "ioh/landscape/enumeration.hpp"
 
 double test_eval(const std::shared_ptr<ioh::problem::Integer> &f)
 {
@@ -95,7 +96,8 @@ TEST_F(BaseTest, xopt_equals_yopt_pbo)
     const auto& problem_factory = ioh::problem::ProblemRegistry<ioh::problem::PBO>::instance();
     for (const auto& name : problem_factory.names())
     {
-        if (name != "LABS" && name != "NQueens" && name != "LeadingOnesEpistasis"  && name != "OneMaxEpistasis"&& name != "MIS" && name != "NKLandscapes")
+        if (name != "LABS" && name != "NQueens" && name != "LeadingOnesEpistasis"  && name != "OneMaxEpistasis"&& name != "MIS" && name != "NKLandscapes"
+            && name != "IsingSpinGlass" && name != "MaxCut" && name != "MaxIndependentSet" && name != "VertexCover")
         {
             for (const int i: std::vector<int>({1, 2, 3, 4, 51, 52, 53, 54})){
                 auto problem = problem_factory.create(name, i, 16);
@@ -179,4 +181,51 @@ TEST_F(BaseTest, origin_x)
     for(size_t i = 0; i!= x7.size(); ++i) {
         EXPECT_EQ(x7.at(i), xt.at(i));
     }
-}
\ No newline at end of file
+}
+
+TEST_F(BaseTest, PBO_graph_problems)
+{
+    using namespace ioh::problem::pbo;
+    {
+        std::ofstream out("graph.txt");
+        out << "# A square, with a diagonal, a loop and a parallel edge\n0 1\n1\t2\n2,3,2.5\n\n% comment\n3 0\n0 2 "
+               "-1\n1 1\n1 0 0.5\n";
+    }
+    const auto square = std::make_shared<const Graph>(Graph::from_file("graph.txt"));
+    fs::remove("graph.txt");
+    EXPECT_EQ(square->size(), 4);
+    EXPECT_EQ(square->n_edges(), 5);
+    EXPECT_EQ(square->weights(), std::vector<double>({1.5, -1, 1, 1, 2.5}));
+    EXPECT_EQ(square->degree(0), 3);
+    EXPECT_EQ(square->degree(1), 2);
+    EXPECT_EQ(square->offsets().back(), 10);
+
+    EXPECT_DOUBLE_EQ(MaxCut(1, square)({0, 1, 0, 1}), 1.5 + 1 + 2.5 + 1);
+    EXPECT_DOUBLE_EQ(IsingSpinGlass(1, square)({0, 0, 0, 0}), 5);
+    EXPECT_DOUBLE_EQ(IsingSpinGlass(1, square)({0, 1, 0, 1}), -1.5 - 1 - 1 - 2.5 - 1);
+    EXPECT_DOUBLE_EQ(MaxIndependentSet(1, square)({0, 1, 0, 1}), 2);
+    EXPECT_DOUBLE_EQ(MaxIndependentSet(1, square)({1, 0, 1, 0}), 2 - 4);
+    EXPECT_DOUBLE_EQ(VertexCover(1, square)({0, 1, 1, 0}), -2 - 4);
+    EXPECT_DOUBLE_EQ(VertexCover(1, square)({1, 0, 1, 0}), -2);
+
+    // The single-flip evaluations give the values of the full evaluations.
+    const auto &factory = ioh::problem::ProblemRegistry<ioh::problem::PBO>::instance();
+    for (const auto name : {"IsingSpinGlass", "MaxCut", "MaxIndependentSet", "VertexCover"})
+        for (const auto instance : {1, 8, 70})
+        {
+            const auto problem = factory.create(name, instance, 12);
+            const ioh::landscape::Enumeration<double> enumeration(*problem, 2);
+            EXPECT_TRUE(enumeration.delta());
+            for (size_t x = 0; x < enumeration.values().size(); ++x)
+                ASSERT_DOUBLE_EQ(enumeration.values()[x], (*problem)(enumeration.solution(x)))
+                    << name << " " << instance << " " << x;
+        }
+
+    const auto graph = Graph::random(250000, 8, 3, true);
+    EXPECT_GT(graph.n_edges(), 990000);
+    EXPECT_EQ(graph.offsets().back(), 2 * graph.n_edges());
+    IsingSpinGlass spin_glass(1, std::make_shared<const Graph>(graph));
+    EXPECT_EQ(spin_glass.meta_data().n_variables, 250000);
+    const auto sum = std::accumulate(graph.weights().begin(), graph.weights().end(), 0.0);
+    EXPECT_DOUBLE_EQ(spin_glass(std::vector<int>(250000, 1)), sum);
+}
@@ -59,4 +59,33 @@ TEST_F(BaseTest, test_wrap_integer_problem){
         EXPECT_DOUBLE_EQ(static_cast<double>(inst) * 3, problem->objective().y);
         EXPECT_DOUBLE_EQ((fn<int>(x0) + inst - 1) * inst, (*problem)(x0));
     }
-}
\ No newline at end of file
+}
+
+TEST_F(BaseTest, test_wrap_callable_problem){
+    using namespace ioh::common;
+    using namespace ioh::problem;
+    auto &factory = ProblemRegistry<Real>::instance();
+
+    const double offset = 0.5;
+    wrap_function<double>([offset](const std::vector<double> &x) { return fn<double>(x) + offset; }, "callable",
+                          OptimizationType::Minimization, -5, 5);
+    wrap_function<double>([](const std::vector<double> &x) { return fn<double>(x); }, "callable_ty",
+                          OptimizationType::Minimization, -5, 5, utils::Identity{},
+                          [](const double y, const int iid) { return y * iid; });
+    const std::vector<double> x0 = {1, 0, 2};
+
+    for (auto inst: {1, 2}){
+        auto problem = factory.create("callable", inst, 3);
+        EXPECT_EQ(nullptr, dynamic_cast<WrappedProblem<double> *>(problem.get()));
+        EXPECT_DOUBLE_EQ(5, problem->constraint().ub.at(0));
+        EXPECT_DOUBLE_EQ(fn<double>(x0) + offset, (*problem)(x0));
+        EXPECT_EQ(x0, problem->state().current_internal.x);
+
+        auto transformed = factory.create("callable_ty", inst, 3);
+        EXPECT_DOUBLE_EQ(fn<double>(x0) * inst, (*transformed)(x0));
+    }
+
+    WrappedProblem<double> erased(fn<double>, "erased", 3);
+    EXPECT_DOUBLE_EQ(fn<double>(x0), erased(x0));
+    EXPECT_EQ(x0, erased.state().current_internal.x);
+}
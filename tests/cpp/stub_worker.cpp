@@ -0,0 +1,41 @@
+/** A stub external problem, spawned by the tests of problem::ExternalProblem: the sphere, on
+ * n_variables variables in [lb, ub], which exits abruptly at every crash_every-th evaluation,
+ * and hangs at every hang_every-th evaluation, if given (0 for never).
+ *
+ * Usage: stub_worker n_variables lb ub [crash_every [hang_every]]
+ */
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+#include "ioh/problem/external.hpp"
+
+int main(int argc, char *argv[])
+{
+    using namespace ioh::problem;
+    if (argc < 4)
+    {
+        std::cerr << "Usage: " << argv[0] << " n_variables lb ub [crash_every [hang_every]]\n";
+        return 2;
+    }
+    const auto n_variables = std::atoi(argv[1]);
+    const auto crash_every = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 0;
+    const auto hang_every = argc > 5 ? std::strtoul(argv[5], nullptr, 10) : 0;
+    size_t evaluations = 0;
+
+    external::Worker<double> worker(MetaData(1, 1, "StubSphere", n_variables),
+                                    Constraint<double>(n_variables, std::atof(argv[2]), std::atof(argv[3])));
+    worker.run([&](const std::vector<double> &x) {
+        ++evaluations;
+        if (crash_every != 0 and evaluations % crash_every == 0)
+            std::_Exit(3);
+        if (hang_every != 0 and evaluations % hang_every == 0)
+            std::this_thread::sleep_for(std::chrono::hours(1));
+        auto y = 0.0;
+        for (const auto xi : x)
+            y += xi * xi;
+        return y;
+    });
+    return 0;
+}
@@ -0,0 +1,30 @@
+import unittest
+
+import ioh
+
+
+class TestLandscape(unittest.TestCase):
+    def test_samplers(self):
+        sobol = ioh.landscape.Sobol(3)
+        self.assertEqual(sobol(1), [0.5, 0.5, 0.5])
+        self.assertEqual(sobol.dimension, 3)
+        lhs = ioh.landscape.LatinHypercube(2, 10)
+        self.assertEqual(sorted(int(lhs(i)[0] * 10) for i in range(10)), list(range(10)))
+        self.assertEqual(ioh.landscape.Uniform(2, 5)(3), ioh.landscape.Uniform(2, 5)(3))
+
+    def test_analyze(self):
+        p = ioh.get_problem(1, 1, 5)
+        analysis = ioh.landscape.analyze(p, ioh.landscape.Sobol(5), 2048, nb_threads=2, subsample=200)
+        self.assertEqual(analysis.features.samples, 2048)
+        self.assertEqual(p.state.evaluations, 2048)
+        self.assertGreater(analysis.features.fdc, 0.9)
+        self.assertEqual(len(analysis.points), 200)
+        self.assertEqual(analysis.nearest_better.count(-1), 1)
+
+        p = ioh.get_problem(1, 1, 16, "PBO")
+        features = ioh.landscape.analyze(p, ioh.landscape.Uniform(16), 1000).features
+        self.assertLess(features.fdc, -0.9)
+
+
+if __name__ == "__main__":
+    unittest.main()
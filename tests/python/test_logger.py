@@ -92,6 +92,29 @@ class TestLogger(unittest.TestCase):
             p([i] * 5)
 
         self.assertEqual(list(l.data.keys()), [1])
+
+    def test_live(self):
+        from ioh import live
+
+        p = ioh.get_problem(1, 1, 5)
+        l = ioh.logger.Live(f"ioh-test-live-{os.getpid()}", 4, 8)
+        p.attach_logger(l)
+        for r in range(6):
+            for i in range(10):
+                p([i - 5] * 5)
+            p.reset()
+
+        with live.Reader(l.name) as reader:
+            self.assertEqual(reader.nb_runs, 6)
+            self.assertIsNone(reader.run(0))
+            runs = reader.snapshot()
+            self.assertEqual([run.run for run in runs], [2, 3, 4, 5])
+            for run in runs:
+                self.assertTrue(run.finished)
+                self.assertEqual(run.evaluations, 10)
+                self.assertEqual(run.trajectory[-1], (run.best_evaluation, run.best_y))
+            l.close()
+            self.assertTrue(reader.closed)
                     
                     
 if __name__ == "__main__":
@@ -1,12 +1,17 @@
 import os
+import pickle
 import unittest
 import math
+import multiprocessing
 
 import ioh
 
 DATA_DIR = os.path.join(
     os.path.dirname(os.path.dirname(__file__)), "static")
 
+def _evaluate(data):
+    return pickle.loads(data)([0.5] * 10)
+
 class wmodel(ioh.problem.AbstractWModel):
     def __init__(self, instance, dim):
         super().__init__(100, instance, dim, "wmodel")
@@ -33,11 +38,64 @@ class TestProblem(unittest.TestCase):
             f = ioh.get_problem(fid, 1 ,5, "BBOB")
             self.assertGreater(f([0,0,0,0,0]), -1000)
 
+    def test_instances(self):
+        instances = ioh.problem.RealInstances("Sphere", list(range(1, 16)), 5)
+        self.assertEqual(len(instances), 15)
+        self.assertTrue(instances.stacked)
+        xs = [[0.5 * i] * 5 for i in range(3)]
+        ys = instances(xs)
+        for k, iid in enumerate(instances.instances):
+            f = ioh.get_problem(1, iid, 5, "BBOB")
+            self.assertEqual(instances.optimum_values[k], f.objective.y)
+            self.assertEqual(instances.optima[k], f.objective.x)
+            for p, x in enumerate(xs):
+                self.assertEqual(ys[p][k], f(x))
+        self.assertEqual(instances(xs[0]), ys[0])
+
     def test_evaluation_pbo_problems(self):
         for fid in range(1,26):
             f = ioh.get_problem(fid, 1 ,4, "PBO")
             self.assertGreater(f([0,0,0,0]), -1000) 
 
+    def test_graph_problems(self):
+        graph = ioh.problem.Graph(4, [(0, 1, 1.0), (1, 2, 1.0), (2, 3, 2.0), (3, 0, 1.0)])
+        self.assertEqual(len(graph), 4)
+        self.assertEqual(graph.n_edges, 4)
+        self.assertEqual(ioh.problem.MaxCut(1, graph)([0, 1, 0, 1]), 5)
+        self.assertEqual(ioh.problem.MaxIndependentSet(1, graph)([0, 1, 0, 1]), 2)
+        self.assertEqual(ioh.problem.VertexCover(1, graph)([1, 0, 1, 0]), -2)
+        self.assertEqual(ioh.problem.IsingSpinGlass(1, graph)([1, 1, 1, 1]), 5)
+        p = ioh.get_problem("MaxCut", 1, 100, "PBO")
+        self.assertEqual(len(p.graph), 100)
+        self.assertGreater(p.graph.n_edges, 150)
+
+    def test_pickle(self):
+        x = [0.3, -1.2, 4.1, 2.0, -0.7]
+        for fid in range(1, 25):
+            p = ioh.get_problem(fid, 3, 5)
+            q = pickle.loads(pickle.dumps(p))
+            self.assertIs(type(q), type(p))
+            self.assertEqual(q(x), p(x))
+            self.assertEqual(q.meta_data.instance, 3)
+        for fid in range(1, 25):
+            p = ioh.get_problem(fid, 2, 16, "PBO")
+            q = pickle.loads(pickle.dumps(p))
+            self.assertEqual(q([1, 0] * 8), p([1, 0] * 8))
+        graph = ioh.problem.Graph(3, [(0, 1, 2.0), (1, 2, -1.0)])
+        q = pickle.loads(pickle.dumps(ioh.problem.MaxCut(1, graph)))
+        self.assertEqual(q.graph.weights, [2.0, -1.0])
+
+    def test_shared_rotations(self):
+        problems = [ioh.get_problem(fid, 1, 10) for fid in (1, 10, 24)]
+        x = [0.5] * 10
+        with ioh.problem.SharedRotations("ioh-test-shared", problems) as shared:
+            self.assertEqual(len(shared), 3)
+            data = [pickle.dumps(p) for p in problems]
+            self.assertLess(max(map(len, data)), 500)
+            with multiprocessing.Pool(2) as pool:
+                self.assertEqual(pool.map(_evaluate, data), [p(x) for p in problems])
+        self.assertGreater(len(pickle.dumps(problems[2])), 3 * 8 * 100)
+
     def test_bbob_problems_first_instance(self):
         expected = [
             161.17445568,